@@ -0,0 +1,437 @@
+#include "benchmarkRunner.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "../solver/solverFactory.h"
+#include "../topology/instance.h"
+#include "../tools/clockTime.h"
+#include "../tools/CSVReader.h"
+#include "../tools/jsonWriter.h"
+#include "../tools/telemetry.h"
+
+const std::vector<std::string> BenchmarkRunner::COLUMNS = {
+    "case", "status", "time", "peakRSS", "optimizations", "routed", "blocked", "UB", "LB", "gap",
+    "evaluations", "rootLB", "targetLB", "evaluationsToLB",
+    "phase:build", "phase:build/graph", "phase:build/preprocessing", "phase:build/formulation", "phase:build/charge", "phase:solve"
+};
+
+/****************************************************************************************/
+/*                                     Constructor                                      */
+/****************************************************************************************/
+
+BenchmarkRunner::BenchmarkRunner(const std::string &manifestFile, const std::string &prefix, int budget) : outputPrefix(prefix), timeBudget(budget){
+    std::ifstream manifest(manifestFile.c_str());
+    if (!manifest.is_open()){
+        std::cerr << "ERROR: Unable to open manifest file '" << manifestFile << "'." << std::endl;
+        exit(0);
+    }
+    std::string line;
+    while (std::getline(manifest, line)){
+        std::istringstream tokens(line);
+        BenchmarkCase c;
+        if (!(tokens >> c.name) || c.name[0] == '#'){
+            continue;
+        }
+        if (!(tokens >> c.parameterFile)){
+            std::cerr << "ERROR: Case '" << c.name << "' has no parameter file." << std::endl;
+            exit(0);
+        }
+        std::string parameter;
+        while (tokens >> parameter){
+            std::size_t equal = parameter.find('=');
+            if (equal == std::string::npos || equal == 0){
+                std::cerr << "ERROR: Override '" << parameter << "' of case '" << c.name << "' is not of the form <parameter>=<value>." << std::endl;
+                exit(0);
+            }
+            c.overrides.push_back(std::make_pair(parameter.substr(0, equal), parameter.substr(equal + 1)));
+        }
+        for (unsigned int i = 0; i < cases.size(); i++){
+            if (cases[i].name == c.name){
+                std::cerr << "ERROR: Case '" << c.name << "' appears twice in the manifest." << std::endl;
+                exit(0);
+            }
+        }
+        cases.push_back(c);
+    }
+    std::cout << "> Number of benchmark cases: " << cases.size() << std::endl;
+}
+
+/****************************************************************************************/
+/*                                       Methods                                        */
+/****************************************************************************************/
+
+std::string BenchmarkRunner::getCaseFile(const BenchmarkCase &c, const std::string &extension) const{
+    return outputPrefix + "_" + c.name + extension;
+}
+
+void BenchmarkRunner::writeParameterFile(const std::string &parameterFile, const ParameterOverrides &overrides, const std::string &fileName){
+    std::ifstream original(parameterFile.c_str());
+    if (!original.is_open()){
+        std::cerr << "ERROR: Unable to open parameters file '" << parameterFile << "'." << std::endl;
+        exit(0);
+    }
+    std::ofstream copy(fileName.c_str());
+    std::vector<bool> applied(overrides.size(), false);
+    std::string line;
+    while (std::getline(original, line)){
+        std::size_t start = line.find_first_not_of(" \t");
+        for (unsigned int i = 0; i < overrides.size() && start != std::string::npos; i++){
+            if (line.compare(start, overrides[i].first.size() + 1, overrides[i].first + "=") == 0){
+                line = overrides[i].first + "=" + overrides[i].second;
+                applied[i] = true;
+                break;
+            }
+        }
+        copy << line << std::endl;
+    }
+    for (unsigned int i = 0; i < overrides.size(); i++){
+        if (!applied[i]){
+            copy << overrides[i].first << "=" << overrides[i].second << std::endl;
+        }
+    }
+}
+
+void BenchmarkRunner::run(){
+    for (unsigned int i = 0; i < cases.size(); i++){
+        std::cout << "--- BENCHMARK CASE " << cases[i].name << " (" << i+1 << "/" << cases.size() << ") --- " << std::endl;
+        BenchmarkRecord record = execute(cases[i]);
+        std::cout << "Status: " << record["status"] << ", time: " << record["time"] << " sec, peak RSS: " << record["peakRSS"] << " kB." << std::endl;
+        std::vector<double> bounds;
+        std::istringstream values(record["rootBounds"]);
+        std::string value;
+        while (std::getline(values, value, ',')){
+            bounds.push_back(std::atof(value.c_str()));
+        }
+        record.erase("rootBounds");
+        records.push_back(record);
+        rootBounds.push_back(bounds);
+    }
+    setEvaluationsToLB();
+}
+
+std::string BenchmarkRunner::getGroup(const std::string &name){
+    return name.substr(0, name.find(':'));
+}
+
+/* The lower bound of a dual method never decreases, so the root bound of a case is the last of its trace. A bound within 
+1e-6 (relative) of the target reaches it. */
+void BenchmarkRunner::setEvaluationsToLB(){
+    const double TOLERANCE = 1e-6;
+    for (unsigned int i = 0; i < records.size(); i++){
+        if (rootBounds[i].empty()){
+            continue;
+        }
+        double target = rootBounds[i].back();
+        for (unsigned int j = 0; j < records.size(); j++){
+            if (!rootBounds[j].empty() && getGroup(cases[j].name) == getGroup(cases[i].name)){
+                target = std::min(target, rootBounds[j].back());
+            }
+        }
+        unsigned int evaluations = 0;
+        while (rootBounds[i][evaluations] < target - TOLERANCE*std::max(1.0, std::fabs(target))){
+            evaluations++;
+        }
+        records[i]["targetLB"] = std::to_string(target);
+        records[i]["evaluationsToLB"] = std::to_string(evaluations + 1);
+    }
+}
+
+BenchmarkRecord BenchmarkRunner::execute(const BenchmarkCase &c){
+    std::string parameterFile = getCaseFile(c, ".par");
+    std::string resultFile = getCaseFile(c, ".res");
+    std::string telemetryFile = getCaseFile(c, ".ndjson");
+    writeParameterFile(c.parameterFile, c.overrides, parameterFile);
+    remove(resultFile.c_str());
+    remove(telemetryFile.c_str());
+
+    ClockTime CASE_TIME(ClockTime::getTimeNow());
+    std::cout.flush();
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0){
+        std::cerr << "ERROR: Could not create the process of case '" << c.name << "'." << std::endl;
+        exit(0);
+    }
+    if (pid == 0){
+        // child: its output goes to the log of the case, and SIGALRM ends it after the budget
+        if (freopen(getCaseFile(c, ".log").c_str(), "w", stdout) == NULL){
+            _exit(1);
+        }
+        if (timeBudget > 0){
+            alarm((unsigned int)timeBudget);
+        }
+        runCase(parameterFile, telemetryFile, resultFile);
+        exit(0);
+    }
+
+    int status = 0;
+    struct rusage usage;
+    while (wait4(pid, &status, 0, &usage) < 0){
+        if (errno != EINTR){
+            std::cerr << "ERROR: Lost the process of case '" << c.name << "'." << std::endl;
+            exit(0);
+        }
+    }
+    BenchmarkRecord record = readRecord(resultFile);
+    record["case"] = c.name;
+    record["time"] = std::to_string(CASE_TIME.getTimeInSecFromStart());
+    record["peakRSS"] = std::to_string(usage.ru_maxrss);
+    if (WIFSIGNALED(status) && WTERMSIG(status) == SIGALRM){
+        record["status"] = "timeout";
+    }
+    else if (!WIFEXITED(status) || WEXITSTATUS(status) != 0 || record.find("optimizations") == record.end()){
+        // the program exits normally on its own errors: only a complete result file shows success
+        record["status"] = "failed";
+    }
+    else{
+        record["status"] = "ok";
+    }
+    return record;
+}
+
+void BenchmarkRunner::runCase(const std::string &parameterFile, const std::string &telemetryFile, const std::string &resultFile){
+    Input input(parameterFile);
+    Telemetry::open(telemetryFile);
+    int optimizations = 0;
+    int routed = 0;
+    int blocked = 0;
+    double upperBound = NAN, lowerBound = NAN, gap = NAN;
+    for (int i = 0; i < input.getNbDemandToBeRoutedFiles(); i++){
+        ClockTime OPTIMIZATION_TIME(ClockTime::getTimeNow());
+        Instance instance(input);
+        int initiallyRouted = instance.getNbRoutedDemands();
+        std::string nextFile = instance.getInput().getDemandToBeRoutedFilesFromIndex(i);
+        instance.generateDemandsFromFile(nextFile);
+
+        bool feasibility = true;
+        while(instance.getNextDemandToBeRoutedIndex() < instance.getNbDemands() && feasibility == true && (instance.getInput().getOptimizationTimeLimit() >= OPTIMIZATION_TIME.getTimeInSecFromStart())){
+            optimizations++;
+            Telemetry::beginIteration(getInBetweenString(nextFile, "/", ".") + "_" + std::to_string(optimizations));
+            if ((instance.getInput().getOptimizationTimeLimit() - OPTIMIZATION_TIME.getTimeInSecFromStart()) < instance.getInput().getIterationTimeLimit()){
+                instance.setTimeLimit(std::max(0, instance.getInput().getOptimizationTimeLimit() - (int)OPTIMIZATION_TIME.getTimeInSecFromStart()));
+            }
+            SolverFactory factory;
+            Telemetry::Span buildSpan("build", true);
+            AbstractSolver *solver = factory.createSolver(instance);
+            buildSpan.stop();
+            Telemetry::Span solveSpan("solve", true);
+            solver->solve();
+            solveSpan.stop();
+            solver->updateRSA(instance);
+            upperBound = solver->getUpperBound();
+            lowerBound = solver->getLowerBound();
+            gap = solver->getMipGap();
+            delete solver;
+            if (instance.getInput().isBlockingAllowed() == false && instance.getWasBlocked() == true){
+                feasibility = false;
+            }
+            Telemetry::endIteration();
+        }
+        routed += instance.getNbRoutedDemands() - initiallyRouted;
+        blocked += instance.getNbNonRoutedDemands();
+    }
+    std::map<std::string, double> phases = Telemetry::getRunTimes();
+    long long evaluations = Telemetry::getRunCounter(Telemetry::COUNTER_SUBPROBLEMS);
+    std::vector<double> bounds = Telemetry::getRootBounds();
+    Telemetry::close();
+
+    std::ofstream result(resultFile.c_str());
+    result << "routed=" << routed << std::endl;
+    result << "blocked=" << blocked << std::endl;
+    result << "UB=" << upperBound << std::endl;
+    result << "LB=" << lowerBound << std::endl;
+    result << "gap=" << gap << std::endl;
+    result << "evaluations=" << evaluations << std::endl;
+    if (!bounds.empty()){
+        result << "rootLB=" << bounds.back() << std::endl;
+        result << "rootBounds=";
+        for (unsigned int b = 0; b < bounds.size(); b++){
+            result << (b > 0 ? "," : "") << std::setprecision(17) << bounds[b];
+        }
+        result << std::endl;
+    }
+    for (std::map<std::string, double>::const_iterator it = phases.begin(); it != phases.end(); ++it){
+        result << "phase:" << it->first << "=" << it->second << std::endl;
+    }
+    // written last: its presence shows the file is complete
+    result << "optimizations=" << optimizations << std::endl;
+}
+
+BenchmarkRecord BenchmarkRunner::readRecord(const std::string &fileName){
+    BenchmarkRecord record;
+    std::ifstream file(fileName.c_str());
+    std::string line;
+    while (std::getline(file, line)){
+        std::size_t equal = line.find('=');
+        if (equal != std::string::npos){
+            record[line.substr(0, equal)] = line.substr(equal + 1);
+        }
+    }
+    return record;
+}
+
+/****************************************************************************************/
+/*                                       Results                                        */
+/****************************************************************************************/
+
+void BenchmarkRunner::writeCsv() const{
+    std::string fileName = outputPrefix + ".csv";
+    std::ofstream file(fileName.c_str());
+    std::string delimiter = ";";
+    for (unsigned int j = 0; j < COLUMNS.size(); j++){
+        file << COLUMNS[j] << (j+1 < COLUMNS.size() ? delimiter : "");
+    }
+    file << std::endl;
+    for (unsigned int i = 0; i < records.size(); i++){
+        for (unsigned int j = 0; j < COLUMNS.size(); j++){
+            BenchmarkRecord::const_iterator it = records[i].find(COLUMNS[j]);
+            file << (it == records[i].end() ? "" : it->second) << (j+1 < COLUMNS.size() ? delimiter : "");
+        }
+        file << std::endl;
+    }
+    std::cout << "Results written to " << fileName << "." << std::endl;
+}
+
+/* {"cases":[{"case":..,"status":..,"time":..,...,"phases":{path:time}}]}; numbers that are not finite are written as null. */
+void BenchmarkRunner::writeJson() const{
+    std::string fileName = outputPrefix + ".json";
+    FILE *file = fopen(fileName.c_str(), "w");
+    if (file == NULL){
+        std::cout << "WARNING: Could not open " << fileName << "." << std::endl;
+        return;
+    }
+    JsonWriter json(file);
+    json.beginObject();
+    json.key("cases");
+    json.beginArray();
+    for (unsigned int i = 0; i < records.size(); i++){
+        json.beginObject();
+        for (BenchmarkRecord::const_iterator it = records[i].begin(); it != records[i].end(); ++it){
+            if (it->first.compare(0, 6, "phase:") == 0){
+                continue;
+            }
+            json.key(it->first);
+            if (it->first == "case" || it->first == "status"){
+                json.value(it->second);
+            }
+            else{
+                json.number(std::isfinite(std::atof(it->second.c_str())) ? it->second : std::string());
+            }
+        }
+        json.key("phases");
+        json.beginObject();
+        for (BenchmarkRecord::const_iterator it = records[i].begin(); it != records[i].end(); ++it){
+            if (it->first.compare(0, 6, "phase:") == 0){
+                json.key(it->first.substr(6));
+                json.number(it->second);
+            }
+        }
+        json.endObject();
+        json.endObject();
+    }
+    json.endArray();
+    json.endObject();
+    fputc('\n', file);
+    fclose(file);
+    std::cout << "Results written to " << fileName << "." << std::endl;
+}
+
+std::vector<BenchmarkRecord> BenchmarkRunner::readCsv(const std::string &fileName){
+    std::vector<BenchmarkRecord> baseline;
+    std::ifstream file(fileName.c_str());
+    if (!file.is_open()){
+        std::cerr << "ERROR: Unable to open baseline file '" << fileName << "'." << std::endl;
+        exit(0);
+    }
+    std::string line;
+    std::vector<std::string> header;
+    while (std::getline(file, line)){
+        std::vector<std::string> fields;
+        std::istringstream stream(line);
+        std::string field;
+        while (std::getline(stream, field, ';')){
+            fields.push_back(field);
+        }
+        if (header.empty()){
+            header = fields;
+            continue;
+        }
+        BenchmarkRecord record;
+        for (unsigned int j = 0; j < fields.size() && j < header.size(); j++){
+            record[header[j]] = fields[j];
+        }
+        baseline.push_back(record);
+    }
+    return baseline;
+}
+
+/* Times below 0.05 sec and memory increases below 1 MB are not reported: they are measurement noise. */
+int BenchmarkRunner::compare(const std::string &baselineFile, double threshold) const{
+    const double TIME_NOISE = 0.05;
+    const double MEMORY_NOISE = 1024;
+    std::vector<BenchmarkRecord> baseline = readCsv(baselineFile);
+    int nbRegressions = 0;
+    for (unsigned int i = 0; i < records.size(); i++){
+        const BenchmarkRecord &current = records[i];
+        const BenchmarkRecord *reference = NULL;
+        for (unsigned int b = 0; b < baseline.size(); b++){
+            if (baseline[b].count("case") && baseline[b].at("case") == current.at("case")){
+                reference = &baseline[b];
+            }
+        }
+        if (reference == NULL){
+            std::cout << "Case " << current.at("case") << " is not in the baseline." << std::endl;
+            continue;
+        }
+        if (reference->count("status") && reference->at("status") == "ok" && current.at("status") != "ok"){
+            std::cout << "REGRESSION: Case " << current.at("case") << " ended with status " << current.at("status") << "." << std::endl;
+            nbRegressions++;
+            continue;
+        }
+        for (unsigned int j = 0; j < COLUMNS.size(); j++){
+            const std::string &column = COLUMNS[j];
+            bool isTime = (column == "time" || column.compare(0, 6, "phase:") == 0);
+            if (!isTime && column != "peakRSS" && column != "blocked"){
+                continue;
+            }
+            BenchmarkRecord::const_iterator now = current.find(column);
+            BenchmarkRecord::const_iterator before = reference->find(column);
+            if (now == current.end() || before == reference->end() || now->second.empty() || before->second.empty()){
+                continue;
+            }
+            double valueNow = std::atof(now->second.c_str());
+            double valueBefore = std::atof(before->second.c_str());
+            bool regression;
+            if (column == "blocked"){
+                regression = (valueNow > valueBefore);
+            }
+            else{
+                double noise = (isTime ? TIME_NOISE : MEMORY_NOISE);
+                regression = (valueNow > valueBefore*(1 + threshold) && valueNow - valueBefore > noise);
+            }
+            if (regression){
+                std::cout << "REGRESSION: Case " << current.at("case") << ", " << column << ": " << valueBefore << " -> " << valueNow;
+                if (valueBefore > 0){
+                    std::cout << " (+" << 100*(valueNow - valueBefore)/valueBefore << "%)";
+                }
+                std::cout << "." << std::endl;
+                nbRegressions++;
+            }
+        }
+    }
+    std::cout << nbRegressions << " regressions found with respect to " << baselineFile << "." << std::endl;
+    return nbRegressions;
+}
@@ -0,0 +1,95 @@
+#ifndef BENCHMARK_RUNNER_H
+#define BENCHMARK_RUNNER_H
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+/** Parameters (name, value) replacing the ones of a parameter file. **/
+typedef std::vector< std::pair<std::string, std::string> > ParameterOverrides;
+
+/** A case of the benchmark: a parameter file and the parameters overriding its values. **/
+struct BenchmarkCase {
+    std::string name;               /**< Identifies the case in the results and in the baseline. **/
+    std::string parameterFile;      /**< The parameter file of the instance. **/
+    ParameterOverrides overrides;   /**< Parameters replacing the ones of the file. **/
+};
+
+/** The measures of a case, by name (e.g., "status", "time", "phase:build/graph"). **/
+typedef std::map<std::string, std::string> BenchmarkRecord;
+
+/***********************************************************************************************
+ * Runs the cases listed in a manifest and gathers their measures. Each line of the manifest is
+ *          <case name> <parameter file> [<parameter>=<value> ...]
+ * and empty lines or lines starting with '#' are ignored. Every case is run by a child process
+ * of the runner, so that the static state of a case (multiplier store, QoT cache, telemetry)
+ * never leaks into the next one and a crash or an exit only ends its own case. The child stops
+ * after the time budget. The parameter file, the log, the telemetry and the measures of a case
+ * are written next to the results as <prefix>_<case>.par, .log, .ndjson and .res.
+ * The results contain, per case: status (ok, timeout, failed), wall time, peak resident memory,
+ * number of optimizations, routed and blocked demands, bounds and gap of the last optimization
+ * and the time of each phase measured by the telemetry. Cases solved with a Lagrangian method
+ * also report the subproblems evaluated, the lower bound of the first root dual (rootLB) and
+ * the evaluations this dual needed to reach the target bound of its group (evaluationsToLB).
+ * The cases whose names share the part before ':' (e.g., spain15:subgradient and
+ * spain15:bundle) form a group, whose target is the lowest rootLB of its cases: the dual methods
+ * are compared by the evaluations they need for the same bound.
+ * ********************************************************************************************/
+class BenchmarkRunner {
+
+    private:
+        std::vector<BenchmarkCase> cases;       /**< The cases of the manifest. **/
+        std::string outputPrefix;               /**< Prefix of every file written by the runner. **/
+        int timeBudget;                         /**< Time (in seconds) after which a case is stopped. 0 for no limit. **/
+        std::vector<BenchmarkRecord> records;   /**< The measures of the cases already run. **/
+        std::vector< std::vector<double> > rootBounds; /**< Lower bound after each evaluation of the first root dual of each case run. **/
+
+        /** Columns of the CSV results. The phases are the main ones; all of them are in the JSON results. **/
+        static const std::vector<std::string> COLUMNS;
+
+        /** Returns the name of a file of a case. @param extension The extension, with its dot. **/
+        std::string getCaseFile(const BenchmarkCase &c, const std::string &extension) const;
+
+        /** Runs a case in a child process and returns its measures. **/
+        BenchmarkRecord execute(const BenchmarkCase &c);
+
+        /** Optimizes every file of demands as the main program does and writes the measures. Runs in the child process. **/
+        static void runCase(const std::string &parameterFile, const std::string &telemetryFile, const std::string &resultFile);
+
+        /** Returns the group of a case: the part of its name before ':', or the whole name. **/
+        static std::string getGroup(const std::string &name);
+
+        /** Sets the target bound of each group and the evaluations each case needed to reach it. **/
+        void setEvaluationsToLB();
+
+        /** Reads a file of lines <name>=<value>. **/
+        static BenchmarkRecord readRecord(const std::string &fileName);
+
+        /** Reads the results of a previous run written by writeCsv. **/
+        static std::vector<BenchmarkRecord> readCsv(const std::string &fileName);
+
+    public:
+        /** Writes a copy of a parameter file with the overrides applied. Parameters absent from the original are appended. **/
+        static void writeParameterFile(const std::string &parameterFile, const ParameterOverrides &overrides, const std::string &fileName);
+
+        /** Reads the manifest. @param manifestFile The manifest. @param prefix Prefix of the files written. @param budget Time budget (in seconds) of a case. **/
+        BenchmarkRunner(const std::string &manifestFile, const std::string &prefix, int budget);
+
+        /** Runs every case. **/
+        void run();
+
+        /** Writes the results to <prefix>.csv. **/
+        void writeCsv() const;
+
+        /** Writes the results, with every phase, to <prefix>.json. **/
+        void writeJson() const;
+
+        /** Compares the results with the ones of a baseline and displays every regression: time, phase time or peak 
+         * memory increased by more than the threshold, more demands blocked or a case no longer ending normally.
+         * @param baselineFile The CSV results of the baseline. @param threshold The relative increase tolerated (e.g., 0.1). 
+         * Returns the number of regressions. **/
+        int compare(const std::string &baselineFile, double threshold) const;
+};
+
+#endif
@@ -0,0 +1,36 @@
+// Benchmark runner: runs the cases of a manifest and compares their results with a baseline.
+
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "benchmarkRunner.h"
+
+int main(int argc, char *argv[]) {
+	/********************************************************************/
+	/* 						Get the arguments 							*/
+	/********************************************************************/
+	if (argc < 3){
+		std::cerr << "A manifest and an output prefix are required in the arguments. Please run the program as \n./runBenchmark manifest.txt outputPrefix [timeBudget] [baseline.csv] [threshold]\n";
+		throw std::invalid_argument( "did not receive an argument" );
+	}
+	std::string manifestFile = argv[1];
+	std::string outputPrefix = argv[2];
+	int timeBudget = (argc > 3) ? std::atoi(argv[3]) : 3600;
+	std::string baselineFile = (argc > 4) ? argv[4] : "";
+	double threshold = (argc > 5) ? std::atof(argv[5]) : 0.1;
+	std::cout << "MANIFEST FILE: " << manifestFile << std::endl;
+
+	/********************************************************************/
+	/* 						Run and compare 							*/
+	/********************************************************************/
+	BenchmarkRunner runner(manifestFile, outputPrefix, timeBudget);
+	runner.run();
+	runner.writeCsv();
+	runner.writeJson();
+	if (!baselineFile.empty() && runner.compare(baselineFile, threshold) > 0){
+		return 1;
+	}
+	return 0;
+}
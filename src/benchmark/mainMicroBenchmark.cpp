@@ -0,0 +1,42 @@
+// Micro-benchmarks of the inner kernels on synthetic instances.
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "microBenchmark.h"
+
+int main(int argc, char *argv[]) {
+	/********************************************************************/
+	/* 						Get the arguments 							*/
+	/********************************************************************/
+	if (argc < 3){
+		std::cerr << "A template parameter file and a folder are required in the arguments. Please run the program as \n./runMicroBenchmark onlineParameters.txt folder [repetitions] [nodesxslicesxdemands ...]\n";
+		throw std::invalid_argument( "did not receive an argument" );
+	}
+	std::string templateFile = argv[1];
+	std::string folder = argv[2];
+	int repetitions = (argc > 3) ? std::atoi(argv[3]) : 5;
+	std::vector<SyntheticSize> sizes;
+	for (int i = 4; i < argc; i++){
+		SyntheticSize size;
+		if (sscanf(argv[i], "%dx%dx%d", &size.nbNodes, &size.nbSlices, &size.nbDemands) != 3 || size.nbNodes < 3 || size.nbSlices < 1 || size.nbDemands < 1){
+			std::cerr << "ERROR: Size '" << argv[i] << "' is not of the form <nodes>x<slices>x<demands>." << std::endl;
+			exit(0);
+		}
+		sizes.push_back(size);
+	}
+	if (sizes.empty()){
+		sizes = {{6, 40, 10}, {12, 80, 30}, {24, 160, 60}};
+	}
+
+	/********************************************************************/
+	/* 							Measure 								*/
+	/********************************************************************/
+	MicroBenchmark benchmark(templateFile, folder, repetitions);
+	benchmark.run(sizes);
+	return 0;
+}
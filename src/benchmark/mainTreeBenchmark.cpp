@@ -0,0 +1,39 @@
+// Benchmark of a CBC enumeration tree solved with the Lagrangian solver interface.
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include "treeBenchmark.h"
+
+int main(int argc, char *argv[]) {
+	/********************************************************************/
+	/* 						Get the arguments 							*/
+	/********************************************************************/
+	if (argc < 3){
+		std::cerr << "A template parameter file and a folder are required in the arguments. Please run the program as \n./runTreeBenchmark onlineParameters.txt folder [nodeLimit] [nodesxslicesxdemands] [method]\n";
+		throw std::invalid_argument( "did not receive an argument" );
+	}
+	std::string templateFile = argv[1];
+	std::string folder = argv[2];
+	int nodeLimit = (argc > 3) ? std::atoi(argv[3]) : 1000;
+	SyntheticSize size = {24, 160, 60};
+	if (argc > 4 && (sscanf(argv[4], "%dx%dx%d", &size.nbNodes, &size.nbSlices, &size.nbDemands) != 3 || size.nbNodes < 3 || size.nbSlices < 1 || size.nbDemands < 1)){
+		std::cerr << "ERROR: Size '" << argv[4] << "' is not of the form <nodes>x<slices>x<demands>." << std::endl;
+		exit(0);
+	}
+	int nodeMethod = (argc > 5) ? std::atoi(argv[5]) : 1;
+	if (nodeLimit < 1 || nodeMethod < 1 || nodeMethod > 3){
+		std::cerr << "ERROR: The node limit must be positive and the method one of the Lagrangian node methods (1, 2 or 3)." << std::endl;
+		exit(0);
+	}
+
+	/********************************************************************/
+	/* 							Measure 								*/
+	/********************************************************************/
+	TreeBenchmark benchmark(templateFile, folder);
+	benchmark.run(size, nodeLimit, nodeMethod);
+	return 0;
+}
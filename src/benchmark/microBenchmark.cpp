@@ -0,0 +1,324 @@
+#include "microBenchmark.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <random>
+
+#include "../formulation/edgeNodeForm.h"
+#include "../formulation/flowForm.h"
+#include "../lagrangian/formulation/lagFormulationFactory.h"
+#include "../lagrangian/heuristic/shortestPathHeuristic.h"
+#include "../lagrangian/tools/lagTools.h"
+#include "../solver/solverCBC.h"
+#include "../solver/solverCplex.h"
+#include "../solver/solverGreedy.h"
+#include "../topology/instance.h"
+#include "../tools/clockTime.h"
+
+/****************************************************************************************/
+/*                                  Allocation counting                                 */
+/****************************************************************************************/
+
+/* The global allocation functions are replaced in the benchmark program only. The array and
+nothrow forms call these ones. */
+static std::atomic<long> nbAllocations(0);
+
+void * operator new(std::size_t size){
+    nbAllocations++;
+    void *p = malloc(size ? size : 1);
+    if (p == NULL){
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void operator delete(void *p) noexcept{
+    free(p);
+}
+
+long MicroBenchmark::kernelAllocations = -1;
+
+long MicroBenchmark::getNbAllocations(){
+    return nbAllocations.load();
+}
+
+/****************************************************************************************/
+/*                                 Cost operators kernel                                */
+/****************************************************************************************/
+
+/* The arc costs of the Lagrangian flow sub-problems, as built at each iteration: an operator
+viewing the non-overlapping multipliers, combined with the length term through LEMON map
+adaptors. Every cost is read once, as a shortest path would. */
+class CostOperatorKernel : public RSA {
+    public:
+        CostOperatorKernel(const Instance &instance) : RSA(instance){}
+
+        /* Returns the time of the iterations. @param nbIterations The number of iterations. */
+        double run(int nbIterations){
+            DualLayout layout;
+            int overlap = layout.addSegment(std::vector<int>(auxNbSlicesLimitFromEdge.begin(), auxNbSlicesLimitFromEdge.begin() + instance.getNbEdges()));
+            DualVector multiplier;
+            multiplier.allocate(layout, 0.5);
+            DualMatrix multiplierOverlap = multiplier.matrix(overlap);
+
+            double total = 0.0;
+            long allocations = MicroBenchmark::getNbAllocations();
+            ClockTime time(ClockTime::getTimeNow());
+            for (int i = 0; i < nbIterations; i++){
+                operatorCost oper(multiplierOverlap);
+                for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+                    double scale = 1.0/getToBeRouted_k(d).getMaxLength();
+                    ScaleMapCost scaleMap((*vecArcLength[d]), scale);
+                    AddMapCost addMap((*vecArcLength[d]), scaleMap);
+                    oper.setDemandLoad(getToBeRouted_k(d).getLoad());
+                    CombineMapCost combine((*vecArcLabel[d]), (*vecArcSlice[d]), oper);
+                    AddMapFinalCost addMapFinal(combine, addMap);
+                    for (ListDigraph::ArcIt a(*vecGraph[d]); a != INVALID; ++a){
+                        total += addMapFinal[a];
+                    }
+                }
+            }
+            double seconds = time.getTimeInSecFromStart();
+            MicroBenchmark::setKernelAllocations(MicroBenchmark::getNbAllocations() - allocations);
+            // keeps the costs from being optimized away
+            if (total < 0.0){
+                std::cout << total << std::endl;
+            }
+            return seconds;
+        }
+};
+
+/****************************************************************************************/
+/*                                     Constructor                                      */
+/****************************************************************************************/
+
+MicroBenchmark::MicroBenchmark(const std::string &t, const std::string &f, int r) : templateFile(t), folder(f), repetitions(std::max(1, r)){
+    std::string fileName = folder + "/microBenchmark.csv";
+    results.open(fileName.c_str());
+    if (!results.is_open()){
+        std::cerr << "ERROR: Unable to open results file '" << fileName << "'." << std::endl;
+        exit(0);
+    }
+    results << "kernel;nodes;slices;demands;repetitions;min;median;mean;allocations" << std::endl;
+}
+
+/****************************************************************************************/
+/*                                 Synthetic instances                                  */
+/****************************************************************************************/
+
+/* A ring, plus a chord from every even node of the first half to the opposite node. Lengths vary from 80 to 400 km. */
+void MicroBenchmark::writeTopology(const std::string &fileName, const SyntheticSize &size){
+    std::ofstream file(fileName.c_str());
+    std::string delimiter = ";";
+    file << "Index;Origin;Destination;Length;Nbr slices;Cost;" << std::endl;
+    int index = 1;
+    for (int i = 0; i < size.nbNodes; i++){
+        file << index << delimiter << i+1 << delimiter << (i+1)%size.nbNodes + 1 << delimiter;
+        file << 80 + (37*index)%321 << delimiter << size.nbSlices << delimiter << 1 << delimiter << std::endl;
+        index++;
+    }
+    for (int i = 0; i < size.nbNodes/2; i += 2){
+        file << index << delimiter << i+1 << delimiter << i + size.nbNodes/2 + 1 << delimiter;
+        file << 80 + (37*index)%321 << delimiter << size.nbSlices << delimiter << 1 << delimiter << std::endl;
+        index++;
+    }
+}
+
+/* Loads from 1 to 4 slices; the GNPY columns (mode, spacing, path bandwidth) are only read by the QoT preprocessing. */
+void MicroBenchmark::writeDemands(const std::string &fileName, const SyntheticSize &size){
+    std::mt19937 generator(1234567890);
+    std::uniform_int_distribution<int> node(0, size.nbNodes - 1);
+    std::uniform_int_distribution<int> load(1, std::max(1, std::min(4, size.nbSlices/4)));
+    std::ofstream file(fileName.c_str());
+    std::string delimiter = ";";
+    file << "index;origin;destination;slots;max_length;mode;spacing;path_bandwidth" << std::endl;
+    for (int d = 0; d < size.nbDemands; d++){
+        int source = node(generator);
+        int target = node(generator);
+        while (target == source){
+            target = node(generator);
+        }
+        int slots = load(generator);
+        file << d+1 << delimiter << source+1 << delimiter << target+1 << delimiter << slots << delimiter;
+        file << 5000 << delimiter << (slots <= 2 ? 1 : 2) << delimiter << "50e9" << delimiter << "100e9" << std::endl;
+    }
+}
+
+std::string MicroBenchmark::generateInstance(const std::string &folder, const SyntheticSize &size){
+    std::string instanceFolder = folder + "/" + std::to_string(size.nbNodes) + "nodes_" + std::to_string(size.nbSlices) + "slices_" + std::to_string(size.nbDemands) + "demands";
+    std::string command = "mkdir -p " + instanceFolder + "/Demands";
+    if (system(command.c_str()) != 0){
+        std::cerr << "ERROR: Could not create folder '" << instanceFolder << "'." << std::endl;
+        exit(0);
+    }
+    writeTopology(instanceFolder + "/Link.csv", size);
+    writeDemands(instanceFolder + "/Demands/demands.csv", size);
+    return instanceFolder;
+}
+
+/* Files written by the program (telemetry, GNPY cache, multipliers) are disabled, so that every run starts from the same state. */
+std::string MicroBenchmark::writeParameterFile(const std::string &templateFile, const std::string &instanceFolder, const SyntheticSize &size, const ParameterOverrides &overrides, const std::string &name){
+    ParameterOverrides parameters = {
+        {"topologyFile", instanceFolder + "/Link.csv"},
+        {"initialMappingDemandFile", ""},
+        {"initialMappingAssignmentFile", ""},
+        {"demandToBeRoutedFolder", instanceFolder + "/Demands"},
+        {"outputPath", instanceFolder + "/"},
+        {"nbDemandsAtOnce", std::to_string(size.nbDemands)},
+        {"telemetryFile", ""},
+        {"GNPY_cacheFile", ""},
+        {"multiplierStoreFile", ""},
+        {"lagrangianFixing", "0"},
+        {"lagrangianRelaxation", "0"},
+        {"relaxMethod", "0"}
+    };
+    parameters.insert(parameters.end(), overrides.begin(), overrides.end());
+    std::string parameterFile = instanceFolder + "/" + name + ".par";
+    BenchmarkRunner::writeParameterFile(templateFile, parameters, parameterFile);
+    return parameterFile;
+}
+
+/****************************************************************************************/
+/*                                      Measures                                        */
+/****************************************************************************************/
+
+void MicroBenchmark::measure(const std::string &name, const SyntheticSize &size, const std::string &instanceFolder, const ParameterOverrides &overrides, const Kernel &kernel){
+    std::string parameterFile = writeParameterFile(templateFile, instanceFolder, size, overrides, "microBenchmark");
+
+    // the kernels are verbose: their output is discarded while they run
+    std::ofstream discard("/dev/null");
+    std::streambuf *console = std::cout.rdbuf(discard.rdbuf());
+    std::vector<double> times;
+    long allocations = -1;
+    for (int r = 0; r < repetitions; r++){
+        Input input(parameterFile);
+        Instance instance(input);
+        instance.generateDemandsFromFile(input.getDemandToBeRoutedFilesFromIndex(0));
+        kernelAllocations = -1;
+        times.push_back(kernel(instance));
+        allocations = std::max(allocations, kernelAllocations);
+    }
+    std::cout.rdbuf(console);
+
+    std::sort(times.begin(), times.end());
+    double mean = 0.0;
+    for (unsigned int r = 0; r < times.size(); r++){
+        mean += times[r]/times.size();
+    }
+    double median = (times.size()%2 == 1) ? times[times.size()/2] : 0.5*(times[times.size()/2 - 1] + times[times.size()/2]);
+    std::cout << std::left << std::setw(32) << name << std::right;
+    std::cout << std::setw(6) << size.nbNodes << std::setw(8) << size.nbSlices << std::setw(8) << size.nbDemands;
+    std::cout << std::fixed << std::setprecision(6) << std::setw(12) << times.front() << std::setw(12) << median << std::setw(12) << mean;
+    std::string allocationsField = (allocations >= 0) ? std::to_string(allocations) : "-";
+    std::cout << std::setw(14) << allocationsField << std::endl;
+    std::string delimiter = ";";
+    results << name << delimiter << size.nbNodes << delimiter << size.nbSlices << delimiter << size.nbDemands << delimiter << repetitions << delimiter;
+    results << times.front() << delimiter << median << delimiter << mean << delimiter << allocationsField << std::endl;
+}
+
+void MicroBenchmark::run(const std::vector<SyntheticSize> &sizes){
+    std::cout << std::left << std::setw(32) << "kernel" << std::right << std::setw(6) << "nodes" << std::setw(8) << "slices" << std::setw(8) << "demands";
+    std::cout << std::setw(12) << "min (s)" << std::setw(12) << "median (s)" << std::setw(12) << "mean (s)" << std::setw(14) << "allocations" << std::endl;
+    for (unsigned int s = 0; s < sizes.size(); s++){
+        const SyntheticSize &size = sizes[s];
+        std::string instanceFolder = generateInstance(folder, size);
+
+        /** RSA graph construction and preprocessing **/
+        measure("rsa/graph", size, instanceFolder, {{"preprocessingLevel", "0"}}, [](Instance &instance){
+            RSA rsa(instance);
+            return rsa.getRSAGraphConstructionTime();
+        });
+        for (int level = Input::PREPROCESSING_LVL_NO; level <= Input::PREPROCESSING_LVL_QOT; level++){
+            ParameterOverrides overrides = {{"preprocessingLevel", std::to_string(level)}};
+            if (level == Input::PREPROCESSING_LVL_QOT){
+                // the QoT level only runs with GNPY enabled; the native GN model needs no external tool
+                overrides.push_back({"GNPY_activation", "1"});
+                overrides.push_back({"GNPY_evaluator", std::to_string(Input::QOT_EVALUATOR_GN_MODEL)});
+            }
+            measure("rsa/preprocessing/" + std::to_string(level), size, instanceFolder, overrides, [](Instance &instance){
+                RSA rsa(instance);
+                return rsa.getPreprocessingTime();
+            });
+        }
+
+        /** Model generation **/
+        measure("formulation/flow", size, instanceFolder, {{"formulation", "0"}}, [](Instance &instance){
+            FlowForm formulation(instance);
+            return formulation.getTotalImpleTime();
+        });
+        measure("formulation/edgeNode", size, instanceFolder, {{"formulation", "1"}}, [](Instance &instance){
+            EdgeNodeForm formulation(instance);
+            return formulation.getTotalImpleTime();
+        });
+
+        /** Model loading **/
+        measure("solver/cplex", size, instanceFolder, {{"formulation", "0"}, {"solver", "0"}}, [](Instance &instance){
+            SolverCplex solver(instance);
+            return solver.getTotalChargeTime();
+        });
+        measure("solver/cbc", size, instanceFolder, {{"formulation", "0"}, {"solver", "1"}, {"method", "0"}}, [](Instance &instance){
+            SolverCBC solver(instance);
+            return solver.getTotalChargeTime();
+        });
+
+        /** Greedy routing of the whole batch **/
+        measure("solver/greedy", size, instanceFolder, {{"solver", std::to_string(Input::MIP_SOLVER_GREEDY)}, {"method", "0"}, {"greedyAdmission", "0"}}, [](Instance &instance){
+            SolverGreedy solver(instance);
+            ClockTime time(ClockTime::getTimeNow());
+            solver.solve();
+            return time.getTimeInSecFromStart();
+        });
+
+        /** One Lagrangian iteration: sub-problem, direction and multipliers **/
+        const std::pair<std::string, int> lagFormulations[] = {
+            {"lagrangian/flow", Input::LAG_FLOW},
+            {"lagrangian/nonOverlapping", Input::LAG_OVERLAP},
+            {"lagrangian/newNonOverlapping", Input::LAG_OVERLAPPING}
+        };
+        for (const std::pair<std::string, int> &lag : lagFormulations){
+            measure(lag.first, size, instanceFolder, {{"lagFormulation", std::to_string(lag.second)}}, [](Instance &instance){
+                lagFormulationFactory factory;
+                std::unique_ptr<AbstractLagFormulation> formulation(factory.createFormulation(instance));
+                formulation->init();
+                long allocations = MicroBenchmark::getNbAllocations();
+                ClockTime time(ClockTime::getTimeNow());
+                formulation->run();
+                formulation->updateDirection();
+                formulation->updateMultiplier(0.01);
+                double seconds = time.getTimeInSecFromStart();
+                MicroBenchmark::setKernelAllocations(MicroBenchmark::getNbAllocations() - allocations);
+                return seconds;
+            });
+        }
+
+        /** Costs of the Lagrangian flow sub-problems over 100 iterations (see CostOperatorKernel) **/
+        measure("lagrangian/costOperators", size, instanceFolder, {}, [](Instance &instance){
+            CostOperatorKernel kernel(instance);
+            return kernel.run(100);
+        });
+
+        /** Heuristic, after one iteration of the Lagrangian flow formulation **/
+        measure("heuristic/shortestPath", size, instanceFolder, {{"lagFormulation", std::to_string(Input::LAG_FLOW)}}, [](Instance &instance){
+            lagFormulationFactory factory;
+            std::unique_ptr<AbstractLagFormulation> formulation(factory.createFormulation(instance));
+            formulation->init();
+            formulation->run();
+            shortestPathHeuristic heuristic(formulation.get());
+            ClockTime time(ClockTime::getTimeNow());
+            heuristic.run();
+            return time.getTimeInSecFromStart();
+        });
+
+        /** Output of the instance **/
+        measure("instance/output", size, instanceFolder, {}, [](Instance &instance){
+            ClockTime time(ClockTime::getTimeNow());
+            instance.output("microBenchmark");
+            return time.getTimeInSecFromStart();
+        });
+    }
+}
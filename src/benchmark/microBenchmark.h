@@ -0,0 +1,75 @@
+#ifndef MICRO_BENCHMARK_H
+#define MICRO_BENCHMARK_H
+
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "benchmarkRunner.h"
+
+class Instance;
+
+/** Size of a synthetic instance. **/
+struct SyntheticSize {
+    int nbNodes;        /**< Nodes of the topology. **/
+    int nbSlices;       /**< Slices of every link. **/
+    int nbDemands;      /**< Demands to be routed, all of them at once. **/
+};
+
+/***********************************************************************************************
+ * In-house micro-benchmarks of the inner kernels: RSA graph construction and each level of
+ * preprocessing, Flow and Edge-Node model generation, CPLEX and CBC model loading, one
+ * iteration of each Lagrangian formulation, the cost operators of the Lagrangian flow
+ * sub-problems, the greedy solver, the shortest path heuristic and Instance::output.
+ * Every kernel runs on synthetic instances of the given sizes: a ring with chords whose links
+ * all have the same number of slices, and demands drawn with a fixed seed, so that two runs
+ * measure exactly the same work. The remaining parameters are the ones of a template parameter
+ * file. Each kernel is repeated and only its own part is timed (e.g., the loading of a model,
+ * not the construction of the formulation it loads); the minimum, median and mean times are
+ * displayed and written to <folder>/microBenchmark.csv. The kernels of the Lagrangian iterations
+ * also report the number of heap allocations made in their timed part.
+ * ********************************************************************************************/
+class MicroBenchmark {
+
+    public:
+        /** A kernel receives a fresh instance with its demands and returns the time (in seconds) of the part measured. **/
+        typedef std::function<double(Instance &)> Kernel;
+
+        /** Returns the number of heap allocations made by the program so far. **/
+        static long getNbAllocations();
+
+        /** Reports the number of allocations made in the timed part of the current kernel. **/
+        static void setKernelAllocations(long nb) { kernelAllocations = nb; }
+
+    private:
+        std::string templateFile;   /**< Parameter file providing the parameters not set by the benchmarks. **/
+        std::string folder;         /**< Folder receiving the synthetic instances and the results. **/
+        int repetitions;            /**< Number of measures of each kernel. **/
+        std::ofstream results;      /**< The CSV results. **/
+        static long kernelAllocations;  /**< Allocations reported by the current kernel, -1 if none. **/
+
+        /** Measures a kernel on instances of the given size. @param overrides Parameters of the kernel (e.g., the formulation). **/
+        void measure(const std::string &name, const SyntheticSize &size, const std::string &instanceFolder, const ParameterOverrides &overrides, const Kernel &kernel);
+
+    public:
+        /** Writes the Link.csv file of a synthetic topology. **/
+        static void writeTopology(const std::string &fileName, const SyntheticSize &size);
+
+        /** Writes the file of demands of a synthetic instance. **/
+        static void writeDemands(const std::string &fileName, const SyntheticSize &size);
+
+        /** Writes the files of a synthetic instance in a sub-folder of the given folder and returns the sub-folder. **/
+        static std::string generateInstance(const std::string &folder, const SyntheticSize &size);
+
+        /** Writes the parameter file <instanceFolder>/<name>.par of a synthetic instance and returns its name. The 
+         * parameters not set by the overrides or by the instance are the ones of the template. **/
+        static std::string writeParameterFile(const std::string &templateFile, const std::string &instanceFolder, const SyntheticSize &size, const ParameterOverrides &overrides, const std::string &name);
+
+        MicroBenchmark(const std::string &templateFile, const std::string &folder, int repetitions);
+
+        /** Measures every kernel on instances of each size. **/
+        void run(const std::vector<SyntheticSize> &sizes);
+};
+
+#endif
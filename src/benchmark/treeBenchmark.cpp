@@ -0,0 +1,81 @@
+#include "treeBenchmark.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+#include "CbcModel.hpp"
+
+#include "../solver/OsiLagSolverInterface.h"
+#include "../topology/instance.h"
+#include "../tools/clockTime.h"
+#include "../tools/memoryUsage.h"
+
+/****************************************************************************************/
+/*                                     Constructor                                      */
+/****************************************************************************************/
+
+TreeBenchmark::TreeBenchmark(const std::string &t, const std::string &f) : templateFile(t), folder(f){}
+
+/****************************************************************************************/
+/*                                      Measures                                        */
+/****************************************************************************************/
+
+/* The model is built as lagSolverCBC does, without the multiplier store: every run starts from the same multipliers. Only
+the enumeration is measured, not the construction of the first solver interface. */
+void TreeBenchmark::run(const SyntheticSize &size, int nodeLimit, int nodeMethod){
+    std::string instanceFolder = MicroBenchmark::generateInstance(folder, size);
+    ParameterOverrides overrides = {
+        {"solver", std::to_string(Input::MIP_SOLVER_CBC)},
+        {"method", std::to_string(nodeMethod)}
+    };
+    std::string parameterFile = MicroBenchmark::writeParameterFile(templateFile, instanceFolder, size, overrides, "treeBenchmark");
+
+    // the solver interface and CBC are verbose: their output is discarded while they run
+    std::ofstream discard("/dev/null");
+    std::streambuf *console = std::cout.rdbuf(discard.rdbuf());
+    Input input(parameterFile);
+    Instance instance(input);
+    instance.generateDemandsFromFile(input.getDemandToBeRoutedFilesFromIndex(0));
+
+    OsiLagSolverInterface solver(instance);
+    solver.loadModelFormulation();
+    CbcModel model(solver);
+    dynamic_cast<OsiLagSolverInterface*>(model.solver())->setCbcModel(&model);
+    model.setMaximumNodes(nodeLimit);
+
+    int copies = OsiLagSolverInterface::getNbCopies();
+    double copyTime = OsiLagSolverInterface::getCopyTime();
+    int solversBuilt = OsiLagSolverInterface::getNbSolversBuilt();
+    long peakRSS = MemoryUsage::getPeakRSS();
+    ClockTime time(ClockTime::getTimeNow());
+    model.branchAndBound();
+    double seconds = time.getTimeInSecFromStart();
+    long peakIncrease = MemoryUsage::getPeakRSS() - peakRSS;
+    copies = OsiLagSolverInterface::getNbCopies() - copies;
+    copyTime = OsiLagSolverInterface::getCopyTime() - copyTime;
+    solversBuilt = OsiLagSolverInterface::getNbSolversBuilt() - solversBuilt;
+    std::cout.rdbuf(console);
+
+    std::cout << std::setw(6) << "nodes" << std::setw(8) << "slices" << std::setw(8) << "demands" << std::setw(8) << "method";
+    std::cout << std::setw(12) << "tree nodes" << std::setw(12) << "time (s)" << std::setw(10) << "copies" << std::setw(16) << "copy time (s)";
+    std::cout << std::setw(10) << "solvers" << std::setw(20) << "peak memory (kB)" << std::endl;
+    std::cout << std::setw(6) << size.nbNodes << std::setw(8) << size.nbSlices << std::setw(8) << size.nbDemands << std::setw(8) << nodeMethod;
+    std::cout << std::setw(12) << model.getNodeCount() << std::fixed << std::setprecision(6) << std::setw(12) << seconds << std::setw(10) << copies;
+    std::cout << std::setw(16) << copyTime << std::setw(10) << solversBuilt << std::setw(20) << peakIncrease << std::endl;
+
+    std::string fileName = folder + "/treeBenchmark.csv";
+    bool header = !std::ifstream(fileName.c_str()).good();
+    std::ofstream results(fileName.c_str(), std::ios::app);
+    if (!results.is_open()){
+        std::cerr << "ERROR: Unable to open results file '" << fileName << "'." << std::endl;
+        exit(0);
+    }
+    std::string delimiter = ";";
+    if (header){
+        results << "nodes;slices;demands;method;nodeLimit;treeNodes;time;copies;copyTime;solversBuilt;peakRSSIncrease" << std::endl;
+    }
+    results << size.nbNodes << delimiter << size.nbSlices << delimiter << size.nbDemands << delimiter << nodeMethod << delimiter << nodeLimit << delimiter;
+    results << model.getNodeCount() << delimiter << seconds << delimiter << copies << delimiter << copyTime << delimiter << solversBuilt << delimiter << peakIncrease << std::endl;
+}
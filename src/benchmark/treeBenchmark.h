@@ -0,0 +1,31 @@
+#ifndef TREE_BENCHMARK_H
+#define TREE_BENCHMARK_H
+
+#include <string>
+
+#include "microBenchmark.h"
+
+/***********************************************************************************************
+ * Benchmark of the CBC enumeration tree solved with the Lagrangian solver interface. The tree
+ * of a synthetic instance (see MicroBenchmark) is explored up to a number of nodes, with the
+ * Lagrangian method of the given node method. The time of the enumeration, the number of nodes
+ * explored, the copies of the solver interface made by CBC, the time spent copying, the number
+ * of Lagrangian solvers built and the increase of the peak resident memory during the
+ * enumeration are displayed and written to <folder>/treeBenchmark.csv (a line is appended at
+ * each run). The peak resident memory is the one of the process, so a single tree is explored
+ * per run.
+ * ********************************************************************************************/
+class TreeBenchmark {
+
+    private:
+        std::string templateFile;   /**< Parameter file providing the parameters not set by the benchmark. **/
+        std::string folder;         /**< Folder receiving the synthetic instance and the results. **/
+
+    public:
+        TreeBenchmark(const std::string &templateFile, const std::string &folder);
+
+        /** Explores the tree of an instance of the given size. @param nodeLimit The maximum number of nodes explored. @param nodeMethod The Lagrangian method applied at each node. **/
+        void run(const SyntheticSize &size, int nodeLimit, int nodeMethod);
+};
+
+#endif
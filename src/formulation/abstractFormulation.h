@@ -69,6 +69,23 @@ public:
 	/** Clears the set of constraints. **/
 	void clearConstraints(){ constraintSet.clear(); }
 
+	/** Returns the memory (bytes) estimated for a set of constraints. **/
+	static std::size_t getMemory(const std::vector<Constraint> &constraints){
+		std::size_t bytes = MemoryUsage::ofVector(constraints);
+		for (unsigned int i = 0; i < constraints.size(); i++){
+			bytes += constraints[i].getMemory();
+		}
+		return bytes;
+	}
+
+	/** Reports the memory of the constraints and of the cut pool to the telemetry. **/
+	void measureMemory() const {
+		if (Telemetry::isEnabled()){
+			Telemetry::measureMemory(Telemetry::MEMORY_CONSTRAINTS, getMemory(constraintSet));
+			Telemetry::measureMemory(Telemetry::MEMORY_CUT_POOL, getMemory(cutPool));
+		}
+	}
+
 
 	/** Defines the set of constraints. **/
     virtual void setConstraints() = 0;
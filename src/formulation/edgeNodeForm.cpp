@@ -3,11 +3,21 @@
 
 /* Constructor. Builds the Online RSA mixed-integer program and solves it using CPLEX. */
 EdgeNodeForm::EdgeNodeForm(const Instance &inst) : AbstractFormulation(inst){
+    Telemetry::Span formulationSpan("formulation", true);
     std::cout << "--- Edge-Node formulation has been chosen. " << displayDimensions() << " ---" << std::endl;
+    Telemetry::Span variablesSpan("variables");
     this->setVariables();
+    varImpleTime = variablesSpan.stop();
+    Telemetry::Span constraintsSpan("constraints");
     this->setConstraints();
+    constImpleTime = constraintsSpan.stop();
+    cutImpleTime = 0.0;
+    Telemetry::Span objectivesSpan("objectives");
     this->setObjectives();
+    objImpleTime = objectivesSpan.stop();
+    measureMemory();
     std::cout << "--- Edge-Node formulation has been defined ---" << std::endl;
+    totalImpleTime = formulationSpan.stop();
 }
 
 
@@ -309,6 +319,9 @@ void EdgeNodeForm::setConstraints(){
 	setEdgeSlotConstraints();
 	setDemandEdgeSlotConstraints();
     setNonOverlappingConstraints();
+    if (instance.getInput().isSymmetryBreakingActivated()){
+        setSymmetryBreakingConstraints();
+    }
 
     setMaxUsedSlicePerLinkConstraints();
     setMaxUsedSliceOverallConstraints();
@@ -576,6 +589,37 @@ Constraint EdgeNodeForm::getNonOverlappingConstraint_e_s(int e, int s){
     return constraint;
 }
 
+/* Defines Symmetry-Breaking constraints. Ordering the consecutive demands of a class orders the whole class. */
+void EdgeNodeForm::setSymmetryBreakingConstraints(){
+    std::vector< std::vector<int> > classes = getSymmetricDemandClasses();
+    int nbRows = 0;
+    for (unsigned int i = 0; i < classes.size(); i++){
+        for (unsigned int j = 1; j < classes[i].size(); j++){
+            Constraint symmetry = getSymmetryBreakingConstraint_k1_k2(classes[i][j-1], classes[i][j]);
+            constraintSet.push_back(symmetry);
+            nbRows++;
+        }
+    }
+    std::cout << nbRows << " Symmetry-breaking constraints have been defined..." << std::endl;
+}
+
+/* Returns the symmetry-breaking constraint associated with two identical demands: the last slot of k1, given by the z variables, is not higher than the one of k2. */
+Constraint EdgeNodeForm::getSymmetryBreakingConstraint_k1_k2(int k1, int k2){
+    Expression exp;
+    int upperBound = 0;
+    int lowerBound = -getNbSlicesGlobalLimit();
+    for (int s = 0; s < getNbSlicesGlobalLimit(); s++){
+        Term term1(z[s][k1], s+1);
+        exp.addTerm(term1);
+        Term term2(z[s][k2], -(s+1));
+        exp.addTerm(term2);
+    }
+    std::ostringstream constraintName;
+    constraintName << "SymmetryBreaking(" << getToBeRouted_k(k1).getId()+1 << "," << getToBeRouted_k(k2).getId()+1 << ")";
+    Constraint constraint(lowerBound, exp, upperBound, constraintName.str());
+    return constraint;
+}
+
 /****************************************************************************************/
 /*						Objective function related constraints    						*/
 /****************************************************************************************/
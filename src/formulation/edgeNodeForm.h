@@ -110,6 +110,12 @@ public:
 
     /** Returns the non-overlapping constraint associated with an arc and a pair of demands. @param e The edge index. @param s The slice index. **/
     Constraint getNonOverlappingConstraint_e_s(int e, int s);
+
+	/** Defines Symmetry-Breaking constraints. Identical demands are ordered by their last slot. **/
+	void setSymmetryBreakingConstraints();
+
+	/** Returns the constraint stating that a demand does not end on a higher slot than an identical demand after it. @param k1 The first demand index. @param k2 The second demand index. **/
+	Constraint getSymmetryBreakingConstraint_k1_k2(int k1, int k2);
     
 	Constraint getMaxUsedSlicePerLinkConstraints(int k, int e, int s);
 
@@ -1,26 +1,38 @@
 #include "flowForm.h"
 
+std::shared_ptr<QoTCache> FlowForm::qotCache = std::make_shared<QoTCache>();
 
 /* Constructor. Builds the Online RSA mixed-integer program and solves it using a defined solver (CPLEX or CBC). */
 FlowForm::FlowForm(const Instance &inst) : AbstractFormulation(inst){
+    lazyNonOverlap = inst.getInput().isNonOverlapLazy() && !inst.getInput().isRelaxed()
+                        && inst.getInput().getChosenNodeMethod() == Input::NODE_METHOD_LINEAR_RELAX;
     if(inst.getInput().getChosenNodeMethod() == Input::NODE_METHOD_LINEAR_RELAX){
-        ClockTime time(ClockTime::getTimeNow());
-        ClockTime time2(ClockTime::getTimeNow());
+        Telemetry::Span formulationSpan("formulation", true);
         std::cout << "--- Flow formulation has been chosen. " << displayDimensions() << " ---" << std::endl;
+        Telemetry::Span variablesSpan("variables");
         this->setVariables();
-        varImpleTime = time.getTimeInSecFromStart() ;
-        time.setStart(ClockTime::getTimeNow());
+        varImpleTime = variablesSpan.stop();
+        Telemetry::Span constraintsSpan("constraints");
         this->setConstraints();
-        constImpleTime = time.getTimeInSecFromStart() ;
-        time.setStart(ClockTime::getTimeNow());
+        constImpleTime = constraintsSpan.stop();
+        Telemetry::Span cutsSpan("cuts");
         this->setCutPool();
-        cutImpleTime = time.getTimeInSecFromStart() ;
-        time.setStart(ClockTime::getTimeNow());
+        cutImpleTime = cutsSpan.stop();
+        Telemetry::Span objectivesSpan("objectives");
         this->setObjectives();
-        objImpleTime = time.getTimeInSecFromStart() ;
+        objImpleTime = objectivesSpan.stop();
+        measureMemory();
         std::cout << "--- Flow formulation has been defined ---" << std::endl;
-        totalImpleTime = time2.getTimeInSecFromStart() ;
-        //std::cout << "Time: " << time.getTimeInSecFromStart() << std::endl;
+        totalImpleTime = formulationSpan.stop();
+    }
+    if (inst.getInput().isGNPYEnabled()){
+        qotEvaluatorFactory factory;
+        qotEvaluator = std::shared_ptr<AbstractQoTEvaluator>(factory.createEvaluator(inst.getInput()));
+        std::string cacheFile = inst.getInput().getGNPYCacheFile();
+        if (!cacheFile.empty() && !qotCache->isOpen()){
+            std::string signature = std::to_string(inst.getInput().getGNPYEvaluator()) + " " + inst.getInput().getGNPYTopologyFile() + " " + inst.getInput().getGNPYEquipmentFile();
+            qotCache->open(cacheFile, signature);
+        }
     }
 }
 
@@ -205,9 +217,10 @@ Expression FlowForm::getObjFunctionFromMetric(Input::ObjectiveMetric chosenObjec
     case Input::OBJECTIVE_METRIC_1:
         {
         for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+            const std::vector<double> &coeffs = getCoeffArray(chosenObjective, d);
             for (ListDigraph::ArcIt a(*vecGraph[d]); a != INVALID; ++a){
                 int arc = getArcIndex(a, d);
-                double coeff = getCoeffObj1(a, d);
+                double coeff = coeffs[arc];
                 Term term(x[d][arc], coeff);
                 obj.addTerm2(term);
             }
@@ -225,9 +238,10 @@ Expression FlowForm::getObjFunctionFromMetric(Input::ObjectiveMetric chosenObjec
     case Input::OBJECTIVE_METRIC_2:
         {
         for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+            const std::vector<double> &coeffs = getCoeffArray(chosenObjective, d);
             for (ListDigraph::ArcIt a(*vecGraph[d]); a != INVALID; ++a){
                 int arc = getArcIndex(a, d);
-                double coeff = getCoeffObj2(a, d);
+                double coeff = coeffs[arc];
                 Term term(x[d][arc], coeff);
                 obj.addTerm2(term);
             }
@@ -237,9 +251,10 @@ Expression FlowForm::getObjFunctionFromMetric(Input::ObjectiveMetric chosenObjec
     case Input::OBJECTIVE_METRIC_2p:
         {
         for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+            const std::vector<double> &coeffs = getCoeffArray(chosenObjective, d);
             for (ListDigraph::ArcIt a(*vecGraph[d]); a != INVALID; ++a){
                 int arc = getArcIndex(a, d);
-                double coeff = getCoeffObj2p(a, d);
+                double coeff = coeffs[arc];
                 Term term(x[d][arc], coeff);
                 obj.addTerm2(term);
             }
@@ -249,9 +264,10 @@ Expression FlowForm::getObjFunctionFromMetric(Input::ObjectiveMetric chosenObjec
     case Input::OBJECTIVE_METRIC_4:
         {
         for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+            const std::vector<double> &coeffs = getCoeffArray(chosenObjective, d);
             for (ListDigraph::ArcIt a(*vecGraph[d]); a != INVALID; ++a){
                 int arc = getArcIndex(a, d);
-                double coeff = getCoeffObj4(a, d);
+                double coeff = coeffs[arc];
                 Term term(x[d][arc], coeff);
                 obj.addTerm2(term);
             }
@@ -285,6 +301,9 @@ void FlowForm::setConstraints(){
     //this->setLengthConstraints();
     this->setStrongLengthConstraints();
     this->setNonOverlappingConstraints();    
+    if (instance.getInput().isSymmetryBreakingActivated()){
+        this->setSymmetryBreakingConstraints();
+    }
 
     this->setMaxUsedSlicePerLinkConstraints();    
     this->setMaxUsedSliceOverallConstraints();    
@@ -495,16 +514,56 @@ Constraint FlowForm::getLengthConstraint(const Demand &demand, int d){
 }
 
 /* Defines the second set of Improved Non-Overlapping constraints. */
+/* In lazy mode, a constraint can only be violated on a slice that at least two demands can use. Among those slices, the lowest ones of each link are seeded, as many as the demands able to use the link could fill side by side, since the objectives push the demands down the spectrum. */
 void FlowForm::setNonOverlappingConstraints(){
+    int nbRows = 0;
+    sliceLimitOfLink.clear();
     for (int i = 0; i < instance.getNbEdges(); i++){
         //int sliceLimit = getNbSlicesLimitFromEdge(i);
         int sliceLimit = auxNbSlicesLimitFromEdge[i];
-        for (int s = 0; s < sliceLimit; s++){
-            const Constraint & nonOverlap = getNonOverlappingConstraint(instance.getPhysicalLinkFromIndex(i).getId(), s);
-            constraintSet.push_back(nonOverlap);
+        int linkLabel = instance.getPhysicalLinkFromIndex(i).getId();
+        if (linkLabel >= (int)sliceLimitOfLink.size()){
+            sliceLimitOfLink.resize(linkLabel + 1, 0);
         }
+        sliceLimitOfLink[linkLabel] = sliceLimit;
+        int seedDepth = sliceLimit;
+        std::vector<int> nbDemandsOnSlice(sliceLimit, 2);
+        if (lazyNonOverlap){
+            seedDepth = 0;
+            nbDemandsOnSlice.assign(sliceLimit, 0);
+            for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+                int demandLoad = getToBeRouted_k(d).getLoad();
+                std::vector<bool> covered(sliceLimit, false);
+                bool usesLink = false;
+                for(IterableIntMap< ListDigraph, ListDigraph::Arc >::ItemIt a((*mapItArcLabel[d]),linkLabel); a != INVALID; ++a){
+                    usesLink = true;
+                    for (int s = std::max(0, getArcSlice(a, d) - demandLoad + 1); s <= std::min(getArcSlice(a, d), sliceLimit - 1); s++){
+                        covered[s] = true;
+                    }
+                }
+                if (usesLink){
+                    seedDepth += demandLoad;
+                    for (int s = 0; s < sliceLimit; s++){
+                        nbDemandsOnSlice[s] += covered[s];
+                    }
+                }
+            }
+        }
+        for (int s = 0; s < sliceLimit && seedDepth > 0; s++){
+            if (nbDemandsOnSlice[s] >= 2){
+                const Constraint & nonOverlap = getNonOverlappingConstraint(linkLabel, s);
+                constraintSet.push_back(nonOverlap);
+                nbRows++;
+                seedDepth--;
+            }
+        }
+    }
+    if (lazyNonOverlap){
+        std::cout << nbRows << " Non-Overlapping constraints have been seeded, the others are lazy..." << std::endl;
+    }
+    else{
+        std::cout << "Non-Overlapping constraints has been defined..." << std::endl;
     }
-    std::cout << "Non-Overlapping constraints has been defined..." << std::endl;
 }
 
 /* Returns the non-overlapping constraint associated with an edge and a slice */
@@ -543,6 +602,42 @@ Constraint FlowForm::getNonOverlappingConstraint(int linkLabel, int slice){
     return constraint;
 }
 
+/* Defines Symmetry-Breaking constraints. Each class of identical demands is ordered as a chain. */
+void FlowForm::setSymmetryBreakingConstraints(){
+    std::vector< std::vector<int> > classes = getSymmetricDemandClasses();
+    int nbRows = 0;
+    for (unsigned int i = 0; i < classes.size(); i++){
+        for (unsigned int j = 1; j < classes[i].size(); j++){
+            const Constraint & symmetry = getSymmetryBreakingConstraint(classes[i][j-1], classes[i][j]);
+            constraintSet.push_back(symmetry);
+            nbRows++;
+        }
+    }
+    std::cout << nbRows << " Symmetry-Breaking constraints have been defined..." << std::endl;
+}
+
+/* Exactly one arc leaves the source of a demand, and all the arcs of its path lie on the slice of that arc, so the last slice of the demand is the slice-weighted flow leaving its source. */
+Constraint FlowForm::getSymmetryBreakingConstraint(int d1, int d2){
+    Expression exp;
+    int demands[2] = {d1, d2};
+    for (int i = 0; i < 2; i++){
+        int d = demands[i];
+        int sourceLabel = getToBeRouted_k(d).getSource();
+        for(IterableIntMap< ListDigraph, ListDigraph::Node >::ItemIt v((*mapItNodeLabel[d]), sourceLabel); v != INVALID; ++v){
+            for (ListDigraph::OutArcIt a((*vecGraph[d]), v); a != INVALID; ++a){
+                int arc = getArcIndex(a, d);
+                double coefficient = (i == 0) ? (getArcSlice(a, d) + 1) : -(getArcSlice(a, d) + 1);
+                Term term(x[d][arc], coefficient);
+                exp.addTerm(term);
+            }
+        }
+    }
+    std::ostringstream constraintName;
+    constraintName << "Symmetry_" << getToBeRouted_k(d1).getId()+1 << "_" << getToBeRouted_k(d2).getId()+1;
+    Constraint constraint(-getNbSlicesGlobalLimit(), exp, 0, constraintName.str());
+    return constraint;
+}
+
 /****************************************************************************************/
 /*						Objective function related constraints    						*/
 /****************************************************************************************/
@@ -958,9 +1053,37 @@ std::vector<Variable> FlowForm::objective8_fixing(const double upperBound){
     return vars;
 }
 
+/* The slices covered by the arcs of positive value are accumulated on each link, and the constraint of each slice used more than once is returned. Fractional points are separated the same way. */
 std::vector<Constraint> FlowForm::solveSeparationProblemInt(const std::vector<double> &solution, const int threadNo){
-    //std::cout << "Entering separation problem of a fractional point for Flow Form." << std::endl;
-    return std::vector<Constraint>();
+    std::vector<Constraint> cuts;
+    if (!lazyNonOverlap){
+        return cuts;
+    }
+    std::vector< std::vector<double> > usage(sliceLimitOfLink.size());
+    for (unsigned int label = 0; label < sliceLimitOfLink.size(); label++){
+        usage[label].assign(sliceLimitOfLink[label], 0.0);
+    }
+    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+        int demandLoad = getToBeRouted_k(d).getLoad();
+        for (ListDigraph::ArcIt a(*vecGraph[d]); a != INVALID; ++a){
+            double value = solution[x[d][getArcIndex(a, d)].getId()];
+            if (value > EPS){
+                std::vector<double> &linkUsage = usage[getArcLabel(a, d)];
+                int lastSlice = std::min(getArcSlice(a, d), (int)linkUsage.size() - 1);
+                for (int s = std::max(0, getArcSlice(a, d) - demandLoad + 1); s <= lastSlice; s++){
+                    linkUsage[s] += value;
+                }
+            }
+        }
+    }
+    for (unsigned int label = 0; label < usage.size(); label++){
+        for (unsigned int s = 0; s < usage[label].size(); s++){
+            if (usage[label][s] > 1 + EPS){
+                cuts.push_back(getNonOverlappingConstraint(label, s));
+            }
+        }
+    }
+    return cuts;
 }
 
 std::vector<Constraint> FlowForm::solveSeparationProblemFract(const std::vector<double> &solution){
@@ -981,36 +1104,40 @@ std::vector<Constraint> FlowForm::solveSeparationProblemFract(const std::vector<
 std::vector<Constraint> FlowForm::solveSeparationGnpy(const std::vector<double> &solution, const int threadNo){
     std::vector<Constraint> cuts;
     setVariableValues(solution);
-    
-    // write service.json file
-    std::string serviceFile = instance.getInput().getOutputPath() + "service_" + std::to_string(threadNo) + ".json";
-    writeServiceFile(serviceFile);
-
-    // launch GNPY
-    std::string resultFile = instance.getInput().getOutputPath() + "result_" + std::to_string(threadNo) + ".json";
-    std::string arguments = instance.getInput().getGNPYTopologyFile() + " " + serviceFile;
-    std::string options = "-e " + instance.getInput().getGNPYEquipmentFile() + " -o " + resultFile;
-    std::string command = "gnpy-path-request " + arguments + " " + options;
-    system(command.c_str());
-
-    // read result.json file
-    std::ifstream ifs(resultFile.c_str());
-    std::string fileContent((std::istreambuf_iterator<char>(ifs)), (std::istreambuf_iterator<char>()));
+
+    /* Look for each path in the cache and gather the misses in one batch. */
+    std::vector<QoTResult> results(getNbDemandsToBeRouted());
+    std::vector<QoTRequest> requests(getNbDemandsToBeRouted());
+    std::vector<QoTRequest> misses;
+    std::vector<int> missIndex(getNbDemandsToBeRouted(), -1);
+    std::unordered_map<std::string, int> missKeys;
     for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        std::string requestContent;
-        std::string firstDelimiter = "Demand " + std::to_string(getToBeRouted_k(d).getId()+1);
-        std::size_t first = fileContent.find(firstDelimiter);
-        if (d < getNbDemandsToBeRouted() - 1){
-            std::string lastDelimiter = "Demand " + std::to_string(getToBeRouted_k(d).getId()+2);
-            std::size_t last = fileContent.find(lastDelimiter);
-            requestContent = fileContent.substr(first, last-first);
+        requests[d] = getQoTRequest(d);
+        if (!qotCache->get(requests[d], results[d])){
+            std::string key = QoTCache::getKey(requests[d]);
+            std::unordered_map<std::string, int>::const_iterator it = missKeys.find(key);
+            if (it == missKeys.end()){
+                missKeys[key] = (int)misses.size();
+                misses.push_back(requests[d]);
+            }
+            missIndex[d] = missKeys[key];
         }
-        else{
-            requestContent = fileContent.substr(first);
+    }
+    if (!misses.empty()){
+        std::vector<QoTResult> evaluated = qotEvaluator->evaluate(misses, threadNo);
+        for (unsigned int i = 0; i < misses.size(); i++){
+            qotCache->set(misses[i], evaluated[i]);
         }
-
-        std::size_t found = requestContent.find("no-path");
-        if (found != std::string::npos){
+        for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+            if (missIndex[d] >= 0){
+                results[d] = evaluated[missIndex[d]];
+                results[d].demandId = requests[d].demandId;
+            }
+        }
+    }
+    std::cout << "QoT cache: " << qotCache->getNbHits() << " hits, " << qotCache->getNbMisses() << " misses, " << misses.size() << " paths evaluated." << std::endl;
+    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+        if (!results[d].feasible){
             std::cout << "Demand " << std::to_string(getToBeRouted_k(d).getId()+1) << ": Unfeasible." << std::endl;
             cuts.push_back(getPathEliminationConstraint(d));
         }
@@ -1044,76 +1171,19 @@ Constraint FlowForm::getPathEliminationConstraint(int d){
     return Constraint(0, exp, rhs, constraintName.str());
 }
 
-void FlowForm::writeServiceFile(const std::string &file){
-    std::ofstream serviceFile;
-    serviceFile.open (file.c_str());
-    serviceFile << "{\n";
-    
-    serviceFile << "\t\"path-request\": [\n";
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        writePathRequest(serviceFile, d);
-    }
-    
-    serviceFile << "\t],\n";
-    serviceFile << "\t\"synchronization\": [\n";
-    serviceFile << "\t]\n";
-    serviceFile << "}\n";
-}
-
-void FlowForm::writePathRequest(std::ofstream &serviceFile, int d){
-    std::string source = std::to_string(getToBeRouted_k(d).getSource()+1) + ".1";
-    std::string destination = std::to_string(getToBeRouted_k(d).getTarget()+1) + ".1";
-    std::vector<int> path = getPathNodeSequence(d);
-    serviceFile << "\t{\n";
-    serviceFile << "\t\t" << "\"request-id\": \"Demand " << std::to_string(getToBeRouted_k(d).getId()+1) << "\",\n";
-    serviceFile << "\t\t" << "\"source\": \"" << source << "\",\n";
-    serviceFile << "\t\t" << "\"destination\": \"" << destination << "\",\n";
-    serviceFile << "\t\t" << "\"src-tp-id\": \"" << source << "\",\n";
-    serviceFile << "\t\t" << "\"dst-tp-id\": \"" << destination << "\",\n";
-    serviceFile << "\t\t" << "\"bidirectional\": false,\n";
-    serviceFile << "\t\t" << "\"path-constraints\": {\n";
-    serviceFile << "\t\t\t" << "\"te-bandwidth\": {\n";
-    serviceFile << "\t\t\t\t" << "\"technology\": \"flexi-grid\",\n";
-    serviceFile << "\t\t\t\t" << "\"trx_type\": \"Voyager\",\n";
-    serviceFile << "\t\t\t\t" << "\"trx_mode\": \"" << getToBeRouted_k(d).getMode() << "\",\n";
-    serviceFile << "\t\t\t\t" << "\"effective-freq-slot\": [\n";
-    serviceFile << "\t\t\t\t\t" << "{\n";
-    serviceFile << "\t\t\t\t\t\t" << "\"N\": \"null\",\n";
-    serviceFile << "\t\t\t\t\t\t" << "\"M\": \"null\"\n";
-    serviceFile << "\t\t\t\t\t" << "}\n";
-    serviceFile << "\t\t\t\t" << "],\n";
-    serviceFile << "\t\t\t\t" << "\"spacing\":" << getToBeRouted_k(d).getSpacing() << ",\n";
-    serviceFile << "\t\t\t\t" << "\"max-nb-of-channel\": null,\n";
-    serviceFile << "\t\t\t\t" << "\"output-power\": null,\n";
-    serviceFile << "\t\t\t\t" << "\"path_bandwidth\": " << getToBeRouted_k(d).getPathBandwidth() << "\n";
-    serviceFile << "\t\t\t" << "}\n";
-    serviceFile << "\t\t" << "},\n";
-    serviceFile << "\t\t" << "\"explicit-route-objects\": {\n";
-    serviceFile << "\t\t\t" << "\"route-object-include-exclude\": [\n";
-    for (unsigned int i = 0; i < path.size(); i++){
-        serviceFile << "\t\t\t\t" << "{\n";
-        serviceFile << "\t\t\t\t\t" << "\"explicit-route-usage\": \"route-include-ero\",\n";
-        serviceFile << "\t\t\t\t\t" << "\"index\": " << std::to_string(i) << ",\n";
-        serviceFile << "\t\t\t\t\t" << "\"num-unnum-hop\": {\n";
-        serviceFile << "\t\t\t\t\t\t" << "\"node-id\": \"" << std::to_string(path[i]+1) << "\",\n";
-        serviceFile << "\t\t\t\t\t\t" << "\"link-tp-id\": \"link-tp-id is not used\",\n";
-        serviceFile << "\t\t\t\t\t\t" << "\"hop-type\": \"STRICT\"\n";
-        serviceFile << "\t\t\t\t\t" << "}\n";
-        if (i < path.size()-1){
-            serviceFile << "\t\t\t\t" << "},\n";
-        }
-        else{
-            serviceFile << "\t\t\t\t" << "}\n";
-        }
-    }
-    serviceFile << "\t\t\t" << "]\n";
-    serviceFile << "\t\t" << "}\n";
-    if (d < getNbDemandsToBeRouted()-1){
-        serviceFile << "\t" << "},\n";
-    }
-    else{
-        serviceFile << "\t" << "}\n";
+QoTRequest FlowForm::getQoTRequest(int d){
+    QoTRequest request;
+    request.demandId = getToBeRouted_k(d).getId();
+    request.source = getToBeRouted_k(d).getSource();
+    request.target = getToBeRouted_k(d).getTarget();
+    request.nodes = getPathNodeSequence(d);
+    for (unsigned int i = 0; i+1 < request.nodes.size(); i++){
+        request.linkLengths.push_back(instance.getPhysicalLinkBetween(request.nodes[i], request.nodes[i+1]).getLength());
     }
+    request.mode = getToBeRouted_k(d).getMode();
+    request.spacing = getToBeRouted_k(d).getSpacing();
+    request.pathBandwidth = getToBeRouted_k(d).getPathBandwidth();
+    return request;
 }
 
 /********************************** Lagrangian Inclusion ********************************/
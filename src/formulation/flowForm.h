@@ -1,7 +1,11 @@
 #ifndef __FlowForm__h
 #define __FlowForm__h
 
+#include <memory>
+
 #include "abstractFormulation.h"
+#include "../qot/qotEvaluatorFactory.h"
+#include "../qot/qotCache.h"
 
 typedef std::vector<Variable> VarArray;
 typedef std::vector<VarArray> VarMatrix;
@@ -18,6 +22,10 @@ private:
     VarMatrix x;				    /**< The matrix of assignement variables used in the MIP. x[d][a]=1 if the d-th demand is routed through the arc from index a. **/
     VarArray maxSlicePerLink;	    /**< The array of variables used in the MIP for verifying the max used slice position for each link in the topology network. maxSlicePerLink[i]=p if p is the max used slice position from the link with id i. **/
 	Variable maxSliceOverall;		/**< The max used slice position throughout all the network. **/
+	std::shared_ptr<AbstractQoTEvaluator> qotEvaluator;	/**< Evaluates the QoT of the paths of integer solutions (only if GNPY is enabled). **/
+	static std::shared_ptr<QoTCache> qotCache;			/**< QoT evaluations kept from one candidate and one optimization to the next. **/
+	bool lazyNonOverlap;				/**< If only a subset of the non-overlapping constraints is defined, the others being separated on the solutions. **/
+	std::vector<int> sliceLimitOfLink;	/**< Number of slices with a non-overlapping constraint on each link, by link label. **/
 
 public:
 	/****************************************************************************************/
@@ -78,8 +86,11 @@ public:
 	/** Defines Length constraints. Demands must be routed within a length limit. **/
     void setLengthConstraints();
 
-	/** Defines Non-Overlapping constraints. Demands must not overlap eachother's slices. **/
+	/** Defines Non-Overlapping constraints. Demands must not overlap eachother's slices. In lazy mode, only the constraints likely to be binding are defined. **/
     void setNonOverlappingConstraints();
+
+	/** Returns if only a subset of the non-overlapping constraints is defined, the others being separated on the solutions. **/
+	bool isNonOverlapLazy() const { return lazyNonOverlap; }
 	
 	/** Returns the source constraint associated with a demand and a node. @param demand The demand. @param d The demand index. @param nodeLabel The node label. **/
     Constraint getSourceConstraint_d_n(const Demand & demand, int d, int nodeLabel);
@@ -95,6 +106,12 @@ public:
 
 	/** Returns the non-overlapping constraint associated with an edge and a slice. @param linkLabel The arc label. @param slice The arc slice. **/
 	Constraint getNonOverlappingConstraint(int linkLabel, int slice);
+
+	/** Defines Symmetry-Breaking constraints. Identical demands are ordered by their last slice. **/
+	void setSymmetryBreakingConstraints();
+
+	/** Returns the constraint stating that a demand does not end on a higher slice than an identical demand after it. @param d1 The first demand index. @param d2 The second demand index. **/
+	Constraint getSymmetryBreakingConstraint(int d1, int d2);
 	
 
 	//---------------------------------- New constraints ---------------------------------- //
@@ -143,8 +160,10 @@ public:
 
     std::vector<Constraint> solveSeparationProblemFract(const std::vector<double> &solution) override;
 	
+	/** Returns the non-overlapping constraints violated by a solution (none if they are all defined). The solution is only read, so that several points can be separated at once. **/
 	std::vector<Constraint> solveSeparationProblemInt(const std::vector<double> &solution, const int threadNo) override;
 
+	/** Evaluates the QoT of the paths of an integer solution and returns the constraints rejecting the infeasible ones. Only the paths missing from the cache are sent to the evaluator, in a single batch. **/
 	std::vector<Constraint> solveSeparationGnpy(const std::vector<double> &value, const int threadNo);
 
 	/** Defines the pool of cuts. **/
@@ -174,9 +193,8 @@ public:
 	/** Recovers the obtained MIP solution and builds a path for each demand on its associated graph from RSA. **/
     void updatePath(const std::vector<double> &vals) override;
 
-	void writeServiceFile(const std::string &file);
-
-	void writePathRequest(std::ofstream &serviceFile, int d);
+	/** Returns the lightpath of the d-th demand in the current solution, as given to the QoT evaluator. **/
+	QoTRequest getQoTRequest(int d);
 
 	/** Returns a vector of node id's corresponding to the sequence of nodes that the d-th demand passes through. **/
 	std::vector<int> getPathNodeSequence(int d);
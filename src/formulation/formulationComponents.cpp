@@ -84,6 +84,14 @@ std::string Expression::to_string() const {
     return exp;
 }
 
+std::size_t Expression::getMemory() const{
+	std::size_t bytes = MemoryUsage::ofVector(termsArray);
+	for (unsigned int i = 0; i < termsArray.size(); i++){
+		bytes += MemoryUsage::ofString(termsArray[i].getVar().getName());
+	}
+	return bytes;
+}
+
 void Constraint::display(){
     int size = this->getExpression().getNbTerms();
     std::cout << this->getLb() << " <= " << std::endl;
@@ -2,6 +2,7 @@
 #define __FormulationComponents__h
 
 #include "../topology/input.h"
+#include "../tools/memoryUsage.h"
 
 #include <string>
 #include <vector>
@@ -143,6 +144,9 @@ public:
 
 	/** Returns the number of terms in the expression. **/
 	int getNbTerms() const { return termsArray.size(); }
+
+	/** Returns the memory (bytes) allocated by the expression: its terms and the names of their variables. **/
+	std::size_t getMemory() const;
 	/****************************************************************************************/
 	/*										Setters											*/
 	/****************************************************************************************/
@@ -268,6 +272,9 @@ public:
 
 	/** Returns the number of terms in the constraint expression. **/
     int getSize() const { return this->expr.getNbTerms(); }
+
+	/** Returns the memory (bytes) allocated by the constraint: its expression and its name. **/
+	std::size_t getMemory() const { return expr.getMemory() + MemoryUsage::ofString(name); }
 	
 	/****************************************************************************************/
 	/*										Setters											*/
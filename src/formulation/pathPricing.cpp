@@ -0,0 +1,224 @@
+#include "pathPricing.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <functional>
+#include <queue>
+#include <thread>
+
+/****************************************************************************************/
+/*										Constructor										*/
+/****************************************************************************************/
+
+/* Constructor. Builds and preprocesses the extended graphs (see RSA) and flattens them. */
+PathPricing::PathPricing(const Instance &inst) : RSA(inst){
+    Telemetry::Span flattenSpan("flatten");
+    pricingGraphs.resize(getNbDemandsToBeRouted());
+    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+        buildPricingGraph(d);
+    }
+    flattenSpan.stop();
+    std::cout << "Pricing graphs have been defined..." << std::endl;
+}
+
+/* The out-arcs are sorted by tail through a counting pass. The reach to the target is given by Dijkstra's algorithm on the reversed arcs. */
+void PathPricing::buildPricingGraph(int d){
+    PricingGraph &g = pricingGraphs[d];
+    const ListDigraph &graph = *vecGraph[d];
+    int nbNodes = countNodes(graph);
+    int nbArcs = countArcs(graph);
+    ListDigraph::Node source = getFirstNodeFromLabel(d, getToBeRouted_k(d).getSource());
+    ListDigraph::Node target = getFirstNodeFromLabel(d, getToBeRouted_k(d).getTarget());
+    g.source = (source != INVALID) ? getNodeIndex(source, d) : -1;
+    g.target = (target != INVALID) ? getNodeIndex(target, d) : -1;
+
+    g.firstOut.assign(nbNodes + 1, 0);
+    g.outArc.resize(nbArcs);
+    g.arcId.resize(nbArcs);
+    g.head.resize(nbArcs);
+    g.label.resize(nbArcs);
+    g.slice.resize(nbArcs);
+    g.cost.resize(nbArcs);
+    g.reach.resize(nbArcs);
+    std::vector<int> tail(nbArcs);
+    const std::vector<double> &coeffs = getCoeffArray(instance.getInput().getChosenObj_k(0), d);
+    for (ListDigraph::ArcIt a(graph); a != INVALID; ++a){
+        int arc = getArcIndex(a, d);
+        tail[arc] = getNodeIndex(graph.source(a), d);
+        g.arcId[arc] = graph.id(a);
+        g.head[arc] = getNodeIndex(graph.target(a), d);
+        g.label[arc] = getArcLabel(a, d);
+        g.slice[arc] = getArcSlice(a, d);
+        g.cost[arc] = coeffs[arc];
+        g.reach[arc] = getArcLengthWithPenalties(a, d);
+        g.firstOut[tail[arc] + 1]++;
+    }
+    for (int v = 0; v < nbNodes; v++){
+        g.firstOut[v + 1] += g.firstOut[v];
+    }
+    std::vector<int> position(g.firstOut.begin(), g.firstOut.end() - 1);
+    for (int arc = 0; arc < nbArcs; arc++){
+        g.outArc[position[tail[arc]]++] = arc;
+    }
+
+    g.reachToTarget.assign(nbNodes, DBL_MAX);
+    if (g.target == -1){
+        return;
+    }
+    std::vector<int> firstIn(nbNodes + 1, 0);
+    std::vector<int> inArc(nbArcs);
+    for (int arc = 0; arc < nbArcs; arc++){
+        firstIn[g.head[arc] + 1]++;
+    }
+    for (int v = 0; v < nbNodes; v++){
+        firstIn[v + 1] += firstIn[v];
+    }
+    position.assign(firstIn.begin(), firstIn.end() - 1);
+    for (int arc = 0; arc < nbArcs; arc++){
+        inArc[position[g.head[arc]]++] = arc;
+    }
+    std::priority_queue< std::pair<double,int>, std::vector< std::pair<double,int> >, std::greater< std::pair<double,int> > > heap;
+    g.reachToTarget[g.target] = 0.0;
+    heap.push(std::make_pair(0.0, g.target));
+    while (!heap.empty()){
+        double distance = heap.top().first;
+        int v = heap.top().second;
+        heap.pop();
+        if (distance > g.reachToTarget[v]){
+            continue;
+        }
+        for (int i = firstIn[v]; i < firstIn[v + 1]; i++){
+            int arc = inArc[i];
+            int u = tail[arc];
+            if (distance + g.reach[arc] < g.reachToTarget[u]){
+                g.reachToTarget[u] = distance + g.reach[arc];
+                heap.push(std::make_pair(g.reachToTarget[u], u));
+            }
+        }
+    }
+}
+
+/****************************************************************************************/
+/*										Methods											*/
+/****************************************************************************************/
+
+/* Returns if the objective can be priced on paths, i.e., if its coefficients are additive over the arcs. */
+bool PathPricing::isPriceable(Input::ObjectiveMetric objective){
+    return (objective == Input::OBJECTIVE_METRIC_0 || objective == Input::OBJECTIVE_METRIC_1 || objective == Input::OBJECTIVE_METRIC_2
+            || objective == Input::OBJECTIVE_METRIC_2p || objective == Input::OBJECTIVE_METRIC_4);
+}
+
+/* A path visits each node label at most once, hence has at most nbNodes-1 arcs. */
+double PathPricing::getMaxColumnCost(int d) const{
+    double maxCost = 0.0;
+    for (unsigned int arc = 0; arc < pricingGraphs[d].cost.size(); arc++){
+        maxCost = std::max(maxCost, pricingGraphs[d].cost[arc]);
+    }
+    return maxCost*std::max(1, instance.getNbNodes() - 1);
+}
+
+/* Label-setting algorithm: labels are extended by increasing reduced cost, and a label is dropped if a label of lower cost was already settled at its node with a smaller length, or if the target is out of reach. The duals of the non-overlapping rows are non-positive, so arc reduced costs are non-negative and the first label to reach the target is optimal. */
+bool PathPricing::price(int d, const std::vector< std::vector<double> > &linkDuals, double demandDual, PathColumn &column) const{
+    struct Label {
+        int node;
+        int pred;
+        int arc;
+        double cost;
+        double length;
+    };
+    const PricingGraph &g = pricingGraphs[d];
+    if (g.source == -1 || g.target == -1){
+        return false;
+    }
+    int load = getToBeRouted_k(d).getLoad();
+    double maxLength = getToBeRouted_k(d).getMaxLength();
+    std::vector<Label> labels;
+    std::vector<double> settledLength(g.reachToTarget.size(), DBL_MAX);
+    std::priority_queue< std::pair<double,int>, std::vector< std::pair<double,int> >, std::greater< std::pair<double,int> > > heap;
+    Label first = {g.source, -1, -1, 0.0, 0.0};
+    labels.push_back(first);
+    heap.push(std::make_pair(0.0, 0));
+    while (!heap.empty()){
+        int l = heap.top().second;
+        heap.pop();
+        Label current = labels[l];
+        if (current.length >= settledLength[current.node]){
+            continue;
+        }
+        settledLength[current.node] = current.length;
+        if (current.node == g.target){
+            column.demand = d;
+            column.arcs.clear();
+            column.edges.clear();
+            column.cost = 0.0;
+            for (int i = l; labels[i].pred != -1; i = labels[i].pred){
+                column.arcs.push_back(labels[i].arc);
+            }
+            std::reverse(column.arcs.begin(), column.arcs.end());
+            for (unsigned int i = 0; i < column.arcs.size(); i++){
+                column.edges.push_back(g.label[column.arcs[i]]);
+                column.cost += g.cost[column.arcs[i]];
+            }
+            column.slice = g.slice[column.arcs.front()];
+            column.reducedCost = current.cost - demandDual;
+            return true;
+        }
+        for (int i = g.firstOut[current.node]; i < g.firstOut[current.node + 1]; i++){
+            int arc = g.outArc[i];
+            int v = g.head[arc];
+            double length = current.length + g.reach[arc];
+            if (length >= settledLength[v] || length + g.reachToTarget[v] >= maxLength + DBL_EPSILON){
+                continue;
+            }
+            double cost = current.cost + g.cost[arc];
+            const std::vector<double> &duals = linkDuals[g.label[arc]];
+            for (int s = std::max(0, g.slice[arc] - load + 1); s <= g.slice[arc]; s++){
+                cost -= std::min(0.0, duals[s]);
+            }
+            Label next = {v, l, arc, cost, length};
+            labels.push_back(next);
+            heap.push(std::make_pair(cost, (int)labels.size() - 1));
+        }
+    }
+    return false;
+}
+
+/* Demands are handed out one at a time, as the pricing times vary with the size of their graphs. */
+std::vector<bool> PathPricing::priceAll(const std::vector< std::vector<double> > &linkDuals, const std::vector<double> &demandDuals, std::vector<PathColumn> &columns) const{
+    int nbDemands = getNbDemandsToBeRouted();
+    std::vector<char> found(nbDemands, 0);
+    columns.resize(nbDemands);
+    std::atomic<int> nextDemand(0);
+    std::function<void()> worker = [&](){
+        for (int d = nextDemand++; d < nbDemands; d = nextDemand++){
+            found[d] = price(d, linkDuals, demandDuals[d], columns[d]);
+        }
+    };
+    int nbThreads = std::max(1, std::min((int)std::thread::hardware_concurrency(), nbDemands));
+    std::vector<std::thread> threads;
+    for (int t = 1; t < nbThreads; t++){
+        threads.push_back(std::thread(worker));
+    }
+    worker();
+    for (unsigned int t = 0; t < threads.size(); t++){
+        threads[t].join();
+    }
+    return std::vector<bool>(found.begin(), found.end());
+}
+
+/* Stores the chosen column of each demand as its path (see RSA::updateInstance). */
+void PathPricing::setPaths(const std::vector<PathColumn> &chosen){
+    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+        for (ListDigraph::ArcIt a(*vecGraph[d]); a != INVALID; ++a){
+            (*vecOnPath[d])[a] = -1;
+        }
+    }
+    for (unsigned int i = 0; i < chosen.size(); i++){
+        int d = chosen[i].demand;
+        for (unsigned int j = 0; j < chosen[i].arcs.size(); j++){
+            ListDigraph::Arc a = (*vecGraph[d]).arcFromId(pricingGraphs[d].arcId[chosen[i].arcs[j]]);
+            (*vecOnPath[d])[a] = getToBeRouted_k(d).getId();
+        }
+    }
+}
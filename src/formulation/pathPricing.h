@@ -0,0 +1,79 @@
+#ifndef __PathPricing__h
+#define __PathPricing__h
+
+#include <vector>
+
+#include "rsa.h"
+
+/** A column of the path master problem: a path of the extended graph of a demand. Since the arcs of a path lie in one slice layer, it routes the demand on the window of its fibers ending at that slice. **/
+struct PathColumn {
+    int demand;                 /**< Index of the demand in the batch. **/
+    int slice;                  /**< Last slice of the window. **/
+    std::vector<int> arcs;      /**< Indices of the arcs of the path in the preprocessed graph, from source to target. **/
+    std::vector<int> edges;     /**< Labels of the fibers crossed. **/
+    double cost;                /**< Coefficient of the column in the objective. **/
+    double reducedCost;         /**< Reduced cost of the column, convexity dual included, when it was priced. **/
+};
+
+/*********************************************************************************************
+* This class implements the pricing problem of the path-based column generation. Each column
+* is a path of the extended graph of a demand, whose cost is the sum of the coefficients of
+* its arcs for the chosen objective; only the objectives whose coefficients are additive over
+* the arcs (0, 1, 2, 2p and 4) can be priced. Given the duals of the non-overlapping and
+* convexity rows of the master, the column of least reduced cost of a demand is a shortest
+* path within the demand's reach, found by a label-setting algorithm on lengths and reduced
+* costs. The extended graphs are flattened into arrays so that demands are priced in
+* parallel without touching LEMON structures.
+*********************************************************************************************/
+class PathPricing : public RSA{
+
+private:
+    /** A flattened extended graph: the out-arcs of each node index are stored contiguously. **/
+    struct PricingGraph {
+        int source;                         /**< Index of the contracted source node (-1 if erased by preprocessing). **/
+        int target;                         /**< Index of the contracted target node (-1 if erased by preprocessing). **/
+        std::vector<int> firstOut;          /**< firstOut[v] is the position of the first out-arc of node v; firstOut[nbNodes] is the number of arcs. **/
+        std::vector<int> outArc;            /**< Index of each out-arc, by position. **/
+        std::vector<int> arcId;             /**< LEMON id of each arc. **/
+        std::vector<int> head;              /**< Head node of each arc. **/
+        std::vector<int> label;             /**< Fiber of each arc. **/
+        std::vector<int> slice;             /**< Slice of each arc. **/
+        std::vector<double> cost;           /**< Objective coefficient of each arc. **/
+        std::vector<double> reach;          /**< Length with hop penalty of each arc. **/
+        std::vector<double> reachToTarget;  /**< Length with hop penalties of the shortest path from each node to the target. **/
+    };
+    std::vector<PricingGraph> pricingGraphs;    /**< The flattened graph of each demand to be routed. **/
+
+    /** Flattens the graph of a demand and computes the reach from its nodes to the target. @param d The graph index. **/
+    void buildPricingGraph(int d);
+
+public:
+	/****************************************************************************************/
+	/*										Constructors									*/
+	/****************************************************************************************/
+    /** Constructor. Builds and preprocesses the extended graphs (see RSA) and flattens them. @param instance The instance to be solved. **/
+    PathPricing(const Instance &instance);
+
+	/****************************************************************************************/
+	/*										Methods											*/
+	/****************************************************************************************/
+    /** Returns if the objective can be priced on paths, i.e., if its coefficients are additive over the arcs. **/
+    static bool isPriceable(Input::ObjectiveMetric objective);
+
+    /** Returns an upper bound on the cost of any column of a demand. @param d The graph index. **/
+    double getMaxColumnCost(int d) const;
+
+    /** Returns the number of slices of the non-overlapping rows of a fiber. **/
+    int getNbRowSlices(int edge) const { return getNbSlicesLimitFromEdge(edge); }
+
+    /** Returns the column of least reduced cost of a demand. Returns false if the demand has no path within its reach. @param d The graph index. @param linkDuals The dual of the non-overlapping row of each (fiber, slice). @param demandDual The dual of the convexity row of the demand. **/
+    bool price(int d, const std::vector< std::vector<double> > &linkDuals, double demandDual, PathColumn &column) const;
+
+    /** Prices every demand, in parallel with one thread per core. Returns, for each demand, if it has a path within its reach. **/
+    std::vector<bool> priceAll(const std::vector< std::vector<double> > &linkDuals, const std::vector<double> &demandDuals, std::vector<PathColumn> &columns) const;
+
+    /** Stores the chosen column of each demand as its path (see RSA::updateInstance). @param chosen The chosen column of each demand. **/
+    void setPaths(const std::vector<PathColumn> &chosen);
+};
+
+#endif
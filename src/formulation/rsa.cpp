@@ -8,7 +8,7 @@ RSA::RSA(const Instance &inst) : instance(inst), compactEdgeId(compactGraph), co
     /* Creates compact graph. */
     buildCompactGraph();
 
-    ClockTime clock(ClockTime::getTimeNow());
+    Telemetry::Span graphSpan("graph", true);
 
     /* Set demands to be routed. */
     this->setToBeRouted(instance.getNextDemands());
@@ -72,15 +72,18 @@ RSA::RSA(const Instance &inst) : instance(inst), compactEdgeId(compactGraph), co
             }
         }
     }
-    setRSAGraphConstructionTime(clock.getTimeInSecFromStart());
-    //std::cout <<  "Graph construction: " << clock.getTimeInSecFromStart() << std::endl;
+    setRSAGraphConstructionTime(graphSpan.stop());
     
-    clock.setStart(ClockTime::getTimeNow());
+    Telemetry::Span preprocessingSpan("preprocessing", true);
     /* Calls preprocessing. */
     preprocessing();
 
-    setPreprocessingTime(clock.getTimeInSecFromStart());
-    //std::cout <<  "Preprocessing: " << clock.getTimeInSecFromStart() << std::endl;
+    setPreprocessingTime(preprocessingSpan.stop());
+    if (Telemetry::isEnabled()){
+        for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+            Telemetry::count(Telemetry::COUNTER_ARCS, countArcs(*vecGraph[d]));
+        }
+    }
 
     /* Sets arcs and nodes index. Sets arcs id's (variables id). */
     sourceNodeIndex.resize(getNbDemandsToBeRouted());
@@ -119,6 +122,29 @@ RSA::RSA(const Instance &inst) : instance(inst), compactEdgeId(compactGraph), co
         auxNbSlicesLimitFromEdge[i] = getNbSlicesLimitFromEdge(i);
     }
     auxNbSlicesGlobalLimit = getNbSlicesGlobalLimit();
+
+    /* Computes the coefficients of every chosen objective once the arcs are indexed, so that they are only read afterwards. */
+    std::vector<Input::ObjectiveMetric> chosenObjectives = instance.getInput().getChosenObj();
+    for (unsigned int i = 0; i < chosenObjectives.size(); i++){
+        setCoeffArrays(chosenObjectives[i]);
+    }
+    if (Telemetry::isEnabled()){
+        Telemetry::measureMemory(Telemetry::MEMORY_GRAPHS, getGraphsMemory());
+    }
+}
+
+/* Each graph has 6 integer and 2 double arc maps, 4 integer node maps, and an iterable map on the node and arc labels
+(a value and two links per item). */
+std::size_t RSA::getGraphsMemory() const{
+    std::size_t bytes = 0;
+    for (unsigned int d = 0; d < vecGraph.size(); d++){
+        const ListDigraph &g = *vecGraph[d];
+        bytes += MemoryUsage::ofListDigraph(g);
+        bytes += MemoryUsage::ofArcMap(g, 6*sizeof(int) + 2*sizeof(double));
+        bytes += MemoryUsage::ofNodeMap(g, 4*sizeof(int));
+        bytes += MemoryUsage::ofArcMap(g, 3*sizeof(int)) + MemoryUsage::ofNodeMap(g, 3*sizeof(int));
+    }
+    return bytes;
 }
 
 /** Returns the total number of loads to be routed. **/
@@ -298,6 +324,23 @@ void RSA::eraseNonRoutableArcs(int d){
     //std::cout << "> Number of non-routable arcs erased on graph #" << d << ": " << nb << std::endl; 
 }
 
+/* Erases every arc from graph #d that was fixed to zero for the demand and returns the number of arcs removed. */
+int RSA::eraseFixedArcs(int d){
+    int nb = 0;
+    int demandId = getToBeRouted_k(d).getId();
+    ListDigraph::ArcIt a(*vecGraph[d]);
+    while (a != INVALID){
+        ListDigraph::Arc currentArc = a;
+        ++a;
+        int uLabel = getNodeLabel((*vecGraph[d]).source(currentArc), d);
+        if (instance.isFixedArc(demandId, getArcLabel(currentArc, d), getArcSlice(currentArc, d), uLabel)){
+            (*vecGraph[d]).erase(currentArc);
+            nb++;
+        }
+    }
+    return nb;
+}
+
 /* Runs preprocessing on every extended graph. */
 void RSA::preprocessing(){
     std::vector<int> nbArcsOld(getNbDemandsToBeRouted(), 0);
@@ -308,6 +351,21 @@ void RSA::preprocessing(){
     for (int d = 0; d < getNbDemandsToBeRouted(); d++){
         eraseNonRoutableArcs(d);
     }
+    if (instance.getNbFixedArcs() > 0){
+        int totalNb = 0;
+        for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+            totalNb += eraseFixedArcs(d);
+        }
+        std::cout << "> Number of arcs erased by Lagrangian fixing: " << totalNb << std::endl;
+    }
+    if (getInstance().getInput().getChosenPreprLvl() >= Input::PREPROCESSING_LVL_QOT){
+        if (getInstance().getInput().isGNPYEnabled()){
+            qotPreprocessing();
+        }
+        else{
+            std::cout << "WARNING: QoT preprocessing requires GNPY_activation (demand modes). It is skipped." << std::endl;
+        }
+    }
     if (getInstance().getInput().getChosenPreprLvl() >= Input::PREPROCESSING_LVL_PARTIAL){
         // do partial preprocessing;
         pathExistencePreprocessing();
@@ -408,14 +466,173 @@ bool RSA::lengthPreprocessing(){
     return false;
 }
 
+/* An arc with slice s of a demand with load w covers the slices s-w+1, ..., s of its fiber. The demands covering a same (fiber, slice) are merged with a union-find. */
+std::vector< std::vector<int> > RSA::getInteractionComponents() const{
+    int nbDemands = getNbDemandsToBeRouted();
+    std::vector<int> firstCell(instance.getNbEdges() + 1, 0);
+    for (int e = 0; e < instance.getNbEdges(); e++){
+        firstCell[e+1] = firstCell[e] + getNbSlicesLimitFromEdge(e);
+    }
+    std::vector<int> owner(firstCell.back(), -1);
+    std::vector<int> parent(nbDemands);
+    for (int d = 0; d < nbDemands; d++){
+        parent[d] = d;
+    }
+    auto find = [&parent](int d) -> int {
+        while (parent[d] != d){
+            parent[d] = parent[parent[d]];
+            d = parent[d];
+        }
+        return d;
+    };
+    for (int d = 0; d < nbDemands; d++){
+        int load = getToBeRouted_k(d).getLoad();
+        for (ListDigraph::ArcIt a(*vecGraph[d]); a != INVALID; ++a){
+            int label = getArcLabel(a, d);
+            int slice = getArcSlice(a, d);
+            for (int s = std::max(0, slice - load + 1); s <= slice; s++){
+                int &cell = owner[firstCell[label] + s];
+                if (cell == -1){
+                    cell = d;
+                }
+                else{
+                    int root = find(cell);
+                    int other = find(d);
+                    if (root != other){
+                        parent[std::max(root, other)] = std::min(root, other);
+                    }
+                }
+            }
+        }
+    }
+    std::vector< std::vector<int> > components;
+    std::vector<int> componentOf(nbDemands, -1);
+    for (int d = 0; d < nbDemands; d++){
+        int root = find(d);
+        if (componentOf[root] == -1){
+            componentOf[root] = components.size();
+            components.push_back(std::vector<int>());
+        }
+        components[componentOf[root]].push_back(d);
+    }
+    return components;
+}
+
+/* Demands are grouped by their description; the classes are listed by their first demand. */
+std::vector< std::vector<int> > RSA::getSymmetricDemandClasses() const{
+    std::map< std::string, std::vector<int> > classOf;
+    std::vector<std::string> keys;
+    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+        const Demand &demand = getToBeRouted_k(d);
+        std::ostringstream key;
+        key << std::setprecision(17) << demand.getSource() << ";" << demand.getTarget() << ";" << demand.getLoad() << ";" << demand.getMaxLength()
+            << ";" << demand.getMode() << ";" << demand.getSpacing() << ";" << demand.getPathBandwidth();
+        std::vector<int> &equivalent = classOf[key.str()];
+        if (equivalent.empty()){
+            keys.push_back(key.str());
+        }
+        equivalent.push_back(d);
+    }
+    std::vector< std::vector<int> > classes;
+    for (unsigned int i = 0; i < keys.size(); i++){
+        if (classOf[keys[i]].size() >= 2){
+            classes.push_back(classOf[keys[i]]);
+        }
+    }
+    return classes;
+}
+
+/* Performs preprocessing based on the QoT of the routes and returns true if at least one arc is erased. */
+bool RSA::qotPreprocessing(){
+    std::cout << "Called QoT preprocessing."<< std::endl;
+    gnModelEvaluator qot(instance.getInput());
+    /* Reach tables: noise of the least noisy route from each node label, by mode. */
+    std::map<std::string, std::shared_ptr<EdgeCost> > noise;
+    std::map<std::pair<std::string, int>, std::vector<double> > reachTable;
+    int totalNb = 0;
+    int nbTightened = 0;
+    int nbUnknownModes = 0;
+    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+        std::string mode = getToBeRouted_k(d).getMode();
+        /* The GN model cannot tell which routes of an unknown mode are feasible: they are all kept. */
+        if (!qot.hasMode(mode)){
+            nbUnknownModes++;
+            continue;
+        }
+        if (noise.find(mode) == noise.end()){
+            std::shared_ptr<EdgeCost> modeNoise = std::make_shared<EdgeCost>(compactGraph);
+            for (ListGraph::EdgeIt e(compactGraph); e != INVALID; ++e){
+                (*modeNoise)[e] = qot.getLinkNoise(getCompactLength(e), mode);
+            }
+            noise[mode] = modeNoise;
+        }
+        double reach = qot.getReach(mode);
+        if (reach < getToBeRouted_k(d).getMaxLength()){
+            toBeRouted[d].setMaxLength(reach);
+            nbTightened++;
+        }
+
+        std::pair<std::string, int> sourceKey(mode, getToBeRouted_k(d).getSource());
+        std::pair<std::string, int> targetKey(mode, getToBeRouted_k(d).getTarget());
+        if (reachTable.find(sourceKey) == reachTable.end()){
+            reachTable[sourceKey] = getNoiseDistances(*noise[mode], sourceKey.second);
+        }
+        if (reachTable.find(targetKey) == reachTable.end()){
+            reachTable[targetKey] = getNoiseDistances(*noise[mode], targetKey.second);
+        }
+        const std::vector<double> &fromSource = reachTable[sourceKey];
+        const std::vector<double> &toTarget = reachTable[targetKey];
+        double budget = qot.getNoiseBudget(mode);
+
+        ListDigraph::ArcIt a(*vecGraph[d]);
+        ListDigraph::ArcIt currentArc(*vecGraph[d], a);
+        while (a != INVALID){
+            currentArc = a;
+            ListDigraph::ArcIt nextArc(*vecGraph[d], ++currentArc);
+            int u = getNodeLabel((*vecGraph[d]).source(a), d);
+            int v = getNodeLabel((*vecGraph[d]).target(a), d);
+            if (fromSource[u] == DBL_MAX || toTarget[v] == DBL_MAX
+                || fromSource[u] + qot.getLinkNoise(getArcLength(a, d), mode) + toTarget[v] > budget*(1.0 + DBL_EPSILON)){
+                (*vecGraph[d]).erase(a);
+                totalNb++;
+            }
+            a = nextArc;
+        }
+    }
+    if (nbUnknownModes > 0){
+        std::cout << "WARNING: " << nbUnknownModes << " demands have a mode unknown to the GN model. They are not preprocessed by QoT." << std::endl;
+    }
+    std::cout << "> Number of demands whose reach is bounded by QoT: " << nbTightened << std::endl;
+    std::cout << "> Number of erased arcs due to QoT: " << totalNb << std::endl;
+    return (totalNb >= 1);
+}
+
+/* Returns the noise of the least noisy route from the node with the given label to every node label. */
+std::vector<double> RSA::getNoiseDistances(const EdgeCost &noise, int label){
+    std::vector<double> distances(instance.getNbNodes(), DBL_MAX);
+    ListGraph::Node s = getCompactNodeFromLabel(label);
+    if (s == INVALID){
+        return distances;
+    }
+    PooledDijkstra< ListGraph, EdgeCost > path(compactGraph, noise, shortestPathPool);
+    path.run(s);
+    for (ListGraph::NodeIt v(compactGraph); v != INVALID; ++v){
+        if (path.reached(v)){
+            distances[getCompactNodeLabel(v)] = path.dist(v);
+        }
+    }
+    return distances;
+}
+
 /* Returns the distance of the shortest path from source to target passing through arc a. */
 double RSA::shortestDistance(int d, ListDigraph::Node &s, ListDigraph::Arc &a, ListDigraph::Node &t){
     double distance = 0.0;
-    Dijkstra< ListDigraph, ListDigraph::ArcMap<double> > s_u_path((*vecGraph[d]), (*vecArcLengthWithPenalty[d]));
+    /* Both runs share the pooled workspace of the graph: the first result is consumed before the second run. */
+    PooledDijkstra< ListDigraph, ListDigraph::ArcMap<double> > path((*vecGraph[d]), (*vecArcLengthWithPenalty[d]), shortestPathPool);
 
-    s_u_path.run(s,(*vecGraph[d]).source(a));
-    if (s_u_path.reached((*vecGraph[d]).source(a))){
-        distance += s_u_path.dist((*vecGraph[d]).source(a));
+    path.run(s,(*vecGraph[d]).source(a));
+    if (path.reached((*vecGraph[d]).source(a))){
+        distance += path.dist((*vecGraph[d]).source(a));
     }
     else{
         return DBL_MAX;
@@ -423,10 +640,9 @@ double RSA::shortestDistance(int d, ListDigraph::Node &s, ListDigraph::Arc &a, L
     
     distance += getArcLengthWithPenalties(a, d);
 
-    Dijkstra< ListDigraph, ListDigraph::ArcMap<double> > v_t_path((*vecGraph[d]), (*vecArcLengthWithPenalty[d]));
-    v_t_path.run((*vecGraph[d]).target(a), t);
-    if (v_t_path.reached(t)){
-        distance += v_t_path.dist(t);
+    path.run((*vecGraph[d]).target(a), t);
+    if (path.reached(t)){
+        distance += path.dist(t);
     }
     else{
         return DBL_MAX;
@@ -531,52 +747,89 @@ double RSA::getCoeffObj8(const ListDigraph::Arc &a, int d){
 
 /* Returns the coefficient of an arc (according to the chosen metric) on graph #d. */
 double RSA::getCoeff(const ListDigraph::Arc &a, int d){
-    double coeff = 0.0;
-    switch (getInstance().getInput().getChosenObj_k(0)){
+    return getCoeffArray(instance.getInput().getChosenObj_k(0), d)[getArcIndex(a, d)];
+}
+
+/* The switch is resolved at compile time. */
+template<Input::ObjectiveMetric OBJ>
+double RSA::getCoeffObj(const ListDigraph::Arc &a, int d){
+    switch (OBJ){
+        case Input::OBJECTIVE_METRIC_1:
+            return getCoeffObj1(a, d);
+        case Input::OBJECTIVE_METRIC_1p:
+            return getCoeffObj1p(a, d);
+        case Input::OBJECTIVE_METRIC_2:
+            return getCoeffObj2(a, d);
+        case Input::OBJECTIVE_METRIC_2p:
+            return getCoeffObj2p(a, d);
+        case Input::OBJECTIVE_METRIC_4:
+            return getCoeffObj4(a, d);
+        case Input::OBJECTIVE_METRIC_8:
+            return getCoeffObj8(a, d);
+        default:
+            return 0.0;
+    }
+}
+
+/* Arcs may have been erased since they were indexed, so each array is sized by the largest index. */
+template<Input::ObjectiveMetric OBJ>
+void RSA::setCoeffArrays(){
+    std::vector< std::vector<double> > &arrays = coeffArrays[OBJ];
+    arrays.resize(getNbDemandsToBeRouted());
+    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+        int size = 0;
+        for (ListDigraph::ArcIt a(*vecGraph[d]); a != INVALID; ++a){
+            size = std::max(size, getArcIndex(a, d) + 1);
+        }
+        arrays[d].assign(size, 0.0);
+        for (ListDigraph::ArcIt a(*vecGraph[d]); a != INVALID; ++a){
+            arrays[d][getArcIndex(a, d)] = getCoeffObj<OBJ>(a, d);
+        }
+    }
+}
+
+/* The objective is only dispatched once, the coefficients being computed by a pass specialized for it. */
+void RSA::setCoeffArrays(Input::ObjectiveMetric obj){
+    if (coeffArrays.find(obj) != coeffArrays.end()){
+        return;
+    }
+    switch (obj){
         case Input::OBJECTIVE_METRIC_0:
-        {
-            coeff = 0;
+            setCoeffArrays<Input::OBJECTIVE_METRIC_0>();
             break;
-        }
         case Input::OBJECTIVE_METRIC_1:
-        {
-            coeff = getCoeffObj1(a, d);
+            setCoeffArrays<Input::OBJECTIVE_METRIC_1>();
             break;
-        }
         case Input::OBJECTIVE_METRIC_1p:
-        {
-            coeff = getCoeffObj1p(a, d);
+            setCoeffArrays<Input::OBJECTIVE_METRIC_1p>();
             break;
-        }
         case Input::OBJECTIVE_METRIC_2:
-        {
-            coeff = getCoeffObj2(a, d);
+            setCoeffArrays<Input::OBJECTIVE_METRIC_2>();
             break;
-        }
         case Input::OBJECTIVE_METRIC_2p:
-        {
-            coeff = getCoeffObj2p(a, d);
+            setCoeffArrays<Input::OBJECTIVE_METRIC_2p>();
             break;
-        }
         case Input::OBJECTIVE_METRIC_4:
-        {
-            coeff = getCoeffObj4(a, d);
+            setCoeffArrays<Input::OBJECTIVE_METRIC_4>();
             break;
-        }
         case Input::OBJECTIVE_METRIC_8:
-        {
-            coeff = getCoeffObj8(a, d);
+            setCoeffArrays<Input::OBJECTIVE_METRIC_8>();
             break;
-        }
         default:
-        {
             std::cerr << "Objective metric out of range.\n";
             exit(0);
             break;
-        }
     }
-    
-    return coeff;
+}
+
+/* The arrays are built in the constructor and never modified afterwards, so concurrent readers are safe. */
+const std::vector<double> & RSA::getCoeffArray(Input::ObjectiveMetric obj, int d) const{
+    std::map< Input::ObjectiveMetric, std::vector< std::vector<double> > >::const_iterator it = coeffArrays.find(obj);
+    if (it == coeffArrays.end()){
+        std::cout << "ERROR: The coefficients of objective " << obj << " were not computed: it is not a chosen objective." << std::endl;
+        exit(0);
+    }
+    return it->second[d];
 }
 
 
@@ -713,5 +966,8 @@ RSA::~RSA() {
     vecArcVarId.clear();
     sourceNodeIndex.clear();
     targetNodeIndex.clear();
+    for (unsigned int d = 0; d < vecGraph.size(); d++){
+        shortestPathPool.release(vecGraph[d].get());
+    }
     vecGraph.clear();
 }
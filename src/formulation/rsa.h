@@ -1,6 +1,7 @@
 #ifndef __RSA__h
 #define __RSA__h
 
+#include <memory>
 #include <ilcplex/ilocplex.h>
 #include <lemon/list_graph.h>
 #include <lemon/concepts/graph.h>
@@ -10,6 +11,10 @@
 
 #include "../topology/instance.h"
 #include "../tools/clockTime.h"
+#include "../tools/memoryUsage.h"
+#include "../tools/telemetry.h"
+#include "../tools/shortestPathPool.h"
+#include "../qot/gnModelEvaluator.h"
 
 
 using namespace lemon;
@@ -114,6 +119,8 @@ protected:
     EdgeCost compactEdgeLength;         /**< EdgeMap storing the edge lengths of the simple graph associated with the initial mapping. **/
     CompactNodeMap compactNodeId;       /**< NodeMap storing the LEMON node ids of the simple graph associated with the initial mapping. **/
     CompactNodeMap compactNodeLabel;    /**< NodeMap storing the node labels of the simple graph associated with the initial mapping. **/
+
+    ShortestPathPool shortestPathPool;  /**< Shortest path workspaces and min-cost flow solvers of the graphs above. Declared after them so it is destroyed first. **/
     
     Status currentStatus;		/**< Provides information about the current model and solution. **/
 
@@ -126,6 +133,19 @@ protected:
     std::vector<int> auxNbSlicesLimitFromEdge;
 	int auxNbSlicesGlobalLimit;
 
+    /** The objective coefficients of the arcs, for each chosen objective. They are computed at the end of the constructor and only read afterwards.
+        \note coeffArrays[obj][i][j] is the coefficient for objective obj of the arc of index j in the graph associated with the i-th demand to be routed. **/
+    std::map< Input::ObjectiveMetric, std::vector< std::vector<double> > > coeffArrays;
+
+    /** Returns the coefficient of an arc for the objective given as template parameter. @param a The arc. @param d The graph index. **/
+    template<Input::ObjectiveMetric OBJ> double getCoeffObj(const ListDigraph::Arc &a, int d);
+
+    /** Computes the coefficients of the arcs of every graph for the objective given as template parameter. **/
+    template<Input::ObjectiveMetric OBJ> void setCoeffArrays();
+
+    /** Computes the coefficients of the arcs of every graph for an objective, if not already done. @param obj The objective metric. **/
+    void setCoeffArrays(Input::ObjectiveMetric obj);
+
 public:
 	/****************************************************************************************/
 	/*										Constructor										*/
@@ -140,6 +160,9 @@ public:
 
     double getRSAGraphConstructionTime() const { return RSAGraphConstructionTime;}
     double getPreprocessingTime() const { return PreprocessingTime; }
+
+    /** Returns the memory (bytes) estimated for the extended graphs of the demands and their maps. **/
+    std::size_t getGraphsMemory() const;
     
     /** Returns the input instance. **/
     Instance getInstance() const{ return instance; }
@@ -211,6 +234,9 @@ public:
     
     /** Returns the coefficient of an arc (according to the chosen metric) on a graph. @param a The arc. @param d The graph index. **/
     double getCoeff(const ListDigraph::Arc &a, int d);
+
+    /** Returns the coefficients of the arcs of a graph for an objective, by arc index. Only the chosen objectives are available. @param obj The objective metric. @param d The graph index. **/
+    const std::vector<double> & getCoeffArray(Input::ObjectiveMetric obj, int d) const;
     
     /** Returns the coefficient of an arc according to metric 1 on a graph. @param a The arc. @param d The graph index. \note Min sum(max used slice positions) over demands. **/
     double getCoeffObj1(const ListDigraph::Arc &a, int d);
@@ -334,6 +360,9 @@ public:
 
     /** Delete arcs that are known 'a priori' to be unable to route on a graph. Erase arcs that do not support the demand's load. @param d The index of the graph to be inspected. **/
     void eraseNonRoutableArcs(int d);
+
+    /** Delete arcs fixed to zero in the instance for the demand (see lagArcFixing). Returns the number of arcs erased. @param d The index of the graph to be inspected. **/
+    int eraseFixedArcs(int d);
     
     /** Runs preprocessing on every extended graph. **/
     void preprocessing();
@@ -344,6 +373,18 @@ public:
     /** Performs preprocessing based on the arc lengths and returns true if at least one arc is erased. An arc (u,v) can only be part of a solution if the distance from demand source to u, plus the distance from v to demand target plus the arc length is less than or equal to the demand's maximum length. **/
     bool lengthPreprocessing();
 
+    /** Performs preprocessing based on the QoT of the routes, estimated by the GN model with the parameters of the GNPY files. The maximum length of each demand is bounded by the reach of its mode, and an arc (u,v) is erased if the noise of the least noisy route from the demand source to u, plus the noise of the arc, plus the noise of the least noisy route from v to the demand target exceeds the noise budget of the mode. Demands whose mode is unknown to the model are skipped. The model only approximates GNPY, so a route GNPY would accept may be erased. Returns true if at least one arc is erased. **/
+    bool qotPreprocessing();
+
+    /** Returns the noise of the least noisy route from the node with the given label to every node label of the compact graph (DBL_MAX if unreachable). @param noise The noise of each edge. @param label The node's label. **/
+    std::vector<double> getNoiseDistances(const EdgeCost &noise, int label);
+
+    /** Returns the connected components of the interaction graph of the demands to be routed: two demands interact if an arc of each graph covers the same slice of the same fiber. Each component lists graph indices in increasing order. **/
+    std::vector< std::vector<int> > getInteractionComponents() const;
+
+    /** Returns the classes of identical demands to be routed, i.e., with the same source, target, load, reach and GNPY mode, spacing and bandwidth: their graphs are the same and any two of them can be swapped in a solution. Only the classes of at least two demands are returned, each listing graph indices in increasing order. **/
+    std::vector< std::vector<int> > getSymmetricDemandClasses() const;
+
     /** Returns the distance of the shortest path from source to target passing through arc a. \note If there exists no st-path, returns +Infinity. @param d The graph index. @param source The source node.  @param a The arc required to be present. @param target The target node.  **/
     double shortestDistance(int d, ListDigraph::Node &source, ListDigraph::Arc &a, ListDigraph::Node &target);
 
@@ -84,6 +84,9 @@ void Generator::generateDemands(int nbDemands){
     int sourceLabel, targetLabel, slice;
     double length;
 
+    /* The shortest path lengths of the topology, computed once for all pairs. */
+    std::shared_ptr<const PathCache> pathCache = PathCache::getCache(tabEdge, getNbNodes(), 1);
+
     std::ofstream fichier(demandsFile.c_str());
     if (!fichier.fail()) {
         fichier << "index;origin;destination;slots;max_reach" << std::endl;
@@ -108,13 +111,8 @@ void Generator::generateDemands(int nbDemands){
                     length = 600.0;
                 }
 
-                const ListDigraph::Node SOURCE = getFirstNodeFromLabel(sourceLabel);
-                const ListDigraph::Node TARGET = getFirstNodeFromLabel(targetLabel);
-
-                Dijkstra<ListDigraph,ArcCost> shortestPath(compactGraph,compactArcLength);
-                shortestPath.run(SOURCE, TARGET);
-
-                if(shortestPath.dist(TARGET)<=length){
+                const std::vector<CachedPath> &paths = pathCache->getPaths(sourceLabel, targetLabel);
+                if(!paths.empty() && paths[0].length <= length){
                     STOP = true;
                 }
             }
@@ -9,6 +9,7 @@
 #include "tools/CSVReader.h"
 #include "topology/instance.h"
 #include "tools/clockTime.h"
+#include "tools/pathCache.h"
 
 #include <lemon/list_graph.h>
 #include <lemon/concepts/graph.h>
@@ -1,4 +1,5 @@
 #include "AbstractLagrangianFormulation.h"
+#include <limits>
 
 /************************************************************************************************************/
 /*			                                     CONSTRUCTORS	       	                                    */
@@ -14,7 +15,19 @@ AbstractLagFormulation::AbstractLagFormulation(const Instance &instance): FlowFo
     for (int d = 0; d < getNbDemandsToBeRouted(); d++){
         lowerBound.emplace_back(std::make_shared<ArcMap>((*vecGraph[d])));
         upperBound.emplace_back(std::make_shared<ArcMap>((*vecGraph[d])));
+        openArcs.emplace_back(std::make_shared<ListDigraph::ArcMap<bool>>((*vecGraph[d]), true));
+        openSubgraphs.emplace_back(std::make_shared<FilterArcs<ListDigraph>>((*vecGraph[d]), (*openArcs[d])));
     }
+    boundsChanged.resize(getNbDemandsToBeRouted(), true);
+    lengthSegment = -1;
+    sourceTargetSegment = -1;
+    flowSegment = -1;
+    overlapSegment = -1;
+    oneSlicePerDemandSegment = -1;
+    maxUsedSliceOverallSegment = -1;
+    maxUsedSliceOverallAuxSegment = -1;
+    maxUsedSliceOverall2Segment = -1;
+    maxUsedSliceOverall3Segment = -1;
 }
 
 /* **************************************************************************************************************
@@ -149,18 +162,46 @@ double AbstractLagFormulation::initialUBValueObj8(){
     return (auxNbSlicesGlobalLimit);
 }
 
-/* Updating the variables upper and lower bounds according to branch and bound. */
-void AbstractLagFormulation::updateLowerUpperBound(double *lower, double *upper){
-    /* Refers to the upper bound of the arcs depending on the chosen objective function. */
-    operatorLowerUpperBound operLB(lower);
-    operatorLowerUpperBound operUB(upper);
+/* Maps each variable id to its demand and arc. Previous bounds are NaN so that the first resolve sets every arc. */
+void AbstractLagFormulation::initBoundDiffing(){
+    int nbVars = instance.getInput().isObj8(0) ? maxSliceOverallVarId + 1 : 0;
     for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        operLB.setDemand(d);
-        operUB.setDemand(d);
-        CombineArcMapArcMapLowerUpperBound combLB((*vecArcVarId[d]),(*vecArcVarId[d]),operLB);
-        CombineArcMapArcMapLowerUpperBound combUB((*vecArcVarId[d]),(*vecArcVarId[d]),operUB);
-        mapCopy<ListDigraph,CombineArcMapArcMapLowerUpperBound,ArcMap>((*vecGraph[d]),combLB,(*lowerBound[d]));
-        mapCopy<ListDigraph,CombineArcMapArcMapLowerUpperBound,ArcMap>((*vecGraph[d]),combUB,(*upperBound[d]));
+        for (ListDigraph::ArcIt a(*vecGraph[d]); a != INVALID; ++a){
+            nbVars = std::max(nbVars, getVarId(a, d) + 1);
+        }
+    }
+    varArc.assign(nbVars, std::make_pair(-1, ListDigraph::Arc(INVALID)));
+    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+        for (ListDigraph::ArcIt a(*vecGraph[d]); a != INVALID; ++a){
+            varArc[getVarId(a, d)] = std::make_pair(d, ListDigraph::Arc(a));
+        }
+    }
+    previousLower.assign(nbVars, std::numeric_limits<double>::quiet_NaN());
+    previousUpper.assign(nbVars, std::numeric_limits<double>::quiet_NaN());
+}
+
+/* Updating the variables upper and lower bounds according to branch and bound. Only the variables whose bounds differ
+from the previous resolve are written to the arc maps. */
+void AbstractLagFormulation::updateLowerUpperBound(double *lower, double *upper){
+    if(varArc.empty()){
+        initBoundDiffing();
+    }
+    const int nbVars = varArc.size();
+    for (int id = 0; id < nbVars; id++){
+        if(lower[id] == previousLower[id] && upper[id] == previousUpper[id]){
+            continue;
+        }
+        previousLower[id] = lower[id];
+        previousUpper[id] = upper[id];
+        const int d = varArc[id].first;
+        if(d == -1){
+            continue;
+        }
+        const ListDigraph::Arc &a = varArc[id].second;
+        (*lowerBound[d])[a] = (int)lower[id];
+        (*upperBound[d])[a] = (int)upper[id];
+        openArcs[d]->set(a, (*upperBound[d])[a] > 0);
+        boundsChanged[d] = true;
     }
     if(instance.getInput().isObj8(0)){
         maxUsedSliceOverallUpperBound = upper[maxSliceOverallVarId];
@@ -287,202 +328,410 @@ void AbstractLagFormulation::clearPrimalApproximationMatrix(){
 *                                            INITIALIZATION METHODS
 *************************************************************************************************************** */
 
-/************************************************ MULTIPLIERS ***************************************************/
+/************************************************ DUAL STORAGE ***************************************************/
 
-/* Sets the initial lagrangian multipliers associated with length constraints. */
-void AbstractLagFormulation::initializeLengthMultipliers(double initialMultiplier){  
-    lagrangianMultiplierLength.resize(getNbDemandsToBeRouted(),initialMultiplier);
+/* Builds the layout of the relaxed constraints and allocates the dual vectors. The layout only depends on the
+instance, so it is built once and the vectors are reused by all the following runs. */
+void AbstractLagFormulation::initDualStorage(){
+    if(dualLayout.getNbSegments() > 0){
+        return;
+    }
+    initDualLayout();
+
+    dualMultiplier.allocate(dualLayout, 0.0);
+    dualStabilityCenter.allocate(dualLayout, 0.0);
+    dualSlack.allocate(dualLayout, 0.0);
+    dualSlack_v2.allocate(dualLayout, 0.0);
+    dualDirection.allocate(dualLayout, 0.0);
+    dualLower.allocate(dualLayout, 0.0);
+    dualUpper.allocate(dualLayout, DBL_MAX);
+    dualActive.allocate(dualLayout, 1.0);
+
+    initDualBounds();
+    bindDualViews();
+    Telemetry::measureMemory(Telemetry::MEMORY_DUALS, getDualMemory());
 }
 
-/* Sets the initial lagrangian multipliers associated with source/target constraints*/
-void AbstractLagFormulation::initializeSourceTargetMultipliers(double initialMultiplier){
-    lagrangianMultiplierSourceTarget.resize(getNbDemandsToBeRouted());
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        lagrangianMultiplierSourceTarget[d].resize(instance.getNbNodes(),initialMultiplier);
+/* The multipliers, stability centers, slacks, directions, bounds and active flags share the layout. */
+std::size_t AbstractLagFormulation::getDualMemory() const{
+    const DualVector *vectors[] = {&dualMultiplier, &dualStabilityCenter, &dualSlack, &dualSlack_v2, &dualDirection, &dualLower, &dualUpper, &dualActive};
+    std::size_t bytes = dualLayout.getMemory();
+    for (const DualVector *v : vectors){
+        bytes += v->getMemory();
     }
+    return bytes;
 }
 
-/* Sets the initial lagrangian multipliers associated with flow constraints */
-void AbstractLagFormulation::initializeFlowMultipliers(double initialMultiplier){
-    lagrangianMultiplierFlow.resize(getNbDemandsToBeRouted());
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        lagrangianMultiplierFlow[d].resize(countNodes(*vecGraph[d]),initialMultiplier);
-        int indexSource = getSourceNodeIndex(d);
-        int indexTarget = getTargetNodeIndex(d);
-        lagrangianMultiplierFlow[d][indexSource] = 0.0;
-        lagrangianMultiplierFlow[d][indexTarget] = 0.0;
-    }
+/* Adds the segment of length constraints: one per demand. */
+void AbstractLagFormulation::addLengthSegment(){
+    lengthSegment = dualLayout.addSegment(getNbDemandsToBeRouted());
 }
 
-/* Sets the initial lagrangian multipliers associated with non-overlapping constraints. */
-void AbstractLagFormulation::initializeOverlapMultipliers(double initialMultiplier){
-    lagrangianMultiplierOverlap.resize(instance.getNbEdges());
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        lagrangianMultiplierOverlap[e].resize(auxNbSlicesLimitFromEdge[e],initialMultiplier);
-    }
+/* Adds the segment of source/target constraints: one per demand and node. */
+void AbstractLagFormulation::addSourceTargetSegment(){
+    sourceTargetSegment = dualLayout.addSegment(std::vector<int>(getNbDemandsToBeRouted(), instance.getNbNodes()));
 }
 
-/* Sets the nitial lagrangian multipliers associated with one slice per demand constraints. */
-void AbstractLagFormulation::initializeOneSlicePerDemandMultipliers(double initialMultiplier){
-    lagrangianMultiplierOneSlicePerDemand.resize(instance.getNbEdges());
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        lagrangianMultiplierOneSlicePerDemand[e].resize(getNbDemandsToBeRouted(),initialMultiplier);
+/* Adds the segment of flow constraints: one per demand and node of the demand graph. */
+void AbstractLagFormulation::addFlowSegment(){
+    std::vector<int> rowSizes(getNbDemandsToBeRouted());
+    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+        rowSizes[d] = countNodes(*vecGraph[d]);
     }
+    flowSegment = dualLayout.addSegment(rowSizes);
 }
 
-/* Sets the initial lagrangian multipliers associated with maximum slice overall 1 constraints. */
-void AbstractLagFormulation::initializeMaxUsedSliceOverallMultipliers(double initialMultiplier){
-    lagrangianMultiplierMaxUsedSliceOverall.resize(getNbDemandsToBeRouted(),initialMultiplier);
+/* Adds the segment of non-overlapping constraints: one per edge and slice. */
+void AbstractLagFormulation::addOverlapSegment(){
+    overlapSegment = dualLayout.addSegment(std::vector<int>(auxNbSlicesLimitFromEdge.begin(), auxNbSlicesLimitFromEdge.begin() + instance.getNbEdges()));
 }
 
-/* Sets the initial lagrangian multipliers associated with maximum slice overall 1 (auxiliary) constraints. */
-void AbstractLagFormulation::initializeMaxUsedSliceOverallAuxMultipliers(double initialMultiplier){
-    lagrangianMultiplierMaxUsedSliceOverallAux.resize(getNbDemandsToBeRouted(),initialMultiplier);
+/* Adds the segment of one slice per demand constraints: one per edge and demand. */
+void AbstractLagFormulation::addOneSlicePerDemandSegment(){
+    oneSlicePerDemandSegment = dualLayout.addSegment(std::vector<int>(instance.getNbEdges(), getNbDemandsToBeRouted()));
 }
 
-/* Sets the initial lagrangian multipliers associated with maximum slice overall 2 constraints. */
-void AbstractLagFormulation::initializeMaxUsedSliceOverall2Multipliers(double initialMultiplier){
-    lagrangianMultiplierMaxUsedSliceOverall2.resize(instance.getNbEdges());
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        lagrangianMultiplierMaxUsedSliceOverall2[e].resize(auxNbSlicesLimitFromEdge[e],initialMultiplier);
-    }
+/* Adds the segment of maximum used slice overall 1 constraints: one per demand. */
+void AbstractLagFormulation::addMaxUsedSliceOverallSegment(){
+    maxUsedSliceOverallSegment = dualLayout.addSegment(getNbDemandsToBeRouted());
 }
 
-/* Sets the initial lagrangian multipliers associated with maximum slice overall 3 constraints. */
-void AbstractLagFormulation::initializeMaxUsedSliceOverall3Multipliers(double initialMultiplier){
-    lagrangianMultiplierMaxUsedSliceOverall3.resize(instance.getNbNodes());
-    for (int v = 0; v < instance.getNbNodes(); v++){
-        lagrangianMultiplierMaxUsedSliceOverall3[v].resize(auxNbSlicesGlobalLimit,initialMultiplier);
-    }
+/* Adds the segment of maximum used slice overall 1 (auxiliary) constraints: one per demand. */
+void AbstractLagFormulation::addMaxUsedSliceOverallAuxSegment(){
+    maxUsedSliceOverallAuxSegment = dualLayout.addSegment(getNbDemandsToBeRouted());
 }
 
-/************************************************ STABILITY CENTER ***************************************************/
+/* Adds the segment of maximum used slice overall 2 constraints: one per edge and slice. */
+void AbstractLagFormulation::addMaxUsedSliceOverall2Segment(){
+    maxUsedSliceOverall2Segment = dualLayout.addSegment(std::vector<int>(auxNbSlicesLimitFromEdge.begin(), auxNbSlicesLimitFromEdge.begin() + instance.getNbEdges()));
+}
 
-/** Sets the initial lagrangian stability center associated with length constraints. **/
-void AbstractLagFormulation::initializeLengthSC(){
-    std::copy(lagrangianMultiplierLength.begin(), lagrangianMultiplierLength.end(),std::back_inserter(lagrangianSCLength));
+/* Adds the segment of maximum used slice overall 3 constraints: one per node and slice. */
+void AbstractLagFormulation::addMaxUsedSliceOverall3Segment(){
+    maxUsedSliceOverall3Segment = dualLayout.addSegment(std::vector<int>(instance.getNbNodes(), auxNbSlicesGlobalLimit));
 }
 
-/** Sets the initial lagrangian stability center associated with Source/Target constraints **/
-void AbstractLagFormulation::initializeSourceTargetSC(){
-    lagrangianSCSourceTarget.resize(getNbDemandsToBeRouted());
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        std::copy(lagrangianMultiplierSourceTarget[d].begin(), lagrangianMultiplierSourceTarget[d].end(),std::back_inserter(lagrangianSCSourceTarget[d]));
+/* All relaxed constraints are inequalities, except the source/target constraints of the source and the target of 
+each demand and the flow constraints, which are equalities. The flow constraints of the source and the target are
+not relaxed: their multipliers are fixed to zero and they are not considered in the norms. */
+void AbstractLagFormulation::initDualBounds(){
+    dualLower.fill(0.0);
+    dualUpper.fill(DBL_MAX);
+    dualActive.fill(1.0);
+
+    if(sourceTargetSegment != -1){
+        DualMatrix lower = dualLower.matrix(sourceTargetSegment);
+        for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+            lower[d][getToBeRouted_k(d).getSource()] = -DBL_MAX;
+            lower[d][getToBeRouted_k(d).getTarget()] = -DBL_MAX;
+        }
     }
-}
-        
-/** Sets the initial lagrangian stability center associated with flow constraints **/
-void AbstractLagFormulation::initializeFlowSC(){
-    lagrangianSCFlow.resize(getNbDemandsToBeRouted());
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        std::copy(lagrangianMultiplierFlow[d].begin(), lagrangianMultiplierFlow[d].end(),std::back_inserter(lagrangianSCFlow[d]));
+    if(flowSegment != -1){
+        dualLower.fill(flowSegment, -DBL_MAX);
+        DualMatrix lower = dualLower.matrix(flowSegment);
+        DualMatrix upper = dualUpper.matrix(flowSegment);
+        DualMatrix active = dualActive.matrix(flowSegment);
+        for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+            int fixed[2] = {getSourceNodeIndex(d), getTargetNodeIndex(d)};
+            for (int i = 0; i < 2; i++){
+                lower[d][fixed[i]] = 0.0;
+                upper[d][fixed[i]] = 0.0;
+                active[d][fixed[i]] = 0.0;
+            }
+        }
     }
 }
 
-/* Sets the initial lagrangian stability center associated with non-overlapping constraints. */
-void AbstractLagFormulation::initializeOverlapSC(){
-    lagrangianSCOverlap.resize(instance.getNbEdges());
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        std::copy(lagrangianMultiplierOverlap[e].begin(), lagrangianMultiplierOverlap[e].end(),std::back_inserter(lagrangianSCOverlap[e]));
+/* Points the vectors of each relaxed family to its segment. */
+void AbstractLagFormulation::bindDualViews(){
+    if(lengthSegment != -1){
+        lagrangianMultiplierLength = dualMultiplier.row(lengthSegment);
+        lagrangianSCLength = dualStabilityCenter.row(lengthSegment);
+        lengthSlack = dualSlack.row(lengthSegment);
+        lengthSlack_v2 = dualSlack_v2.row(lengthSegment);
+        lengthDirection = dualDirection.row(lengthSegment);
+    }
+    if(sourceTargetSegment != -1){
+        lagrangianMultiplierSourceTarget = dualMultiplier.matrix(sourceTargetSegment);
+        lagrangianSCSourceTarget = dualStabilityCenter.matrix(sourceTargetSegment);
+        sourceTargetSlack = dualSlack.matrix(sourceTargetSegment);
+        sourceTargetSlack_v2 = dualSlack_v2.matrix(sourceTargetSegment);
+        sourceTargetDirection = dualDirection.matrix(sourceTargetSegment);
+    }
+    if(flowSegment != -1){
+        lagrangianMultiplierFlow = dualMultiplier.matrix(flowSegment);
+        lagrangianSCFlow = dualStabilityCenter.matrix(flowSegment);
+        flowSlack = dualSlack.matrix(flowSegment);
+        flowSlack_v2 = dualSlack_v2.matrix(flowSegment);
+        flowDirection = dualDirection.matrix(flowSegment);
+    }
+    if(overlapSegment != -1){
+        lagrangianMultiplierOverlap = dualMultiplier.matrix(overlapSegment);
+        lagrangianSCOverlap = dualStabilityCenter.matrix(overlapSegment);
+        overlapSlack = dualSlack.matrix(overlapSegment);
+        overlapSlack_v2 = dualSlack_v2.matrix(overlapSegment);
+        overlapDirection = dualDirection.matrix(overlapSegment);
+    }
+    if(oneSlicePerDemandSegment != -1){
+        lagrangianMultiplierOneSlicePerDemand = dualMultiplier.matrix(oneSlicePerDemandSegment);
+        lagrangianSCOneSlicePerDemand = dualStabilityCenter.matrix(oneSlicePerDemandSegment);
+        oneSlicePerDemandSlack = dualSlack.matrix(oneSlicePerDemandSegment);
+        oneSlicePerDemandSlack_v2 = dualSlack_v2.matrix(oneSlicePerDemandSegment);
+        oneSlicePerDemandDirection = dualDirection.matrix(oneSlicePerDemandSegment);
+    }
+    if(maxUsedSliceOverallSegment != -1){
+        lagrangianMultiplierMaxUsedSliceOverall = dualMultiplier.row(maxUsedSliceOverallSegment);
+        lagrangianSCMaxUsedSliceOverall = dualStabilityCenter.row(maxUsedSliceOverallSegment);
+        maxUsedSliceOverallSlack = dualSlack.row(maxUsedSliceOverallSegment);
+        maxUsedSliceOverallSlack_v2 = dualSlack_v2.row(maxUsedSliceOverallSegment);
+        maxUsedSliceOverallDirection = dualDirection.row(maxUsedSliceOverallSegment);
+    }
+    if(maxUsedSliceOverallAuxSegment != -1){
+        lagrangianMultiplierMaxUsedSliceOverallAux = dualMultiplier.row(maxUsedSliceOverallAuxSegment);
+        lagrangianSCMaxUsedSliceOverallAux = dualStabilityCenter.row(maxUsedSliceOverallAuxSegment);
+        maxUsedSliceOverallAuxSlack = dualSlack.row(maxUsedSliceOverallAuxSegment);
+        maxUsedSliceOverallAuxSlack_v2 = dualSlack_v2.row(maxUsedSliceOverallAuxSegment);
+        maxUsedSliceOverallAuxDirection = dualDirection.row(maxUsedSliceOverallAuxSegment);
+    }
+    if(maxUsedSliceOverall2Segment != -1){
+        lagrangianMultiplierMaxUsedSliceOverall2 = dualMultiplier.matrix(maxUsedSliceOverall2Segment);
+        lagrangianSCMaxUsedSliceOverall2 = dualStabilityCenter.matrix(maxUsedSliceOverall2Segment);
+        maxUsedSliceOverallSlack2 = dualSlack.matrix(maxUsedSliceOverall2Segment);
+        maxUsedSliceOverallSlack2_v2 = dualSlack_v2.matrix(maxUsedSliceOverall2Segment);
+        maxUsedSliceOverall2Direction = dualDirection.matrix(maxUsedSliceOverall2Segment);
+    }
+    if(maxUsedSliceOverall3Segment != -1){
+        lagrangianMultiplierMaxUsedSliceOverall3 = dualMultiplier.matrix(maxUsedSliceOverall3Segment);
+        lagrangianSCMaxUsedSliceOverall3 = dualStabilityCenter.matrix(maxUsedSliceOverall3Segment);
+        maxUsedSliceOverallSlack3 = dualSlack.matrix(maxUsedSliceOverall3Segment);
+        maxUsedSliceOverallSlack3_v2 = dualSlack_v2.matrix(maxUsedSliceOverall3Segment);
+        maxUsedSliceOverall3Direction = dualDirection.matrix(maxUsedSliceOverall3Segment);
     }
 }
 
-void AbstractLagFormulation::initializeOneSlicePerDemandSC(){
-    lagrangianSCOneSlicePerDemand.resize(instance.getNbEdges());
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        std::copy(lagrangianMultiplierOneSlicePerDemand[e].begin(), lagrangianMultiplierOneSlicePerDemand[e].end(),std::back_inserter(lagrangianSCOneSlicePerDemand[e]));
-    }
-}
+/************************************************ MULTIPLIERS ***************************************************/
 
-/* Sets the initial lagrangian stability center associated with maximum slice overall 1 constraints. */
-void AbstractLagFormulation::initializeMaxUsedSliceOverallSC(){
-    std::copy(lagrangianMultiplierMaxUsedSliceOverall.begin(), lagrangianMultiplierMaxUsedSliceOverall.end(),std::back_inserter(lagrangianSCMaxUsedSliceOverall));
+/* Sets the initial lagrangian multipliers associated with length constraints. */
+void AbstractLagFormulation::initializeLengthMultipliers(double initialMultiplier){  
+    dualMultiplier.fill(lengthSegment, initialMultiplier);
 }
 
-/* Sets the initial lagrangian stability center associated with maximum slice overall 1 constraints. */
-void AbstractLagFormulation::initializeMaxUsedSliceOverallAuxSC(){
-    std::copy(lagrangianMultiplierMaxUsedSliceOverallAux.begin(), lagrangianMultiplierMaxUsedSliceOverallAux.end(),std::back_inserter(lagrangianSCMaxUsedSliceOverallAux));
+/* Sets the initial lagrangian multipliers associated with source/target constraints*/
+void AbstractLagFormulation::initializeSourceTargetMultipliers(double initialMultiplier){
+    dualMultiplier.fill(sourceTargetSegment, initialMultiplier);
 }
 
-/* Sets the initial lagrangian stability center associated with maximum slice overall 2 constraints. */
-void AbstractLagFormulation::initializeMaxUsedSliceOverall2SC(){
-    lagrangianSCMaxUsedSliceOverall2.resize(instance.getNbEdges());
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        std::copy(lagrangianSCMaxUsedSliceOverall2[e].begin(), lagrangianSCMaxUsedSliceOverall2[e].end(),std::back_inserter(lagrangianSCMaxUsedSliceOverall2[e]));
+/* Sets the initial lagrangian multipliers associated with flow constraints */
+void AbstractLagFormulation::initializeFlowMultipliers(double initialMultiplier){
+    dualMultiplier.fill(flowSegment, initialMultiplier);
+    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+        lagrangianMultiplierFlow[d][getSourceNodeIndex(d)] = 0.0;
+        lagrangianMultiplierFlow[d][getTargetNodeIndex(d)] = 0.0;
     }
 }
 
-/* Sets the initial lagrangian stability center associated with maximum slice overall 3 constraints. */
-void AbstractLagFormulation::initializeMaxUsedSliceOverall3SC(){
-    lagrangianSCMaxUsedSliceOverall3.resize(instance.getNbNodes());
-    for (int v = 0; v < instance.getNbNodes(); v++){
-        std::copy(lagrangianSCMaxUsedSliceOverall3[v].begin(), lagrangianSCMaxUsedSliceOverall3[v].end(),std::back_inserter(lagrangianSCMaxUsedSliceOverall3[v]));
-    }
+/* Sets the initial lagrangian multipliers associated with non-overlapping constraints. */
+void AbstractLagFormulation::initializeOverlapMultipliers(double initialMultiplier){
+    dualMultiplier.fill(overlapSegment, initialMultiplier);
 }
 
-/**************************************************** SLACKS *******************************************************/
+/* Sets the nitial lagrangian multipliers associated with one slice per demand constraints. */
+void AbstractLagFormulation::initializeOneSlicePerDemandMultipliers(double initialMultiplier){
+    dualMultiplier.fill(oneSlicePerDemandSegment, initialMultiplier);
+}
 
-/* Initializes the slack of Length constraints. */ 
-void AbstractLagFormulation::initializeLengthSlacks(){
-    lengthSlack.resize(getNbDemandsToBeRouted(), 1.0);
+/* Sets the initial lagrangian multipliers associated with maximum slice overall 1 constraints. */
+void AbstractLagFormulation::initializeMaxUsedSliceOverallMultipliers(double initialMultiplier){
+    dualMultiplier.fill(maxUsedSliceOverallSegment, initialMultiplier);
 }
 
-/* Initializes the slack of Source/Target constraints. */
-void AbstractLagFormulation::initializeSourceTargetSlacks(){
-    sourceTargetSlack.resize(getNbDemandsToBeRouted());
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        sourceTargetSlack[d].resize(instance.getNbNodes(),1.0);
-    }
+/* Sets the initial lagrangian multipliers associated with maximum slice overall 1 (auxiliary) constraints. */
+void AbstractLagFormulation::initializeMaxUsedSliceOverallAuxMultipliers(double initialMultiplier){
+    dualMultiplier.fill(maxUsedSliceOverallAuxSegment, initialMultiplier);
 }
 
-/* Initializes the slack of Flow constraints. */
-void AbstractLagFormulation::initializeFlowSlacks(){
-    flowSlack.resize(getNbDemandsToBeRouted());
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        flowSlack[d].resize(countNodes(*vecGraph[d]),0.0);
-    }
+/* Sets the initial lagrangian multipliers associated with maximum slice overall 2 constraints. */
+void AbstractLagFormulation::initializeMaxUsedSliceOverall2Multipliers(double initialMultiplier){
+    dualMultiplier.fill(maxUsedSliceOverall2Segment, initialMultiplier);
 }
 
-/* Initializes the slack of non-overlap constraints. */
-void AbstractLagFormulation::initializeOverlapSlacks(){
-    overlapSlack.resize(instance.getNbEdges());
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        overlapSlack[e].resize(auxNbSlicesLimitFromEdge[e],1.0);
+/* Sets the initial lagrangian multipliers associated with maximum slice overall 3 constraints. */
+void AbstractLagFormulation::initializeMaxUsedSliceOverall3Multipliers(double initialMultiplier){
+    dualMultiplier.fill(maxUsedSliceOverall3Segment, initialMultiplier);
+}
+
+/*************************************************** WARM START *****************************************************/
+
+/* Replaces the initial multipliers by the ones kept from previous solves. */
+void AbstractLagFormulation::initStoredMultipliers(){
+    if(multiplierStore == NULL || multiplierStore->empty()){
+        return;
+    }
+    int nbLoaded = loadMultipliers(*multiplierStore);
+    std::cout << "> " << nbLoaded << " of " << dualMultiplier.size() << " Lagrangian multipliers were taken from previous solves. " << std::endl;
+}
+
+/* Copies the stored multipliers of the relaxed constraints. Multipliers of demands that were not stored (or whose
+source, target or load changed) keep their initial value. */
+int AbstractLagFormulation::loadMultipliers(const MultiplierStore &store){
+    initDualStorage();
+    std::vector<bool> known(getNbDemandsToBeRouted(), false);
+    for (int k = 0; k < getNbDemandsToBeRouted(); k++){
+        Demand demand = getToBeRouted_k(k);
+        known[k] = store.hasDemand(demand.getId(), demand.getSource(), demand.getTarget(), demand.getLoad());
+    }
+    int nbLoaded = 0;
+    nbLoaded += loadSegment(store, MultiplierStore::LENGTH, lengthSegment, false, true, known);
+    nbLoaded += loadSegment(store, MultiplierStore::SOURCE_TARGET, sourceTargetSegment, true, false, known);
+    nbLoaded += loadFlowSegment(store, known);
+    nbLoaded += loadSegment(store, MultiplierStore::OVERLAP, overlapSegment, false, false, known);
+    nbLoaded += loadSegment(store, MultiplierStore::ONE_SLICE_PER_DEMAND, oneSlicePerDemandSegment, false, true, known);
+    nbLoaded += loadSegment(store, MultiplierStore::MAX_USED_SLICE_OVERALL, maxUsedSliceOverallSegment, false, true, known);
+    nbLoaded += loadSegment(store, MultiplierStore::MAX_USED_SLICE_OVERALL_AUX, maxUsedSliceOverallAuxSegment, false, true, known);
+    nbLoaded += loadSegment(store, MultiplierStore::MAX_USED_SLICE_OVERALL_2, maxUsedSliceOverall2Segment, false, false, known);
+    nbLoaded += loadSegment(store, MultiplierStore::MAX_USED_SLICE_OVERALL_3, maxUsedSliceOverall3Segment, false, false, known);
+
+    /* Stored values may come from a problem with other fixed multipliers. */
+    double *multiplier = dualMultiplier.data();
+    const double *lower = dualLower.data();
+    const double *upper = dualUpper.data();
+    for (int i = 0; i < dualMultiplier.size(); i++){
+        multiplier[i] = std::min(std::max(multiplier[i], lower[i]), upper[i]);
+    }
+    return nbLoaded;
+}
+
+/* Saves the multipliers of the relaxed constraints, together with the demands they refer to. */
+void AbstractLagFormulation::storeMultipliers(MultiplierStore &store) const{
+    for (int k = 0; k < getNbDemandsToBeRouted(); k++){
+        Demand demand = getToBeRouted_k(k);
+        store.setDemand(demand.getId(), demand.getSource(), demand.getTarget(), demand.getLoad());
+    }
+    storeSegment(store, MultiplierStore::LENGTH, lengthSegment, false, true);
+    storeSegment(store, MultiplierStore::SOURCE_TARGET, sourceTargetSegment, true, false);
+    storeFlowSegment(store);
+    storeSegment(store, MultiplierStore::OVERLAP, overlapSegment, false, false);
+    storeSegment(store, MultiplierStore::ONE_SLICE_PER_DEMAND, oneSlicePerDemandSegment, false, true);
+    storeSegment(store, MultiplierStore::MAX_USED_SLICE_OVERALL, maxUsedSliceOverallSegment, false, true);
+    storeSegment(store, MultiplierStore::MAX_USED_SLICE_OVERALL_AUX, maxUsedSliceOverallAuxSegment, false, true);
+    storeSegment(store, MultiplierStore::MAX_USED_SLICE_OVERALL_2, maxUsedSliceOverall2Segment, false, false);
+    storeSegment(store, MultiplierStore::MAX_USED_SLICE_OVERALL_3, maxUsedSliceOverall3Segment, false, false);
+}
+
+/*************************************************** HOT START *****************************************************/
+
+/* Saves the dual and primal state reached at the current node, so that strong branching candidates can all start from it. */
+void AbstractLagFormulation::saveHotStart(HotStartState &state) const{
+    state.multiplier.assign(dualMultiplier.data(), dualMultiplier.data() + dualMultiplier.size());
+    state.stabilityCenter.assign(dualStabilityCenter.data(), dualStabilityCenter.data() + dualStabilityCenter.size());
+    state.primalSlack.assign(dualSlack_v2.data(), dualSlack_v2.data() + dualSlack_v2.size());
+    state.primalSolution = primal_linear_solution;
+    state.primalMaxUsedSliceOverall = primalMaxUsedSliceOverall;
+    state.primalVarAuxZ = primalVarAuxZ;
+    state.primalCost = currentPrimalCost;
+    state.valid = true;
+}
+
+/* Puts back a saved state. The layout does not change between hot starts (only bounds do), so the sizes match. */
+void AbstractLagFormulation::restoreHotStart(const HotStartState &state){
+    if(!state.valid || (int)state.multiplier.size() != dualMultiplier.size()){
+        return;
+    }
+    std::copy(state.multiplier.begin(), state.multiplier.end(), dualMultiplier.data());
+    std::copy(state.stabilityCenter.begin(), state.stabilityCenter.end(), dualStabilityCenter.data());
+    std::copy(state.primalSlack.begin(), state.primalSlack.end(), dualSlack_v2.data());
+    primal_linear_solution = state.primalSolution;
+    primalMaxUsedSliceOverall = state.primalMaxUsedSliceOverall;
+    primalVarAuxZ = state.primalVarAuxZ;
+    currentPrimalCost = state.primalCost;
+}
+
+int AbstractLagFormulation::loadSegment(const MultiplierStore &store, MultiplierStore::Family family, int segment, bool demandRows, bool demandColumns, const std::vector<bool> &known){
+    if(segment == -1){
+        return 0;
+    }
+    int nbLoaded = 0;
+    double *multiplier = dualMultiplier.data();
+    const int *rowStart = dualLayout.getRowStart(segment);
+    for (int i = 0; i < dualLayout.getNbRows(segment); i++){
+        if(demandRows && !known[i]){
+            continue;
+        }
+        int first = demandRows ? getToBeRouted_k(i).getId() : i;
+        for (int j = 0; j < rowStart[i+1] - rowStart[i]; j++){
+            if(demandColumns && !known[j]){
+                continue;
+            }
+            int second = demandColumns ? getToBeRouted_k(j).getId() : j;
+            if(store.get(family, first, second, multiplier[rowStart[i] + j])){
+                nbLoaded++;
+            }
+        }
     }
+    return nbLoaded;
 }
 
-/* Initializes the slack of one slice per demand constraints. */
-void AbstractLagFormulation::initializeOneSlicePerDemandSlacks(){
-    oneSlicePerDemandSlack.resize(instance.getNbEdges());
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        oneSlicePerDemandSlack[e].resize(getNbDemandsToBeRouted(),1.0);
+void AbstractLagFormulation::storeSegment(MultiplierStore &store, MultiplierStore::Family family, int segment, bool demandRows, bool demandColumns) const{
+    if(segment == -1){
+        return;
+    }
+    const double *multiplier = dualMultiplier.data();
+    const int *rowStart = dualLayout.getRowStart(segment);
+    for (int i = 0; i < dualLayout.getNbRows(segment); i++){
+        int first = demandRows ? getToBeRouted_k(i).getId() : i;
+        for (int j = 0; j < rowStart[i+1] - rowStart[i]; j++){
+            int second = demandColumns ? getToBeRouted_k(j).getId() : j;
+            store.set(family, first, second, multiplier[rowStart[i] + j]);
+        }
     }
 }
 
-/* Initializes the slack of maximum used slice overall 1 constraints. */
-void AbstractLagFormulation::initializeMaxUsedSliceOverallSlacks(){
-    maxUsedSliceOverallSlack.resize(getNbDemandsToBeRouted(),0.0);
+/* Flow rows are indexed by the nodes of the demand graph, whose indices change with the batch and the preprocessing:
+the store keys them by node label and slice instead. */
+int AbstractLagFormulation::loadFlowSegment(const MultiplierStore &store, const std::vector<bool> &known){
+    if(flowSegment == -1){
+        return 0;
+    }
+    int nbLoaded = 0;
+    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+        if(!known[d]){
+            continue;
+        }
+        int id = getToBeRouted_k(d).getId();
+        for (ListDigraph::NodeIt v(*vecGraph[d]); v != INVALID; ++v){
+            if(store.get(MultiplierStore::FLOW, id, getNodeLabel(v, d), getNodeSlice(v, d), lagrangianMultiplierFlow[d][getNodeIndex(v, d)])){
+                nbLoaded++;
+            }
+        }
+    }
+    return nbLoaded;
 }
 
-/* Initializes the slack of maximum used slice overall 1 (auxiliary) constraints. */
-void AbstractLagFormulation::initializeMaxUsedSliceOverallAuxSlacks(){
-    maxUsedSliceOverallAuxSlack.resize(getNbDemandsToBeRouted(),0.0);
+void AbstractLagFormulation::storeFlowSegment(MultiplierStore &store) const{
+    if(flowSegment == -1){
+        return;
+    }
+    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+        int id = getToBeRouted_k(d).getId();
+        for (ListDigraph::NodeIt v(*vecGraph[d]); v != INVALID; ++v){
+            store.set(MultiplierStore::FLOW, id, getNodeLabel(v, d), getNodeSlice(v, d), lagrangianMultiplierFlow[d][getNodeIndex(v, d)]);
+        }
+    }
 }
 
-/* Initializes the slack of maximum used slice overall 2 constraints. */
-void AbstractLagFormulation::initializeMaxUsedSliceOverall2Slacks(){
-    maxUsedSliceOverallSlack2.resize(instance.getNbEdges());
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        maxUsedSliceOverallSlack2[e].resize(auxNbSlicesLimitFromEdge[e],0.0);
-    }
+/************************************************ STABILITY CENTER ***************************************************/
+
+/** Sets the initial lagrangian stability center: the current multipliers. **/
+void AbstractLagFormulation::initStabilityCenter(){
+    dualStabilityCenter.copy(dualMultiplier);
 }
 
-/* Initializes the slack of maximum used slice overall 3 constraints. */
-void AbstractLagFormulation::initializeMaxUsedSliceOverall3Slacks(){
-    maxUsedSliceOverallSlack3.resize(instance.getNbNodes());
-    for (int v = 0; v < instance.getNbNodes(); v++){
-        maxUsedSliceOverallSlack3[v].resize(auxNbSlicesGlobalLimit,0.0);
-    }
+/**************************************************** SLACKS *******************************************************/
+
+/* Initializes the slack of relaxed constraints. */ 
+void AbstractLagFormulation::initSlacks(){
+    dualSlack.fill(0.0);
+    resetSlacks();
 }
 
 /*********************************************** RESET SLACKS *******************************************************/
@@ -560,132 +809,16 @@ void AbstractLagFormulation::resetMaxUsedSliceOverall3Slacks(){
 
 /********************************************* SLACKS CONSIDERING PRIMAL VARIABLES ********************************************/
 
-/* Initializes the slack (primal approximation) of Length constraints. */ 
-void AbstractLagFormulation::initializeLengthPrimalSlacks(){
-    std::copy(lengthSlack.begin(),lengthSlack.end(),std::back_inserter(lengthSlack_v2));
-}
-
-/* Initializes the slack (primal approximation) of Source/Target constraints. */
-void AbstractLagFormulation::initializeSourceTargetPrimalSlacks(){
-    sourceTargetSlack_v2.resize(getNbDemandsToBeRouted());
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        std::copy(sourceTargetSlack[d].begin(),sourceTargetSlack[d].end(),std::back_inserter(sourceTargetSlack_v2[d]));
-    }
-}
-
-/* Initializes the slack (primal approximation) of Flow constraints. */
-void AbstractLagFormulation::initializeFlowPrimalSlacks(){
-    flowSlack_v2.resize(getNbDemandsToBeRouted());
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        std::copy(flowSlack[d].begin(),flowSlack[d].end(),std::back_inserter(flowSlack_v2[d]));
-    }
-}
-
-/* Initializes the slack (primal approximation) of non-overlap constraints. */
-void AbstractLagFormulation::initializeOverlapPrimalSlacks(){
-    overlapSlack_v2.resize(instance.getNbEdges());
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        std::copy(overlapSlack[e].begin(),overlapSlack[e].end(),std::back_inserter(overlapSlack_v2[e]));
-    }
-}
-
-/* Initializes the slack (primal approximation) of one slice per demand constraints. */
-void AbstractLagFormulation::initializeOneSlicePerDemandPrimalSlacks(){
-    oneSlicePerDemandSlack_v2.resize(instance.getNbEdges());
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        std::copy(oneSlicePerDemandSlack[e].begin(),oneSlicePerDemandSlack[e].end(),std::back_inserter(oneSlicePerDemandSlack_v2[e]));
-    }
-}
-
-/* Initializes the slack (primal approximation) of maximum used slice overall 1 constraints. */
-void AbstractLagFormulation::initializeMaxUsedSliceOverallPrimalSlacks(){
-    std::copy(maxUsedSliceOverallSlack.begin(),maxUsedSliceOverallSlack.end(),std::back_inserter(maxUsedSliceOverallSlack_v2));
-}
-
-/* Initializes the slack (primal approximation) of maximum used slice overall 1 (auxiliary) constraints. */
-void AbstractLagFormulation::initializeMaxUsedSliceOverallAuxPrimalSlacks(){
-    std::copy(maxUsedSliceOverallAuxSlack.begin(),maxUsedSliceOverallAuxSlack.end(),std::back_inserter(maxUsedSliceOverallAuxSlack_v2));
-}
-
-/* Initializes the slack (primal approximation) of maximum used slice overall 2 constraints. */
-void AbstractLagFormulation::initializeMaxUsedSliceOverall2PrimalSlacks(){
-    maxUsedSliceOverallSlack2_v2.resize(instance.getNbEdges());
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        std::copy(maxUsedSliceOverallSlack2[e].begin(),maxUsedSliceOverallSlack2[e].end(),std::back_inserter(maxUsedSliceOverallSlack2_v2[e]));
-    }
-}
-
-/* Initializes the slack (primal approximation) of maximum used slice overall 3 constraints. */
-void AbstractLagFormulation::initializeMaxUsedSliceOverall3PrimalSlacks(){
-    maxUsedSliceOverallSlack3.resize(instance.getNbNodes());
-    for (int v = 0; v < instance.getNbNodes(); v++){
-        std::copy(maxUsedSliceOverallSlack3[v].begin(),maxUsedSliceOverallSlack3[v].end(),std::back_inserter(maxUsedSliceOverallSlack3_v2[v]));
-    }
+/* Initializes the slack (primal approximation) of relaxed constraints. */ 
+void AbstractLagFormulation::initPrimalSlacks(){
+    dualSlack_v2.copy(dualSlack);
 }
 
 /******************************************************* DIRECTION ***********************************************/
 
-/* Initializes the direction of Length constraints. */ 
-void AbstractLagFormulation::initializeLengthDirection(){
-    std::copy(lengthSlack.begin(), lengthSlack.end(),std::back_inserter(lengthDirection));
-}
-
-/* Initializes the direction of Source/Target constraints. */
-void AbstractLagFormulation::initializeSourceTargetDirection(){
-    sourceTargetDirection.resize(getNbDemandsToBeRouted());
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        std::copy(sourceTargetSlack[d].begin(), sourceTargetSlack[d].end(),std::back_inserter(sourceTargetDirection[d]));
-    }
-}
-
-/* Initializes the direction of flow constraints. */
-void AbstractLagFormulation::initializeFlowDirection(){
-    flowDirection.resize(getNbDemandsToBeRouted());
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        std::copy(flowSlack[d].begin(), flowSlack[d].end(),std::back_inserter(flowDirection[d]));
-    }
-}
-
-/* Initializes the direction of overlap constraints. */
-void AbstractLagFormulation::initializeOverlapDirection(){
-    overlapDirection.resize(instance.getNbEdges());
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        std::copy(overlapSlack[e].begin(), overlapSlack[e].end(),std::back_inserter(overlapDirection[e]));
-    }
-}
-
-/* Initializes the direction of one slice per demand constraints. */
-void AbstractLagFormulation::initializeOneSlicePerDemandDirection(){
-    oneSlicePerDemandDirection.resize(instance.getNbEdges());
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        std::copy(oneSlicePerDemandSlack[e].begin(), oneSlicePerDemandSlack[e].end(),std::back_inserter(oneSlicePerDemandDirection[e]));
-    }
-}
-
-/* Initializes the direction of maximum used slice overall 1 constraints. */
-void AbstractLagFormulation::initializeMaxUsedSliceOverallDirection(){
-    std::copy(maxUsedSliceOverallSlack.begin(), maxUsedSliceOverallSlack.end(),std::back_inserter(maxUsedSliceOverallDirection));
-}
-
-/* Initializes the direction of maximum used slice overall 1 (auxiliary) constraints. */
-void AbstractLagFormulation::initializeMaxUsedSliceOverallAuxDirection(){
-    std::copy(maxUsedSliceOverallAuxSlack.begin(), maxUsedSliceOverallAuxSlack.end(),std::back_inserter(maxUsedSliceOverallAuxDirection));
-}
-
-/* Initializes the direction of maximum used slice overall 2 constraints. */
-void AbstractLagFormulation::initializeMaxUsedSliceOverall2Direction(){
-    maxUsedSliceOverall2Direction.resize(instance.getNbEdges());
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        std::copy(maxUsedSliceOverallSlack2[e].begin(), maxUsedSliceOverallSlack2[e].end(),std::back_inserter(maxUsedSliceOverall2Direction[e]));
-    }
-}
-
-/* Initializes the direction of maximum used slice overall 3 constraints. */
-void AbstractLagFormulation::initializeMaxUsedSliceOverall3Direction(){
-    maxUsedSliceOverall3Direction.resize(instance.getNbNodes());
-    for (int v = 0; v < instance.getNbNodes(); v++){
-        std::copy(maxUsedSliceOverallSlack3[v].begin(), maxUsedSliceOverallSlack3[v].end(),std::back_inserter(maxUsedSliceOverall3Direction[v]));
-    }
+/* Initializes the direction of relaxed constraints. */ 
+void AbstractLagFormulation::initDirection(){
+    dualDirection.copy(dualSlack);
 }
 
 /************************************************** ASSIGNMENT MATRIX *************************************************/
@@ -739,17 +872,24 @@ void AbstractLagFormulation::initBestFeasibleSolution(){
 
 /* Initializes the coefficients in the objective function ( according to chosen objective function). */
 void AbstractLagFormulation::initCoeff(){
-    /* Sets the map used in the Lagrangian. */
-    operatorSliceCoefficient operSliceCoeff; // operator to modify keep the slice value just when arc leaves the source
-    operatorCoefficient operCoeff(getInstance().getInput().getChosenObj_k(0)); // operator to return the objective function coefficient.
+    /* Sets the map used in the Lagrangian from the coefficients of the formulation. Objectives 1p and 8 are not summed over the arcs: they are handled by the max slice variables. Objective 1 is the slice (+1) of the arcs leaving the source, whatever the partition policy. */
+    Input::ObjectiveMetric chosenObj = instance.getInput().getChosenObj_k(0);
+    bool summedOverArcs = (chosenObj != Input::OBJECTIVE_METRIC_1p) && (chosenObj != Input::OBJECTIVE_METRIC_8);
     for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        operSliceCoeff.setSource(getFirstNodeFromLabel(d, getToBeRouted_k(d).getSource()));
-        operCoeff.setDemandLoad(getToBeRouted_k(d).getLoad());
-        SourceMap<ListDigraph> sourceMap((*vecGraph[d])); // Map of the source nodes of the arcs
-        CombineMapCoeffSlice combineMapCS((*vecArcSlice[d]),sourceMap,operSliceCoeff); 
-        CombineMapCoeff combineMap((*vecArcLength[d]),combineMapCS,operCoeff);
         coeff.emplace_back(std::make_shared<ArcCost>((*vecGraph[d]), 0.0)); 
-        mapCopy<ListDigraph,CombineMapCoeff,ArcCost>((*vecGraph[d]),combineMap,(*coeff[d])); // Copy to standard map to an easier utilization
+        if (chosenObj == Input::OBJECTIVE_METRIC_1){
+            operatorSliceCoefficient operSliceCoeff;
+            operSliceCoeff.setSource(getFirstNodeFromLabel(d, getToBeRouted_k(d).getSource()));
+            SourceMap<ListDigraph> sourceMap((*vecGraph[d]));
+            CombineMapCoeffSlice combineMapCS((*vecArcSlice[d]),sourceMap,operSliceCoeff);
+            mapCopy<ListDigraph,CombineMapCoeffSlice,ArcCost>((*vecGraph[d]),combineMapCS,(*coeff[d]));
+        }
+        else if (summedOverArcs){
+            const std::vector<double> &coeffs = getCoeffArray(chosenObj, d);
+            for (ListDigraph::ArcIt a(*vecGraph[d]); a != INVALID; ++a){
+                (*coeff[d])[a] = coeffs[getArcIndex(a, d)];
+            }
+        }
     }
 
     /* Sets an special map for the objective 8, this will be the map used in the heuristic. */
@@ -776,289 +916,33 @@ void AbstractLagFormulation::setCoeffMapObj8() {
 **************************************************************************************************************** */
 
 /*************************************************** MULTIPLIERS **************************************************/
+/* The relaxed constraints are <=, they are passed to >= as it is a minimization problem: the violation is minus the
+direction. The multipliers of inequalities are >= 0, the ones of equalities are real numbers. */
 
-/** Updates length multipliers **/
-void AbstractLagFormulation::updateLengthMultiplier(double step){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        double violation = -getLengthDirection_k(d); /* the constraint is <=, we have to pass to >= as it is a minimization problem*/
-        double new_multipliplier = getLengthMultiplier_k(d) + (step*violation);
-        setLengthMultiplier_k(d, std::max(new_multipliplier, 0.0)); /* the multiplier is >=0 */
-    }
-}
-
-/** Updates source target multipliers **/
-void AbstractLagFormulation::updateSourceTargetMultiplier(double step){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        for (int v = 0; v < instance.getNbNodes(); v++){ 
-            if((v == getToBeRouted_k(d).getSource()) || v == getToBeRouted_k(d).getTarget()){
-                double violation = -getSourceTargetDirection_k(d,v);
-                double new_multipliplier = getSourceTargetMultiplier_k(d,v) + (step*violation); /* equality */
-                setSourceTargetMultiplier_k(d,v,new_multipliplier); /* multiplier is a real number*/
-            }else{
-                double violation = -getSourceTargetDirection_k(d,v); /* the original constraints are <=, we have to change to >= because it is a min problem*/
-                double new_multipliplier = getSourceTargetMultiplier_k(d,v) + (step*violation);
-                setSourceTargetMultiplier_k(d,v,std::max(new_multipliplier, 0.0)); /* multiplier >= 0*/
-            }
-        }
-    }
-}
-
-/** Updates flow multipliers **/
-void AbstractLagFormulation::updateFlowMultiplier(double step){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        for (int v = 0; v < countNodes(*vecGraph[d]); v++){
-            if(v != getTargetNodeIndex(d) && v != getSourceNodeIndex(d)){
-                double violation = -getFlowDirection_k(d,v);
-                double new_multiplier = getFlowMultiplier_k(d,v) + (step*violation); /* equality */
-                setFlowMultiplier_k(d,v,new_multiplier); /* multiplier is a real number*/
-                //std::cout << "Flow multiplier " << d << " " << v << " " <<  new_multipliplier << std::endl;
-            }
-        }
-    }
-}
-
-/** update overlap multipliers **/
-void AbstractLagFormulation::updateOverlapMultiplier(double step){
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        for (int s = 0; s < auxNbSlicesLimitFromEdge[e]; s++){
-            double violation = -getOverlapDirection_k( e, s);
-            double new_multipliplier = getOverlapMultiplier_k( e, s) + (step*violation);
-            setOverlapMultiplier_k( e, s, std::max(new_multipliplier, 0.0));
-        }
-    }  
-}
-
-/** update one slice per demand multipliers **/
-void AbstractLagFormulation::updateOneSlicePerDemandMultiplier(double step){
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-            double violation = -getOneSlicePerDemandDirection_k(e,d);
-            double new_multipliplier = getOneSlicePerDemandMultiplier_k(e,d) +(step*violation);
-            setOneSlicePerDemandMultiplier_k(e,d,std::max(new_multipliplier, 0.0));
-        }
-    }
-}
-
-/** update maximum used slice overall 1 multipliers **/
-void AbstractLagFormulation::updateMaxUsedSliceOverallMultiplier(double step){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        double violation = -getMaxUsedSliceOverallDirection_k(d);
-        double new_multipliplier = getMaxUsedSliceOverallMultiplier_k(d) + (step*violation);
-        setMaxUsedSliceOverallMultiplier_k(d,std::max(new_multipliplier, 0.0));
-    }
-}
-
-/** update maximum used slice overall 1 (auxiliary) multipliers **/
-void AbstractLagFormulation::updateMaxUsedSliceOverallAuxMultiplier(double step){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        double violation = -getMaxUsedSliceOverallAuxDirection_k(d);
-        double new_multipliplier = getMaxUsedSliceOverallAuxMultiplier_k(d) + (step*violation);
-        setMaxUsedSliceOverallAuxMultiplier_k(d,std::max(new_multipliplier, 0.0));
-    }
-}
-
-/** update maximum used slice overall 2 multipliers **/
-void AbstractLagFormulation::updateMaxUsedSliceOverall2Multiplier(double step){
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        for (int s = 0; s < auxNbSlicesLimitFromEdge[e]; s++){
-            double violation = -getMaxUsedSliceOverall2Direction_k(e,s);
-            double new_multipliplier = getMaxUsedSliceOverall2Multiplier_k(e,s) + (step*violation);
-            setMaxUsedSliceOverall2Multiplier_k(e,s,std::max(new_multipliplier, 0.0)); 
-        }
-    }
-}
-
-/** update maximum used slice overall 3 multipliers **/
-void AbstractLagFormulation::updateMaxUsedSliceOverall3Multiplier(double step){
-    for (int v = 0; v < instance.getNbNodes(); v++){
-        for (int s = 0; s < auxNbSlicesGlobalLimit; s++){
-            double violation = -getMaxUsedSliceOverall3Direction_k(v,s);
-            double new_multipliplier = getMaxUsedSliceOverall3Multiplier_k(v,s) + (step*violation);
-            setMaxUsedSliceOverall3Multiplier_k(v,s,std::max(new_multipliplier, 0.0)); 
-        }
-    }
+/** Updates the multipliers of all relaxed constraints. **/
+void AbstractLagFormulation::updateMultiplier(double step){
+    dualProjectedStep(dualMultiplier.data(), dualMultiplier.data(), dualDirection.data(), dualLower.data(), dualUpper.data(), step, dualMultiplier.size());
 }
 
 /********************************** MULTIPLIER CONSIDERING THE STABILITY CENTER *********************************/
-/* These methods are used in the Volume Algorithm. */
-
-/** update length multipliers considering stability center - volume**/
-void AbstractLagFormulation::updateLengthMultiplier_v2(double step){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        double violation = -getLengthSlack_v2_k(d); /* the constraint is <=, we have to pass to >= as it is a minimization problem*/
-        double new_multipliplier = getLengthSC_k(d) + (step*violation);
-        setLengthMultiplier_k(d, std::max(new_multipliplier, 0.0)); /* the multiplier is >=0 */
-    }
-}
-
-/** update source/target multipliers considering stability center - volume**/
-void AbstractLagFormulation::updateSourceTargetMultiplier_v2(double step){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        for (int v = 0; v < instance.getNbNodes(); v++){ 
-            if((v == getToBeRouted_k(d).getSource()) || v == getToBeRouted_k(d).getTarget()){
-                double violation = -getSourceTargetSlack_v2_k(d,v);
-                double new_multipliplier = getSourceTargetSC_k(d,v) + (step*violation); /* equality */
-                setSourceTargetMultiplier_k(d,v,new_multipliplier); /* multiplier is a real number*/
-
-            }else{
-                double violation = -getSourceTargetSlack_v2_k(d,v); /* the original constraints are <=, we have to change to >= because it is a min problem*/
-                double new_multipliplier = getSourceTargetSC_k(d,v) + (step*violation);
-                setSourceTargetMultiplier_k(d,v,std::max(new_multipliplier, 0.0)); /* multiplier >= 0*/
-            }
-        }
-    }
-}
 
-/** update flow multipliers considering stability center - volume**/
-void AbstractLagFormulation::updateFlowMultiplier_v2(double step){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        for (int v = 0; v < countNodes(*vecGraph[d]); v++){
-            if(v != getTargetNodeIndex(d) && v != getSourceNodeIndex(d)){
-                double violation = -getFlowSlack_v2_k(d,v);
-                double new_multipliplier = getFlowSC_k(d,v) + (step*violation); /* equality */
-                setFlowMultiplier_k(d,v,new_multipliplier); /* multiplier is a real number*/
-            }
-        }
-    }
+/** Updates the multipliers of all relaxed constraints from the stability center, following the slack of the primal
+approximation. **/
+void AbstractLagFormulation::updateMultiplier_v2(double step){
+    dualProjectedStep(dualMultiplier.data(), dualStabilityCenter.data(), dualSlack_v2.data(), dualLower.data(), dualUpper.data(), step, dualMultiplier.size());
 }
 
-/** Updates overlap  multipliers considering stability center - volume**/
-void AbstractLagFormulation::updateOverlapMultiplier_v2(double step){
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        for (int s = 0; s < auxNbSlicesLimitFromEdge[e]; s++){
-            double violation = -getOverlapSlack_v2_k( e, s);
-            double new_multipliplier = getOverlapSC_k( e, s) + (step*violation);
-            setOverlapMultiplier_k( e, s, std::max(new_multipliplier, 0.0));
-        }
-    }  
-}
-
-/** Updates one slice per demand  multipliers considering stability center - volume**/
-void AbstractLagFormulation::updateOneSlicePerDemandMultiplier_v2(double step){
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-            double violation = -getOneSlicePerDemandSlack_v2_k(e,d);
-            double new_multipliplier = getOneSlicePerDemandSC_k(e,d) + (step*violation);
-            setOneSlicePerDemandMultiplier_k(e,d,std::max(new_multipliplier,0.0));
-        }
-    }
-}
-
-/** Updates maximum used slice overall 1 multipliers considering stability center - volume**/
-void AbstractLagFormulation::updateMaxUsedSliceOverallMultiplier_v2(double step){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        double violation = -getMaxUsedSliceOverallSlack_v2_k(d);
-        double new_multipliplier = getMaxUsedSliceOverallSC_k(d) + (step*violation);
-        setMaxUsedSliceOverallMultiplier_k(d,std::max(new_multipliplier, 0.0));
-    }
-}
-
-/** Updates maximum used slice overall 1 (auxiliary) multipliers considering stability center - volume**/
-void AbstractLagFormulation::updateMaxUsedSliceOverallAuxMultiplier_v2(double step){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        double violation = -getMaxUsedSliceOverallAuxSlack_v2_k(d);
-        double new_multipliplier = getMaxUsedSliceOverallAuxSC_k(d) + (step*violation);
-        setMaxUsedSliceOverallAuxMultiplier_k(d,std::max(new_multipliplier, 0.0));
-    }
-}
-
-/** Updates maximum used slice overall 2 multipliers considering stability center - volume**/
-void AbstractLagFormulation::updateMaxUsedSliceOverall2Multiplier_v2(double step){
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        for (int s = 0; s < auxNbSlicesLimitFromEdge[e]; s++){
-            double violation = -getMaxUsedSliceOverall2Slack_v2_k(e,s);
-            double new_multipliplier = getMaxUsedSliceOverall2SC_k(e,s) + (step*violation);
-            setMaxUsedSliceOverall2Multiplier_k(e,s,std::max(new_multipliplier, 0.0)); 
-        }
-    }
-}
-
-/** Updates maximum used slice overall 3 multipliers considering stability center - volume**/
-void AbstractLagFormulation::updateMaxUsedSliceOverall3Multiplier_v2(double step){
-    for (int v = 0; v < instance.getNbNodes(); v++){
-        for (int s = 0; s < auxNbSlicesGlobalLimit; s++){
-            double violation = -getMaxUsedSliceOverall3Slack_v2_k(v,s);
-            double new_multipliplier = getMaxUsedSliceOverall3SC_k(v,s) + (step*violation);
-            setMaxUsedSliceOverall3Multiplier_k(v,s,std::max(new_multipliplier, 0.0)); 
-        }
-    }
+/** Updates the multipliers of all relaxed constraints from the stability center, following a direction given by the
+solver (e.g., the aggregated slack of the bundle method). With a step of 0, the multipliers go back to the stability center. **/
+void AbstractLagFormulation::updateMultiplierFromCenter(const double *direction, double step){
+    dualProjectedStep(dualMultiplier.data(), dualStabilityCenter.data(), direction, dualLower.data(), dualUpper.data(), step, dualMultiplier.size());
 }
 
 /************************************************ STABILITY CENTER ***************************************************/
 
-/* Updates length stability center */
-void AbstractLagFormulation::updateLengthSC(){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        setLengthSC_k(d, getLengthMultiplier_k(d)); 
-    }
-}
-
-/* Updates source/target stability center */
-void AbstractLagFormulation::updateSourceTargetSC(){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        for (int v = 0; v < instance.getNbNodes(); v++){ 
-            setSourceTargetSC_k(d,v,getSourceTargetMultiplier_k(d,v)); 
-        }
-    }
-}
-
-/* Updates flow stability center */
-void AbstractLagFormulation::updateFlowSC(){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        for (int v = 0; v < countNodes(*vecGraph[d]); v++){
-            setFlowSC_k(d,v, getFlowMultiplier_k(d,v)); 
-        }
-    }
-}
-
-/* Updates overlap stability center */
-void AbstractLagFormulation::updateOverlapSC(){
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        for (int s = 0; s < auxNbSlicesLimitFromEdge[e]; s++){
-            setOverlapSC_k( e, s, getOverlapMultiplier_k( e, s));
-        }
-    }  
-}
-
-/* Updates one slice per demand stability center */
-void AbstractLagFormulation::updateOneSlicePerDemandSC(){
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-            setOneSlicePerDemandSC_k(e,d,getOneSlicePerDemandMultiplier_k(e,d));
-        }
-    }
-}
-
-/* Updates maximum used slice overall 1 stability center */
-void AbstractLagFormulation::updateMaxUsedSliceOverallSC(){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        setMaxUsedSliceOverallSC_k(d,getMaxUsedSliceOverallMultiplier_k(d));
-    }
-}
-
-/* Updates maximum used slice overall 1 (auxiliary) stability center */
-void AbstractLagFormulation::updateMaxUsedSliceOverallAuxSC(){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        setMaxUsedSliceOverallAuxSC_k(d,getMaxUsedSliceOverallAuxMultiplier_k(d));
-    }
-}
-
-/* Updates maximum used slice overall 2 stability center */
-void AbstractLagFormulation::updateMaxUsedSliceOverall2SC(){
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        for (int s = 0; s < auxNbSlicesLimitFromEdge[e]; s++){
-            setMaxUsedSliceOverall2SC_k(e,s,getMaxUsedSliceOverall2Multiplier_k(e,s));
-        }
-    }
-}
-
-/* Updates maximum used slice overall 3 stability center */
-void AbstractLagFormulation::updateMaxUsedSliceOverall3SC(){
-    for (int v = 0; v < instance.getNbNodes(); v++){
-        for (int s = 0; s < auxNbSlicesGlobalLimit; s++){
-            setMaxUsedSliceOverall3SC_k(v,s,getMaxUsedSliceOverall3Multiplier_k(v,s));
-        }
-    }
+/** Updates the stability center: the current multipliers. **/
+void AbstractLagFormulation::updateStabilityCenter(){
+    dualStabilityCenter.copy(dualMultiplier);
 }
 
 /************************************************** SLACK ******************************************************/
@@ -1155,170 +1039,25 @@ void AbstractLagFormulation::updateMaxUsedSliceOverall3Slack(int d, const ListDi
 
 /********************************************** SLACK PRIMAL APPROXIMATION *********************************************/
 
-/*Updates the length slack considering the primal approximation. */
-void AbstractLagFormulation::updateLengthPrimalSlack(double alpha){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        lengthSlack_v2[d] = alpha*lengthSlack[d] + (1-alpha)*lengthSlack_v2[d];
-    }
-}
-
-/*Updates the source/target slack considering the primal approximation. */
-void AbstractLagFormulation::updateSourceTargetPrimalSlack(double alpha){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        for (int v = 0; v < instance.getNbNodes(); v++){ 
-            sourceTargetSlack_v2[d][v] = alpha*sourceTargetSlack[d][v] + (1-alpha)*sourceTargetSlack_v2[d][v];
-        }
-    }
-}
-
-/*Updates the flow slack considering the primal approximation. */
-void AbstractLagFormulation::updateFlowPrimalSlack(double alpha){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        for (int v = 0; v < countNodes(*vecGraph[d]); v++){
-            if(v != getTargetNodeIndex(d) && v != getSourceNodeIndex(d)){
-                flowSlack_v2[d][v] = alpha*flowSlack[d][v] + (1-alpha)*flowSlack_v2[d][v];
-            }
-        }
-    }
-}
-
-/*Updates the overlap slack considering the primal approximation. */
-void AbstractLagFormulation::updateOverlapPrimalSlack(double alpha){
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        for (int s = 0; s < auxNbSlicesLimitFromEdge[e]; s++){
-            overlapSlack_v2[e][s] = alpha*overlapSlack[e][s] + (1-alpha)*overlapSlack_v2[e][s];
-        }
-    }
-}
-
-/*Updates the one slice per demand slack considering the primal variables. */
-void AbstractLagFormulation::updateOneSlicePerDemandPrimalSlack(double alpha){
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-            oneSlicePerDemandSlack_v2[e][d] = alpha*oneSlicePerDemandSlack[e][d] +(1-alpha)*oneSlicePerDemandSlack_v2[e][d];
-        }
-    }
-}
-
-/*Updates the max used slice overall slack considering the primal variables. */
-void AbstractLagFormulation::updateMaxUsedSliceOverallPrimalSlack(double alpha){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        maxUsedSliceOverallSlack_v2[d] = alpha*maxUsedSliceOverallSlack[d] + (1-alpha)*maxUsedSliceOverallSlack_v2[d];
-    }
-}
-
-/*Updates the max used slice overall (auxiliary) slack considering the primal variables. */
-void AbstractLagFormulation::updateMaxUsedSliceOverallAuxPrimalSlack(double alpha){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        maxUsedSliceOverallAuxSlack_v2[d] = alpha*maxUsedSliceOverallAuxSlack[d] + (1-alpha)*maxUsedSliceOverallAuxSlack_v2[d];
-    }
-}
-
-/*Updates the max used slice overall 2 slack considering the primal variables. */
-void AbstractLagFormulation::updateMaxUsedSliceOverall2PrimalSlack(double alpha){
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        for (int s = 0; s < auxNbSlicesLimitFromEdge[e]; s++){
-            maxUsedSliceOverallSlack2_v2[e][s] = alpha*maxUsedSliceOverallSlack2[e][s] + (1-alpha)*maxUsedSliceOverallSlack2_v2[e][s];
-        }
-    }
-}
-
-/*Updates the max used slice overall 3 slack considering the primal variables. */
-void AbstractLagFormulation::updateMaxUsedSliceOverall3PrimalSlack(double alpha){
-    for (int v = 0; v < instance.getNbNodes(); v++){
-        for (int s = 0; s < auxNbSlicesGlobalLimit; s++){
-            maxUsedSliceOverallSlack3_v2[v][s] = alpha*maxUsedSliceOverallSlack3[v][s] + (1-alpha)*maxUsedSliceOverallSlack3_v2[v][s];
-        }
-    }
+/* Updates the slack of the primal approximation of all relaxed constraints. */
+void AbstractLagFormulation::updatePrimalSlack(double alpha){
+    dualAxpby(alpha, dualSlack.data(), (1.0 - alpha), dualSlack_v2.data(), dualSlack_v2.size());
 }
 
 /******************************************************* DIRECTION *****************************************************/
 /* The minus is a result of the fact that we keep the negative of the real slack. */
 
-/* Updates the slack of length constraints. */
-void AbstractLagFormulation::updateLengthDirection(double theta){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        double value = getLengthSlack_k(d) - theta*getLengthDirection_k(d);
-        setLengthDirection_k(d,value);
-    }
+/* Updates the direction of all relaxed constraints. */
+void AbstractLagFormulation::updateDirection(){
+    double theta = getDirectionMult();
+    dualAxpby(1.0, dualSlack.data(), -theta, dualDirection.data(), dualDirection.size());
 }
 
-/* Updates the slack of source/target constraints. */
-void AbstractLagFormulation::updateSourceTargetDirection(double theta){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        for (int v = 0; v < instance.getNbNodes(); v++){ 
-            double value = getSourceTargetSlack_k(d,v) - theta*getSourceTargetDirection_k(d,v);
-            setSourceTargetDirection_k(d,v,value);
-        }
-    }
-}
-
-/* Updates the slack of flow constraints. */
-void AbstractLagFormulation::updateFlowDirection(double theta){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        for (int v = 0; v < countNodes(*vecGraph[d]); v++){
-            if(v != getTargetNodeIndex(d) && v != getSourceNodeIndex(d)){
-                double value = getFlowSlack_k(d,v) - theta*getFlowDirection_k(d,v);
-                setFlowDirection_k(d,v,value);
-            }
-        }
-    }
-}
-
-/* Updates the slack of non overlap constraints. */
-void AbstractLagFormulation::updateOverlapDirection(double theta){
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        for (int s = 0; s < auxNbSlicesLimitFromEdge[e]; s++){
-            double value = getOverlapSlack_k(e,s) - theta*getOverlapDirection_k(e,s);
-            setOverlapDirection_k(e,s,value);
-        }
-    }
-}
-
-/* Updates the slack of one slice per demand constraints. */
-void AbstractLagFormulation::updateOneSlicePerDemandDirection(double theta){
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-            double value = getOneSlicePerDemandSlack_k(e,d) - theta*getOneSlicePerDemandDirection_k(e,d);
-            setOneSlicePerDemandDirection_k(e,d,value);
-        }
-    }
-}
-
-/* Updates the slack of max used slice overall 1 constraints. */
-void AbstractLagFormulation::updateMaxUsedSliceOverallDirection(double theta){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        double value = getMaxUsedSliceOverallSlack_k(d) - theta*getMaxUsedSliceOverallDirection_k(d);
-        setMaxUsedSliceOverallDirection_k(d,value);
-    }
-}
-
-/* Updates the slack of max used slice overall 1 (auxiliary) constraints. */
-void AbstractLagFormulation::updateMaxUsedSliceOverallAuxDirection(double theta){
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        double value = getMaxUsedSliceOverallAuxSlack_k(d) - theta*getMaxUsedSliceOverallAuxDirection_k(d);
-        setMaxUsedSliceOverallAuxDirection_k(d,value);
-    }
-}
-
-/* Updates the slack of max used slice overall 2 constraints. */
-void AbstractLagFormulation::updateMaxUsedSliceOverall2Direction(double theta){
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        for (int s = 0; s < auxNbSlicesLimitFromEdge[e]; s++){
-            double value = getMaxUsedSliceOverall2Slack_k(e,s) - theta*getMaxUsedSliceOverall2Direction_k(e,s);
-            setMaxUsedSliceOverall2Direction_k(e,s,value);
-        }
-    }
-}
-
-/* Updates the slack of max used slice overall 3 constraints. */
-void AbstractLagFormulation::updateMaxUsedSliceOverall3Direction(double theta){
-    for (int v = 0; v < instance.getNbNodes(); v++){
-        for (int s = 0; s < auxNbSlicesGlobalLimit; s++){
-            double value = getMaxUsedSliceOverall3Slack_k(v,s) - theta*getMaxUsedSliceOverall3Direction_k(v,s);
-            setMaxUsedSliceOverall3Direction_k(v,s,value);
-        }
-    }
+/* Clears the slacks and directions of all relaxed constraints. */
+void AbstractLagFormulation::clearSlacks(){
+    dualSlack.fill(0.0);
+    dualSlack_v2.fill(0.0);
+    dualDirection.fill(0.0);
 }
 
 /**************************************************** ASSIGNMENT MATRIX *****************************************************/
@@ -5,6 +5,7 @@
 //#include "../../formulation/flowForm.h"
 #include "../../tools/clockTime.h"
 #include "../tools/lagTools.h"
+#include "../tools/multiplierStore.h"
 
 #include <lemon/bellman_ford.h>
 #include <lemon/cost_scaling.h>
@@ -29,150 +30,185 @@ class AbstractLagFormulation: public FlowForm{
                 double substractMultipliersTime;
                 double costTime;
 
+                /****************************************** DUAL STORAGE *****************************************/
+                /* The multipliers, stability centers, slacks and directions of all relaxed constraints are stored in
+                flat aligned vectors sharing the same layout, built by each formulation in initDualLayout(). The
+                vectors of each family declared below are views on their segment of these vectors. */
+
+                /** Positions of the relaxed constraints in the dual vectors. **/
+                DualLayout dualLayout;
+
+                /** Segment of each family of relaxed constraints in the layout (-1 when the family is not relaxed). **/
+                int lengthSegment;
+                int sourceTargetSegment;
+                int flowSegment;
+                int overlapSegment;
+                int oneSlicePerDemandSegment;
+                int maxUsedSliceOverallSegment;
+                int maxUsedSliceOverallAuxSegment;
+                int maxUsedSliceOverall2Segment;
+                int maxUsedSliceOverall3Segment;
+
+                DualVector dualMultiplier;
+                DualVector dualStabilityCenter;
+                DualVector dualSlack;
+                DualVector dualSlack_v2;
+                DualVector dualDirection;
+
+                /** Bounds of the multipliers: [0,+inf) for inequalities, (-inf,+inf) for equalities and [0,0] for fixed multipliers. **/
+                DualVector dualLower;
+                DualVector dualUpper;
+
+                /** 1.0 for the relaxed constraints considered in the norms and products, 0.0 for the fixed multipliers. **/
+                DualVector dualActive;
+
+                /** Multipliers of previous solves used as starting point (NULL if none). **/
+                std::shared_ptr<MultiplierStore> multiplierStore;
+
                 /****************************************** MULTIPLIERS ******************************************/
 
                 /** A vector storing the value of the Lagrangian multipliers associated with Length Constraints. **/
-                std::vector<double> lagrangianMultiplierLength;
+                DualRow lagrangianMultiplierLength;
 
                 /** A 2-dimensional vector storing the value of the Lagrangian multipliers associated with each Source/Target constraint. **/
-                std::vector<std::vector<double>> lagrangianMultiplierSourceTarget;
+                DualMatrix lagrangianMultiplierSourceTarget;
 
                 /** A 2-dimensional vector storing the value of the Lagrangian multipliers associated with each Flow constraint. **/
-                std::vector<std::vector<double>> lagrangianMultiplierFlow;
+                DualMatrix lagrangianMultiplierFlow;
 
                 /** A 2-dimensional vector storing the value of the Lagrangian multipliers associated with each Non-Overlapping constraint. **/
-                std::vector<std::vector<double> > lagrangianMultiplierOverlap;
+                DualMatrix lagrangianMultiplierOverlap;
 
                 /** A 2-dimensional vector storing the value of the Lagrangian multipliers associated with One Slice per Demand constraint. **/
-                std::vector<std::vector<double > > lagrangianMultiplierOneSlicePerDemand;
+                DualMatrix lagrangianMultiplierOneSlicePerDemand;
 
                 /** A 1-dimensional vector storing the value of the Lagrangian multipliers associated with Max used slice overall constrant. **/
-                std::vector<double > lagrangianMultiplierMaxUsedSliceOverall;
+                DualRow lagrangianMultiplierMaxUsedSliceOverall;
 
                 /** A 1-dimensional vector storing the value of the Lagrangian multipliers associated with Max used slice overall (auxiliary) constrant. **/
-                std::vector<double > lagrangianMultiplierMaxUsedSliceOverallAux;
+                DualRow lagrangianMultiplierMaxUsedSliceOverallAux;
 
                 /** A 2-dimensional vector storing the value of the Lagrangian multipliers associated with Max used slice overall 2 constrant. **/
-                std::vector< std::vector<double> > lagrangianMultiplierMaxUsedSliceOverall2;
+                DualMatrix lagrangianMultiplierMaxUsedSliceOverall2;
 
                 /** A 2-dimensional vector storing the value of the Lagrangian multipliers associated with Max used slice overall 3 constrant. **/
-                std::vector< std::vector<double> > lagrangianMultiplierMaxUsedSliceOverall3;
+                DualMatrix lagrangianMultiplierMaxUsedSliceOverall3;
 
                 /***************************************** STABILITY CENTER ********************************************/
 
                 /** A vector storing the value of the Lagrangian stability center associated with Length Constraints. **/
-                std::vector<double> lagrangianSCLength;
+                DualRow lagrangianSCLength;
 
                 /** A 2-dimensional vector storing the value of the Lagrangian stability center associated with source/target constraints **/
-                std::vector<std::vector<double>> lagrangianSCSourceTarget;
+                DualMatrix lagrangianSCSourceTarget;
 
                 /** A 2-dimensional vector storing the value of the Lagrangian stability center associated with flow constraints **/
-                std::vector<std::vector<double>> lagrangianSCFlow;
+                DualMatrix lagrangianSCFlow;
 
                 /** A 2-dimensional vector storing the value of the Lagrangian stability center associated with each Non-Overlapping constraint. **/
-                std::vector< std::vector<double> > lagrangianSCOverlap;
+                DualMatrix lagrangianSCOverlap;
 
                 /** A 2-dimensional vector storing the value of the Lagrangian stability center associates with One slice per demand. **/
-                std::vector<std::vector<double > > lagrangianSCOneSlicePerDemand;
+                DualMatrix lagrangianSCOneSlicePerDemand;
 
                  /** A 1-dimensional vector storing the value of the Lagrangian stability center associated with Max used slice overall constrant. **/
-                std::vector<double > lagrangianSCMaxUsedSliceOverall;
+                DualRow lagrangianSCMaxUsedSliceOverall;
 
                 /** A 1-dimensional vector storing the value of the Lagrangian stability center associated with Max used slice overall (auxiliary) constrant. **/
-                std::vector<double > lagrangianSCMaxUsedSliceOverallAux;
+                DualRow lagrangianSCMaxUsedSliceOverallAux;
 
                 /** A 2-dimensional vector storing the value of the Lagrangian stability center associated with Max used slice overall 2 constrant. **/
-                std::vector< std::vector<double> > lagrangianSCMaxUsedSliceOverall2;
+                DualMatrix lagrangianSCMaxUsedSliceOverall2;
 
                 /** A 2-dimensional vector storing the value of the Lagrangian stability center associated with Max used slice overall 3 constrant. **/
-                std::vector< std::vector<double> > lagrangianSCMaxUsedSliceOverall3;
+                DualMatrix lagrangianSCMaxUsedSliceOverall3;
 
                 /*********************************************** SLACK ******************************************************/
 
                 /** Stores the value of the slack of lengths constraints (i.e., b - Dx). */
-                std::vector<double> lengthSlack;
+                DualRow lengthSlack;
 
                 /** Stores the value of the slack of Source/Target constraints (i.e., b - Dx). */
-                std::vector<std::vector<double>> sourceTargetSlack;
+                DualMatrix sourceTargetSlack;
 
                 /** Stores the value of the slack of flow constraints (i.e., b - Dx). */
-                std::vector<std::vector<double>> flowSlack;
+                DualMatrix flowSlack;
 
                 /** Stores the value of the slack of Non-Overlapping constraints (i.e., b - Dx). */
-                std::vector< std::vector<double> > overlapSlack;
+                DualMatrix overlapSlack;
 
                 /** Stores the value of the slack of one slice per demand constraints (i.e., b - Dx). */
-                std::vector<std::vector<double> > oneSlicePerDemandSlack;
+                DualMatrix oneSlicePerDemandSlack;
 
                 /** Stores the value of the slack of Max used slice overall constraints (i.e., b - Dx). */
-                std::vector<double> maxUsedSliceOverallSlack;
+                DualRow maxUsedSliceOverallSlack;
 
                 /** Stores the value of the slack of Max used slice overall (auxiliary) constraints (i.e., b - Dx). */
-                std::vector<double> maxUsedSliceOverallAuxSlack;
+                DualRow maxUsedSliceOverallAuxSlack;
 
                 /** Stores the value of the slack of Max used slice overall 2 constraints (i.e., b - Dx). */
-                std::vector< std::vector<double> > maxUsedSliceOverallSlack2;
+                DualMatrix maxUsedSliceOverallSlack2;
 
                 /** Stores the value of the slack of Max used slice overall constraints (i.e., b - Dx). */
-                std::vector< std::vector<double> > maxUsedSliceOverallSlack3;
+                DualMatrix maxUsedSliceOverallSlack3;
 
                 /************************************** SLACK CONSIDERING PRIMAL VECTOR ************************************/
 
                 /** Stores the value of the slack (primal variables) of lengths constraints (i.e., b - Dx). */
-                std::vector<double> lengthSlack_v2;
+                DualRow lengthSlack_v2;
 
                 /** Stores the value of the slack (primal variables) of Source/Target constraints (i.e., b - Dx). */
-                std::vector<std::vector<double>> sourceTargetSlack_v2;
+                DualMatrix sourceTargetSlack_v2;
 
                 /** Stores the value of the slack (primal variables) of flow constraints (i.e., b - Dx). */
-                std::vector<std::vector<double>> flowSlack_v2;
+                DualMatrix flowSlack_v2;
 
                 /** Stores the value of the slack (primal variables) of Non-Overlapping constraints (i.e., b - Dx). */
-                std::vector< std::vector<double> > overlapSlack_v2;
+                DualMatrix overlapSlack_v2;
 
                 /** Stores the value of the slack (primal variables) of one slice per demand constraints (i.e., b - Dx). */
-                std::vector<std::vector<double > > oneSlicePerDemandSlack_v2;
+                DualMatrix oneSlicePerDemandSlack_v2;
 
                 /** Stores the value of the slack (primal variables) of Max used slice overall constraints (i.e., b - Dx). */
-                std::vector<double> maxUsedSliceOverallSlack_v2;
+                DualRow maxUsedSliceOverallSlack_v2;
 
                 /** Stores the value of the slack (primal variables) of Max used slice overall (auxiliary) constraints (i.e., b - Dx). */
-                std::vector<double> maxUsedSliceOverallAuxSlack_v2;
+                DualRow maxUsedSliceOverallAuxSlack_v2;
 
                 /** Stores the value of the slack (primal variables) of Max used slice overall 2 constraints (i.e., b - Dx). */
-                std::vector< std::vector<double> > maxUsedSliceOverallSlack2_v2;
+                DualMatrix maxUsedSliceOverallSlack2_v2;
 
                 /** Stores the value of the slack (primal variables) of Max used slice overall constraints (i.e., b - Dx). */
-                std::vector< std::vector<double> > maxUsedSliceOverallSlack3_v2;
+                DualMatrix maxUsedSliceOverallSlack3_v2;
 
                 /************************************************ DIRECTION ***************************************************/
 
                 /** Stores the value of the direction of lengths constraints. */
-                std::vector<double> lengthDirection;
+                DualRow lengthDirection;
 
                 /** Stores the value of the direction of Source/Target constraints. */
-                std::vector<std::vector<double>> sourceTargetDirection;
+                DualMatrix sourceTargetDirection;
 
                 /** Stores the value of the direction of flow constraints. */
-                std::vector<std::vector<double>> flowDirection;
+                DualMatrix flowDirection;
 
                 /** Stores the value of the direction of overlap constraints. */
-                std::vector< std::vector<double> > overlapDirection;
+                DualMatrix overlapDirection;
 
                 /** Stores the value of the direction of one slice per demand constraints. */
-                std::vector<std::vector<double > > oneSlicePerDemandDirection;
+                DualMatrix oneSlicePerDemandDirection;
 
                 /** Stores the value of the direction of Max used slice overall constraints. */
-                std::vector<double> maxUsedSliceOverallDirection;
+                DualRow maxUsedSliceOverallDirection;
 
                 /** Stores the value of the direction of Max used slice overall (auxiliary) constraints. */
-                std::vector<double> maxUsedSliceOverallAuxDirection;
+                DualRow maxUsedSliceOverallAuxDirection;
 
                 /** Stores the value of the direction of Max used slice overall 2 constraints. */
-                std::vector< std::vector<double> > maxUsedSliceOverall2Direction;
+                DualMatrix maxUsedSliceOverall2Direction;
 
                 /** Stores the value of the direction of Max used slice overall constraints. */
-                std::vector< std::vector<double> > maxUsedSliceOverall3Direction;
+                DualMatrix maxUsedSliceOverall3Direction;
 
                 /******************************************* PRIMAL APPROXIMATION *********************************************/
 
@@ -219,6 +255,20 @@ class AbstractLagFormulation: public FlowForm{
 
                 std::vector< std::shared_ptr<ArcMap> > lowerBound; 
 
+                /* Arcs whose upper bound is positive. The adapted subproblem runs on the subgraphs they induce, which are 
+                kept between resolves and only updated on the arcs whose bounds changed. */
+                std::vector< std::shared_ptr<ListDigraph::ArcMap<bool>> > openArcs;
+                std::vector< std::shared_ptr<FilterArcs<ListDigraph>> > openSubgraphs;
+
+                /* Bounds given at the previous resolve and (demand, arc) of each variable id (demand -1 if the 
+                variable is not an arc). */
+                std::vector<double> previousLower;
+                std::vector<double> previousUpper;
+                std::vector< std::pair<int, ListDigraph::Arc> > varArc;
+
+                /* Demands whose bounds changed since their subproblem was last solved. */
+                std::vector<bool> boundsChanged;
+
                 double realMaxUsedSliceOverall;
 
                 double maxUsedSliceOverallUpperBound;
@@ -228,12 +278,30 @@ class AbstractLagFormulation: public FlowForm{
                 std::vector<int> nbSlicesLimitFromEdge;
 
         public:
+                /** Dual and primal state of the formulation, saved by the hot start of strong branching. **/
+                struct HotStartState {
+                        AlignedDoubleVector multiplier;
+                        AlignedDoubleVector stabilityCenter;
+                        AlignedDoubleVector primalSlack;
+                        std::vector< std::vector<double> > primalSolution;
+                        double primalMaxUsedSliceOverall;
+                        std::vector<bool> primalVarAuxZ;
+                        double primalCost;
+                        bool valid;
+                        HotStartState():primalMaxUsedSliceOverall(0.0),primalCost(0.0),valid(false){}
+                };
+
                 /************************************************************************************************************/
                 /*			                        CONSTRUCTORS	       	                                    */
                 /************************************************************************************************************/
                 /** Constructor. Builds the Formulation.  @param instance The instance to be solved. **/
                 AbstractLagFormulation(const Instance &instance);
 
+                /** A formulation cannot be copied: its multiplier views and cost operators point into its own dual vectors.
+                 * Node dependent data is saved and restored through HotStartState instead. **/
+                AbstractLagFormulation(const AbstractLagFormulation &) = delete;
+                AbstractLagFormulation & operator=(const AbstractLagFormulation &) = delete;
+
                 /************************************************************************************************************/
                 /*		                                   GETTERS 	     	                                    */
                 /************************************************************************************************************/
@@ -428,15 +496,38 @@ class AbstractLagFormulation: public FlowForm{
                 /* Return the value to update the direction as a scalar of the subgradient */
                 double getDirectionMult();
 
+                /********************************************* DUAL VECTORS **********************************************/
+
+                /** Returns the number of relaxed constraints, i.e., the size of the dual vectors. **/
+                int getNbDuals() const { return dualMultiplier.size(); }
+
+                /** Returns the number of demand subproblems whose previous solution was reused instead of being solved again. **/
+                virtual int getNbReusedSubproblems() const { return 0; }
+
+                /** Returns the multipliers of all relaxed constraints. **/
+                const double * getDualMultiplierData() const { return dualMultiplier.data(); }
+
+                /** Returns the stability center of all relaxed constraints. **/
+                const double * getDualStabilityCenterData() const { return dualStabilityCenter.data(); }
+
+                /** Returns the slacks of all relaxed constraints. **/
+                const double * getDualSlackData() const { return dualSlack.data(); }
+
+                /** Returns the lower bounds of the multipliers. **/
+                const double * getDualLowerData() const { return dualLower.data(); }
+
+                /** Returns 1.0 for the relaxed constraints whose multiplier is not fixed, 0.0 otherwise. **/
+                const double * getDualActiveData() const { return dualActive.data(); }
+
                 /***************************************** PRIMAL SOLUTION ***********************************************/
 
                 /** Returns the vector with the primal approximation values. **/
-                std::vector< std::vector<double> > getPrimalVariables() const { return primal_linear_solution;}
+                const std::vector< std::vector<double> > & getPrimalVariables() const { return primal_linear_solution;}
 
                 /***************************************** CURRENT SOLUTION **********************************************/
 
                 /** Returns the vector with the sub problem variables values **/
-                std::vector< std::vector<bool> > getVariables() const { return assignmentMatrix_d;}
+                const std::vector< std::vector<bool> > & getVariables() const { return assignmentMatrix_d;}
 
                 /********************************************* GRAPH D ***********************************************/
 
@@ -497,6 +588,10 @@ class AbstractLagFormulation: public FlowForm{
                 void setCostTime(double value) { costTime = value;}
                 void incCostTime(double value) { costTime += value;}
 
+                /****************************************** WARM START *************************************************/
+                void setMultiplierStore(std::shared_ptr<MultiplierStore> store) { multiplierStore = store; }
+                std::shared_ptr<MultiplierStore> getMultiplierStore() const { return multiplierStore; }
+
                 /******************************************* MULTIPLIERS ***********************************************/
 
                 /** Sets the multiplier for the length constraint k **/
@@ -665,8 +760,39 @@ class AbstractLagFormulation: public FlowForm{
                 /** Sets the lower and upper bound  of the variables. **/
                 void updateLowerUpperBound(double*,double*);
 
+                /** Builds the map from variable ids to arcs used to compare the bounds between resolves. **/
+                void initBoundDiffing();
+
                 void verifyLowerUpperBound();
 
+                /******************************************** DUAL STORAGE *******************************************/
+
+                /** Builds the layout of the relaxed constraints and allocates the dual vectors. Only the first call has effect. **/
+                void initDualStorage();
+
+                /** Returns the memory (bytes) allocated by the layout and the dual vectors. **/
+                std::size_t getDualMemory() const;
+
+                /** Adds the segments of the relaxed constraints to the layout, in the order of the rows of the model. **/
+                virtual void initDualLayout() = 0;
+
+                /** Adds the segment of each family of relaxed constraints to the layout. **/
+                void addLengthSegment();
+                void addSourceTargetSegment();
+                void addFlowSegment();
+                void addOverlapSegment();
+                void addOneSlicePerDemandSegment();
+                void addMaxUsedSliceOverallSegment();
+                void addMaxUsedSliceOverallAuxSegment();
+                void addMaxUsedSliceOverall2Segment();
+                void addMaxUsedSliceOverall3Segment();
+
+                /** Sets the bounds of the multipliers and the fixed ones. **/
+                void initDualBounds();
+
+                /** Points the vectors of each family to their segment of the dual vectors. **/
+                void bindDualViews();
+
                 /******************************************** MULTIPLIERS *******************************************/
 
                 virtual void startMultipliers(double *,int,int) = 0;
@@ -701,70 +827,40 @@ class AbstractLagFormulation: public FlowForm{
                 /** Sets the initial lagrangian multipliers associated with max used slice overall 3 constraints. **/
                 void initializeMaxUsedSliceOverall3Multipliers(double);
 
-                /******************************************** STABILITY CENTER *******************************************/
+                /** Replaces the initial multipliers by the ones of the multiplier store, if any. **/
+                void initStoredMultipliers();
 
-                /** Initializes the slack of relaxed constraints. **/
-                virtual void initStabilityCenter() = 0;
+                /** Copies the multipliers found in the store. Demand multipliers are only copied if the demand has not
+                 * changed. Returns the number of multipliers copied. **/
+                int loadMultipliers(const MultiplierStore &);
 
-                /** Sets the initial lagrangian stability center associated with length constraints. **/
-                void initializeLengthSC();
+                /** Saves the current multipliers in the store. **/
+                void storeMultipliers(MultiplierStore &) const;
 
-                /** Sets the initial lagrangian stability center associated with Source/Target constraints **/
-                void initializeSourceTargetSC();
-                
-                /** Sets the initial lagrangian stability center associated with flow constraints **/
-                void initializeFlowSC();
+                /** Saves the multipliers, the stability center and the primal approximation. **/
+                void saveHotStart(HotStartState &) const;
 
-                /** Sets the initial lagrangian stability center associated with overlap constraints **/
-                void initializeOverlapSC();
+                /** Puts back the state saved by saveHotStart. Only bounds may have changed in between. **/
+                void restoreHotStart(const HotStartState &);
 
-                /** Sets the initial lagrangian stability center associated with one slice per demand constraints **/
-                void initializeOneSlicePerDemandSC();
+                /** Loads or saves the multipliers of a segment. Rows and columns are either indices (edges, nodes,
+                 * slices) or demands, identified by their id in the store. **/
+                int loadSegment(const MultiplierStore &, MultiplierStore::Family, int, bool, bool, const std::vector<bool> &);
+                void storeSegment(MultiplierStore &, MultiplierStore::Family, int, bool, bool) const;
 
-                /** Sets the initial lagrangian stability center associated with max used slice overall constraints **/
-                void initializeMaxUsedSliceOverallSC();
+                /** Loads or saves the multipliers of the flow constraints, keyed by demand id, node label and slice. **/
+                int loadFlowSegment(const MultiplierStore &, const std::vector<bool> &);
+                void storeFlowSegment(MultiplierStore &) const;
 
-                /** Sets the initial lagrangian stability center associated with max used slice overall (auxiliary) constraints **/
-                void initializeMaxUsedSliceOverallAuxSC();
-
-                /** Sets the initial lagrangian stability center associated with max used slice overall 2 constraints **/
-                void initializeMaxUsedSliceOverall2SC();
+                /******************************************** STABILITY CENTER *******************************************/
 
-                /** Sets the initial lagrangian stability center associated with max used slice overall 3 constraints **/
-                void initializeMaxUsedSliceOverall3SC();
+                /** Initializes the stability center with the current multipliers. **/
+                void initStabilityCenter();
 
                 /************************************************ SLACK **************************************************/
 
                 /** Initializes the slack of relaxed constraints. **/
-                virtual void initSlacks() = 0;
-
-                /** Initializes the slack of length constraints. **/
-                void initializeLengthSlacks();
-                
-                /** Initializes the slack of Source/Target constraints. **/
-                void initializeSourceTargetSlacks();
-
-                /** Initializes the slack of Flow constraints. **/
-                void initializeFlowSlacks();
-
-                /** Initializes the slack of non-overlap constraints. **/
-                void initializeOverlapSlacks();
-
-                /** Initializes the slack of one slice per demand constraints. **/
-                void initializeOneSlicePerDemandSlacks();
-
-                /** Sets the initial lagrangian slack associated with max used slice overall constraints **/
-                void initializeMaxUsedSliceOverallSlacks();
-
-                /** Sets the initial lagrangian slack associated with max used slice overall (auxiliary) constraints **/
-                void initializeMaxUsedSliceOverallAuxSlacks();
-
-                /** Sets the initial lagrangian slack associated with max used slice overall 2 constraints **/
-                void initializeMaxUsedSliceOverall2Slacks();
-
-                /** Sets the initial lagrangian slack associated with max used slice overall 3 constraints **/
-                void initializeMaxUsedSliceOverall3Slacks();
-
+                void initSlacks();
 
                 /** Reset the slack of relaxed constraints. **/
                 virtual void resetSlacks() = 0;
@@ -799,59 +895,12 @@ class AbstractLagFormulation: public FlowForm{
                 /************************************* PRIMAL APPROXIMATION SLACK ******************************************/
 
                 /** Initializes the slack (considering primal approximation) of relaxed constraints. **/
-                virtual void initPrimalSlacks() = 0;
-
-                /** Initializes the slack of length constraints (considering primal approximation). **/
-                void initializeLengthPrimalSlacks();
-
-                /** Initializes the slack of Source/Target constraints (considering primal approximation). **/
-                void initializeSourceTargetPrimalSlacks();
-
-                void initializeFlowPrimalSlacks();
-
-                void initializeOverlapPrimalSlacks();
-
-                void initializeOneSlicePerDemandPrimalSlacks();
-
-                void initializeMaxUsedSliceOverallPrimalSlacks();
-
-                void initializeMaxUsedSliceOverallAuxPrimalSlacks();
-
-                void initializeMaxUsedSliceOverall2PrimalSlacks();
-
-                void initializeMaxUsedSliceOverall3PrimalSlacks();
+                void initPrimalSlacks();
 
                 /*********************************************** DIRECTION ************************************************/
 
                 /** Initializes the direction of relaxed constraints. **/
-                virtual void initDirection() = 0;
-
-                /** Sets the initial direction of length constraints **/
-                void initializeLengthDirection();
-
-                /** Sets the initial direction of source/target constraints **/
-                void initializeSourceTargetDirection();
-
-                /** Sets the initial direction of flow constraints **/
-                void initializeFlowDirection();
-
-                /** Sets the initial direction of overlap constraints **/
-                void initializeOverlapDirection();
-
-                /** Sets the initial direction of overlap constraints **/
-                void initializeOneSlicePerDemandDirection();
-
-                /** Sets the initial direction of maximum used slice overall 1 constraints **/
-                void initializeMaxUsedSliceOverallDirection();
-
-                /** Sets the initial direction of maximum used slice overall 1 (auxiliary) constraints **/
-                void initializeMaxUsedSliceOverallAuxDirection();
-
-                /** Sets the initial direction of maximum used slice overall 2 constraints **/
-                void initializeMaxUsedSliceOverall2Direction();
-
-                /** Sets the initial direction of maximum used slice overall 3 constraints **/
-                void initializeMaxUsedSliceOverall3Direction();
+                void initDirection();
 
                 /*********************************************** ASSIGNMENT MATRIX ********************************************/
 
@@ -949,99 +998,21 @@ class AbstractLagFormulation: public FlowForm{
 
                 /********************************************** MULTIPLIERS **************************************************/
 
-                /* Updates lagrangian multipliers with the rule: u[k+1] = u[k] + t[k]*violation */
-                virtual void updateMultiplier(double) = 0;
-
-                /* Updates length lagrangian multipliers  */
-                void updateLengthMultiplier(double);
-
-                /* Updates source/target lagrangian multipliers  */
-                void updateSourceTargetMultiplier(double);
-
-                /* Updates flow lagrangian multipliers  */
-                void updateFlowMultiplier(double);
-
-                /* Updates non-overlap lagrangian multipliers  */
-                void updateOverlapMultiplier(double);
-
-                /* Updates one slice per demand lagrangian multipliers  */
-                void updateOneSlicePerDemandMultiplier(double);
-
-                /* Updates maximum used slice overall lagrangian multipliers  */
-                void updateMaxUsedSliceOverallMultiplier(double);
-
-                /* Updates maximum used slice overall (auxiliary) lagrangian multipliers  */
-                void updateMaxUsedSliceOverallAuxMultiplier(double);
-
-                /* Updates maximum used slice overall 2 lagrangian multipliers  */
-                void updateMaxUsedSliceOverall2Multiplier(double);
-
-                /* Updates maximum used slice overall 3 lagrangian multipliers  */
-                void updateMaxUsedSliceOverall3Multiplier(double);
+                /* Updates lagrangian multipliers with the rule: u[k+1] = u[k] + t[k]*violation, projected on the bounds of the multipliers */
+                void updateMultiplier(double);
 
                 /*********************************** MULTIPLIER CONSIDERING THE STABILITY CENTER *****************************/
 
-                /* Updates lagrangian multipliers with the rule: u[k+1] = stability center[k] + t[k]*violation */
-                virtual void updateMultiplier_v2(double) = 0;
-
-                /* Updates length lagrangian multipliers  */
-                void updateLengthMultiplier_v2(double);
-
-                /* Updates source/target lagrangian multipliers  */
-                void updateSourceTargetMultiplier_v2(double);
-
-                /* Updates flow lagrangian multipliers  */
-                void updateFlowMultiplier_v2(double);
-
-                /* Updates non-overlap lagrangian multipliers  */
-                void updateOverlapMultiplier_v2(double);
-
-                /* Updates one slice per demand lagrangian multipliers  */
-                void updateOneSlicePerDemandMultiplier_v2(double);
-
-                /* Updates maximum used slice overall 1 lagrangian multipliers  */
-                void updateMaxUsedSliceOverallMultiplier_v2(double);
+                /* Updates lagrangian multipliers with the rule: u[k+1] = stability center[k] + t[k]*violation, projected on the bounds of the multipliers */
+                void updateMultiplier_v2(double);
 
-                /* Updates maximum used slice overall 1 (auxiliary) lagrangian multipliers  */
-                void updateMaxUsedSliceOverallAuxMultiplier_v2(double);
-
-                /* Updates maximum used slice overall 2 lagrangian multipliers  */
-                void updateMaxUsedSliceOverall2Multiplier_v2(double);
-
-                /* Updates maximum used slice overall 3 lagrangian multipliers  */
-                void updateMaxUsedSliceOverall3Multiplier_v2(double);
+                /** Updates the multipliers of all relaxed constraints from the stability center, following the given direction (a vector of the size of the dual vectors). **/
+                void updateMultiplierFromCenter(const double *, double);
 
                 /********************************************* STABILITY CENTER *********************************************/
 
                 /** Updates lagrangian stabitity center **/
-                virtual void updateStabilityCenter() = 0;
-
-                /** Updates length stability center **/
-                void updateLengthSC();
-
-                /** Updates source/target stability center **/
-                void updateSourceTargetSC();
-
-                /** Updates flow stability center **/
-                void updateFlowSC();
-
-                /** Updates overlap stability center **/
-                void updateOverlapSC();
-
-                /** Updates one slice per demand stability center **/
-                void updateOneSlicePerDemandSC();
-
-                /** Updates maximum used slice overall stability center **/
-                void updateMaxUsedSliceOverallSC();
-
-                /** Updates maximum used slice overall (auxiliary) stability center **/
-                void updateMaxUsedSliceOverallAuxSC();
-
-                /** Updates maximum used slice overall 2 stability center **/
-                void updateMaxUsedSliceOverall2SC();
-
-                /** Updates maximum used slice overall 3 stability center **/
-                void updateMaxUsedSliceOverall3SC();
+                void updateStabilityCenter();
 
                 /************************************************** SLACK ****************************************************/
 
@@ -1077,70 +1048,17 @@ class AbstractLagFormulation: public FlowForm{
 
                 /**************************************** SLACK PRIMAL APPROXIMATION ******************************************/
                 
-                /** Updates the slack considering the primal approximation. **/
-                virtual void updatePrimalSlack(double) = 0;
-
-                /** Updates the length slack considering the primal approximation. Rule: slack_v2 = alpha*slack + (1-alpha)*slack_v2 **/
-                void updateLengthPrimalSlack(double);
-
-                /** Updates the source/target slack considering the primal approximation. Rule: slack_v2 = alpha*slack + (1-alpha)*slack_v2 **/
-                void updateSourceTargetPrimalSlack(double);
-
-                /** Updates the flow slack considering the primal approximation. Rule: slack_v2 = alpha*slack + (1-alpha)*slack_v2 **/
-                void updateFlowPrimalSlack(double);
-
-                /** Updates the overlap slack considering the primal approximation. Rule: slack_v2 = alpha*slack + (1-alpha)*slack_v2 **/
-                void updateOverlapPrimalSlack(double);
-
-                /** Updates the one slice per demand slack considering the primal approximation. Rule: slack_v2 = alpha*slack + (1-alpha)*slack_v2 **/
-                void updateOneSlicePerDemandPrimalSlack(double);
-
-                /** Updates the max used slice overall slack considering the primal approximation. Rule: slack_v2 = alpha*slack + (1-alpha)*slack_v2 **/
-                void updateMaxUsedSliceOverallPrimalSlack(double);
-
-                /** Updates the max used slice overall auxiliary slack considering the primal approximation. Rule: slack_v2 = alpha*slack + (1-alpha)*slack_v2 **/
-                void updateMaxUsedSliceOverallAuxPrimalSlack(double);
-
-                /** Updates the max used slice overall 2 slack considering the primal approximation. Rule: slack_v2 = alpha*slack + (1-alpha)*slack_v2 **/
-                void updateMaxUsedSliceOverall2PrimalSlack(double);
-
-                /** Updates the max used slice overall 3 slack considering the primal approximation. Rule: slack_v2 = alpha*slack + (1-alpha)*slack_v2 **/
-                void updateMaxUsedSliceOverall3PrimalSlack(double);
+                /** Updates the slack considering the primal approximation. Rule: slack_v2 = alpha*slack + (1-alpha)*slack_v2 **/
+                void updatePrimalSlack(double);
 
                 /************************************************* DIRECTION *************************************************/
 
                 /** Updates the directions. Rule:direction[k+1] = slack[k+1] + theta*direction[k]. Theta is computed in the function
                  * according to given direction method. **/
-                virtual void updateDirection() = 0;
-
-                /** Updates the length direction **/
-                void updateLengthDirection(double);
-
-                /** Updates the source/target direction **/
-                void updateSourceTargetDirection(double);
-
-                /** Updates the flow direction **/
-                void updateFlowDirection(double);
-
-                /** Updates the non-overlap direction **/
-                void updateOverlapDirection(double);
-
-                /** Updates the one slice per demand direction **/
-                void updateOneSlicePerDemandDirection(double);
+                void updateDirection();
 
-                /** Updates the maximum used slice overall direction **/
-                void updateMaxUsedSliceOverallDirection(double);
-
-                /** Updates the maximum used slice overall (auxiliary) direction **/
-                void updateMaxUsedSliceOverallAuxDirection(double);
-
-                /** Updates the maximum used slice overall 2 direction **/
-                void updateMaxUsedSliceOverall2Direction(double);
-
-                /** Updates the maximum used slice overall 3 direction **/
-                void updateMaxUsedSliceOverall3Direction(double);
-
-                virtual void clearSlacks() = 0;
+                /** Sets the slacks and directions to zero. **/
+                void clearSlacks();
         
                 /******************************************** PRIMAL SOLUTION *********************************************/
 
@@ -1187,57 +1105,9 @@ class AbstractLagFormulation: public FlowForm{
                 ********************************************************************************************************** */
                 
                 virtual ~AbstractLagFormulation(){
-
-                        lagrangianMultiplierLength.clear();
-                        lagrangianMultiplierSourceTarget.clear();
-                        lagrangianMultiplierFlow.clear();
-                        lagrangianMultiplierOverlap.clear();
-                        lagrangianMultiplierOneSlicePerDemand.clear();
-                        lagrangianMultiplierMaxUsedSliceOverall.clear();
-                        lagrangianMultiplierMaxUsedSliceOverallAux.clear();
-                        lagrangianMultiplierMaxUsedSliceOverall2.clear();
-                        lagrangianMultiplierMaxUsedSliceOverall3.clear();
-
-                        lengthSlack.clear();
-                        sourceTargetSlack.clear();
-                        flowSlack.clear();
-                        overlapSlack.clear();
-                        oneSlicePerDemandSlack.clear();
-                        maxUsedSliceOverallSlack.clear();
-                        maxUsedSliceOverallAuxSlack.clear();
-                        maxUsedSliceOverallSlack2.clear();
-                        maxUsedSliceOverallSlack3.clear();
-
-                        lengthSlack_v2.clear();
-                        sourceTargetSlack_v2.clear();
-                        flowSlack_v2.clear();
-                        overlapSlack_v2.clear();
-                        oneSlicePerDemandSlack_v2.clear();
-                        maxUsedSliceOverallSlack_v2.clear();
-                        maxUsedSliceOverallAuxSlack_v2.clear();
-                        maxUsedSliceOverallSlack2_v2.clear();
-                        maxUsedSliceOverallSlack3_v2.clear();
-
-                        lagrangianSCLength.clear();
-                        lagrangianSCSourceTarget.clear();
-                        lagrangianSCFlow.clear();
-                        lagrangianSCOverlap.clear();
-                        lagrangianSCOneSlicePerDemand.clear();
-                        lagrangianSCMaxUsedSliceOverall.clear();
-                        lagrangianSCMaxUsedSliceOverallAux.clear();
-                        lagrangianSCMaxUsedSliceOverall2.clear();
-                        lagrangianSCMaxUsedSliceOverall3.clear();
-
-                        lengthDirection.clear();
-                        sourceTargetDirection.clear();
-                        flowDirection.clear();
-                        overlapDirection.clear();
-                        oneSlicePerDemandDirection.clear();
-                        maxUsedSliceOverallDirection.clear();
-                        maxUsedSliceOverallAuxDirection.clear();
-                        maxUsedSliceOverall2Direction.clear();
-                        maxUsedSliceOverall3Direction.clear();
-
+                        for (unsigned int d = 0; d < openSubgraphs.size(); d++){
+                                shortestPathPool.release(openSubgraphs[d].get());
+                        }
                         assignmentMatrix_d.clear();
                         primal_linear_solution.clear();
 
@@ -1,60 +1,16 @@
 #include "lagFlow.h"
 
-/* ******************************************************************************************************************
-*                                                   CLEAR METHODS
-******************************************************************************************************************* */
-
-/* Clear the slack vectors */
-void lagFlow::clearSlacks(){
-    lengthSlack.clear();
-    lengthDirection.clear();
-
-    if(instance.getInput().getChosenNodeMethod() == Input::NODE_METHOD_VOLUME){
-        lengthSlack_v2.clear();
-    }
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        overlapSlack[e].clear();
-        if(instance.getInput().getChosenNodeMethod() == Input::NODE_METHOD_VOLUME){
-            overlapSlack_v2[e].clear();
-        }
-        overlapDirection[e].clear();
-    }
-    overlapSlack.clear();
-    if(instance.getInput().getChosenNodeMethod() == Input::NODE_METHOD_VOLUME){
-        overlapSlack_v2.clear();
-    }
-    overlapDirection.clear();
-
-    if(instance.getInput().isObj8(0)){
-        maxUsedSliceOverallSlack.clear();
-        if(instance.getInput().getChosenNodeMethod() == Input::NODE_METHOD_VOLUME){
-            maxUsedSliceOverallSlack_v2.clear();
-        }
-        maxUsedSliceOverallDirection.clear();
-    }
-}
-
-/* Clear the multipliers vector */
-void lagFlow::clearDualSolution(){
-    lagrangianMultiplierLength.clear();
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        lagrangianMultiplierOverlap[e].clear();
-    }
-    lagrangianMultiplierOverlap.clear();
-
-    if(instance.getInput().isObj8(0)){
-        lagrangianMultiplierMaxUsedSliceOverall.clear();
-    }
-}
-
 /* ******************************************************************************************************************
 *                                               INITIALIZATION METHODS
 ******************************************************************************************************************* */
 
 void lagFlow::init(bool initMult){
+    initDualStorage();
+
     /** Lagrangian Values **/
     if(initMult){
         initMultipliers(); 
+        initStoredMultipliers();
         maxUsedSliceOverallUpperBound = (auxNbSlicesGlobalLimit-1);
         maxUsedSliceOverallLowerBound = 0;
     }
@@ -74,40 +30,34 @@ void lagFlow::init(bool initMult){
 
 /************************************************** MULTIPLIERS ****************************************************/
 
-/* The dual multipliers considering the source constraints, the flow constraints and the target constraints
-are not defined. They are always feasible (not relaxed in the lagrangian model), so the dual is always zero. */
-void lagFlow::startMultipliers(double *row,int size,int objSignal){
-    int nbDemands = getNbDemandsToBeRouted();
-    int notComputedMultipliers = nbDemands*(instance.getNbNodes()+1);
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){  
-        notComputedMultipliers+=(countNodes(*vecGraph[d])-2);
-    }
-    
-    /* Length multipliers */
-    std::copy(row+notComputedMultipliers,row+(notComputedMultipliers+nbDemands) ,std::back_inserter(lagrangianMultiplierLength));
-    
-    /*std::cout <<"start mult \n";
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){  
-        std::cout << lagrangianMultiplierLength[d] << " ";
-    }
-    std::cout << std::endl;*/
-    notComputedMultipliers = notComputedMultipliers+nbDemands;
-    /* Overlapping multipliers. */
-    int nbSlicesEdges = 0;
-    lagrangianMultiplierOverlap.resize(instance.getNbEdges());
-    for (int i = 0; i < instance.getNbEdges(); i++){
-        nbSlicesEdges = auxNbSlicesLimitFromEdge[i];
-        std::copy(row+notComputedMultipliers,row+(notComputedMultipliers+nbSlicesEdges) ,std::back_inserter(lagrangianMultiplierOverlap[i]));
-        //std::cout << lagrangianMultiplierOverlap[i][0] << " " << row[notComputedMultipliers] << std::endl;
-        notComputedMultipliers = notComputedMultipliers + nbSlicesEdges;
-    }
+/* Sets the relaxed constraints in the same order they are added to the cbc model in the flow formulation: length,
+non-overlapping and max used slice overall (objective 8). */
+void lagFlow::initDualLayout(){
+    addLengthSegment();
+    addOverlapSegment();
 
-    /* Max used slice overall */
     if(instance.getInput().isObj8(0)){
-        std::copy(row+notComputedMultipliers,row+(notComputedMultipliers+nbDemands) ,std::back_inserter(lagrangianMultiplierMaxUsedSliceOverall));
+        addMaxUsedSliceOverallSegment();
+    }
+}
+
+/* Returns the number of rows of the cbc model preceding the relaxed constraints: the source constraints, the flow 
+constraints and the target constraints. */
+int lagFlow::getNbNotRelaxedRows(){
+    int notComputedMultipliers = getNbDemandsToBeRouted()*(instance.getNbNodes()+1);
+    for (int d = 0; d < getNbDemandsToBeRouted(); d++){  
+        notComputedMultipliers+=(countNodes(*vecGraph[d])-2);
     }
+    return notComputedMultipliers;
+}
 
-    //std::cout << "> Initial (Start) Lagrangian multipliers were defined. " << std::endl;
+/* The dual multipliers considering the source constraints, the flow constraints and the target constraints
+are not defined. They are always feasible (not relaxed in the lagrangian model), so the dual is always zero. 
+The relaxed rows follow the dual layout, so they are copied at once. */
+void lagFlow::startMultipliers(double *row,int size,int objSignal){
+    initDualStorage();
+    int notComputedMultipliers = getNbNotRelaxedRows();
+    std::copy(row+notComputedMultipliers,row+(notComputedMultipliers+dualMultiplier.size()),dualMultiplier.data());
 }
 
 /* Sets the initial lagrangian multipliers for the subgradient to run. */
@@ -125,37 +75,8 @@ void lagFlow::initMultipliers(){
     //std::cout << "> Initial Lagrangian multipliers were defined. " << std::endl;
 }
 
-/************************************************ STABILITY CENTER **************************************************/
-
-void lagFlow::initStabilityCenter(){
-    initializeLengthSC();
-    initializeOverlapSC();
-
-    if(instance.getInput().isObj8(0)){
-        initializeMaxUsedSliceOverallSC();
-        //initializeMaxUsedSliceOverallAuxSC();
-        //initializeMaxUsedSliceOverall2SC();
-        //initializeMaxUsedSliceOverall3SC();
-    }
-    //std::cout << "> Initial Stability Centers were defined. " << std::endl;
-}
-
 /****************************************************** SLACK ********************************************************/
 
-/* Initializes the slack of relaxed constraints. */
-void lagFlow::initSlacks(){
-    initializeLengthSlacks();
-    initializeOverlapSlacks();
-
-    if(instance.getInput().isObj8(0)){
-        initializeMaxUsedSliceOverallSlacks();
-        //initializeMaxUsedSliceOverallAuxSlacks();
-        //initializeMaxUsedSliceOverall2Slacks();
-        //initializeMaxUsedSliceOverall3Slacks();
-    }
-    //std::cout << "> Initial Slacks were defined. " << std::endl;
-}
-
 /* Resets the slack of relaxed constraints. */
 void lagFlow::resetSlacks(){
     resetLengthSlacks();
@@ -169,113 +90,10 @@ void lagFlow::resetSlacks(){
     }
 }
 
-/************************************************ SLACK PRIMAL APPROXIMATION *********************************************/
-
-/* Initializes the slack of relaxed constraints. */
-void lagFlow::initPrimalSlacks(){
-    initializeLengthPrimalSlacks();
-    initializeOverlapPrimalSlacks();
-
-    if(instance.getInput().isObj8(0)){
-        initializeMaxUsedSliceOverallPrimalSlacks();
-        //initializeMaxUsedSliceOverallAuxPrimalSlacks();
-        //initializeMaxUsedSliceOverall2Slacks();
-        //initializeMaxUsedSliceOverall3Slacks();
-    }
-    //std::cout << "> Initial Slacks were defined. " << std::endl;
-}
-
-/**************************************************** DIRECTION ******************************************************/
-
-void lagFlow::initDirection(){
-    initializeLengthDirection();
-    initializeOverlapDirection();
-
-    if(instance.getInput().isObj8(0)){
-        initializeMaxUsedSliceOverallDirection();
-        //initializeMaxUsedSliceOverallAuxDirection();
-        //initializeMaxUsedSliceOverall2Direction();
-        //initializeMaxUsedSliceOverall3Direction();
-    }
-    //std::cout << "> Initial Direction were defined. " << std::endl;
-}
-
 /* *********************************************************************************************************************
 *                                                   UPDATE METHODS
 ********************************************************************************************************************** */
 
-/*************************************************** MULTIPLIERS *******************************************************/
-
-/* Updates lagrangian multiplier with the rule: u[k+1] = u[k] + t[k]*violation */
-void lagFlow::updateMultiplier(double step){
-    updateLengthMultiplier(step);
-    updateOverlapMultiplier(step);
-
-    if(instance.getInput().isObj8(0)){
-        updateMaxUsedSliceOverallMultiplier(step);
-        //updateMaxUsedSliceOverallAuxMultiplier(step);
-        //updateMaxUsedSliceOverall2Multiplier(step);
-        //updateMaxUsedSliceOverall3Multiplier(step);
-    }
-}
-
-/************************************** MULTIPLIER CONSIDERING THE STABILITY CENTER *****************************************/
-
-void lagFlow::updateMultiplier_v2(double step){
-    updateLengthMultiplier_v2(step);
-    updateOverlapMultiplier_v2(step);
-
-    if(instance.getInput().isObj8(0)){
-        updateMaxUsedSliceOverallMultiplier_v2(step);
-        //updateMaxUsedSliceOverallAuxMultiplier_v2(step);
-        //updateMaxUsedSliceOverall2Multiplier_v2(step);
-        //updateMaxUsedSliceOverall3Multiplier_v2(step);
-    }
-}
-
-/*************************************************** STABILITY CENTER *******************************************************/
-
-void lagFlow::updateStabilityCenter(){
-    updateLengthSC();
-    updateOverlapSC();
-
-    if(instance.getInput().isObj8(0)){
-        updateMaxUsedSliceOverallSC();
-        //updateMaxUsedSliceOverallAuxSC();
-        //updateMaxUsedSliceOverall2SC();
-        //updateMaxUsedSliceOverall3SC();
-    }
-}  
-
-/************************************************* SLACK PRIMAL APPROXIMATION ***********************************************/
-
-void lagFlow::updatePrimalSlack(double alpha){
-    updateLengthPrimalSlack(alpha);
-    updateOverlapPrimalSlack(alpha);
-
-    if(instance.getInput().isObj8(0)){
-        updateMaxUsedSliceOverallPrimalSlack(alpha);
-        //updateMaxUsedSliceOverallAuxPrimalSlack(alpha);
-        //updateMaxUsedSliceOverall2PrimalSlack(alpha);
-        //updateMaxUsedSliceOverall3PrimalSlack(alpha);
-    }
-}
-        
-/****************************************************** DIRECTION ***********************************************************/
-
-void lagFlow::updateDirection(){
-    double theta = getDirectionMult();
-    updateLengthDirection(theta);
-    updateOverlapDirection(theta);
-
-    if(instance.getInput().isObj8(0)){
-        updateMaxUsedSliceOverallDirection(theta);
-        //updateMaxUsedSliceOverallAuxDirection(theta);
-        //updateMaxUsedSliceOverall2Direction(theta);
-        //updateMaxUsedSliceOverall3Direction(theta);
-    }
-}
-
 /**************************************************** ASSIGNMENT MATRIX *****************************************************/
 
 /* We have this two first methods because Dijstra is a template and receives the map configuration. 
@@ -342,15 +160,24 @@ void lagFlow::updateAssignment_k(int d, DijkstraCostObj8 &path, const ListDigrap
 
 /* This method is used in the branch and bound, when we have to fix the variables values. */
 /* Updates the assignment of a demand based on the a given path. For general objective. */
-void lagFlow::updateAssignment_k(int d, CapacityScaling<ListDigraph,int,double> &costScale, const ListDigraph::Node &SOURCE, const ListDigraph::Node &TARGET){
-    std::fill(assignmentMatrix_d[d].begin(), assignmentMatrix_d[d].end(), false);
-
+void lagFlow::updateAssignment_k(int d, CapacityScaling<FilterArcs<ListDigraph>,int,double> &costScale, const ListDigraph::Node &SOURCE, const ListDigraph::Node &TARGET){
     IterableValueMap<ListDigraph,ListDigraph::Arc,double> auxiliary(*vecGraph[d]);
     costScale.flowMap(auxiliary);
     int flow = 1;
 
-    double slice = 0;
+    adaptedPath[d].clear();
     for(IterableValueMap<ListDigraph,ListDigraph::Arc,double>::ItemIt arc(auxiliary,flow); arc != INVALID; ++arc){
+        adaptedPath[d].push_back(arc);
+    }
+    updateAssignmentFromAdaptedPath_k(d);
+}
+
+void lagFlow::updateAssignmentFromAdaptedPath_k(int d){
+    std::fill(assignmentMatrix_d[d].begin(), assignmentMatrix_d[d].end(), false);
+
+    double slice = 0;
+    for(unsigned int i = 0; i < adaptedPath[d].size(); i++){
+        const ListDigraph::Arc &arc = adaptedPath[d][i];
         int index = getArcIndex(arc, d);
         if(getArcSlice(arc,d)>slice){
             slice = getArcSlice(arc,d);
@@ -443,7 +270,7 @@ double lagFlow::getRealCostFromPath(int d, DijkstraCost &path, const ListDigraph
 }
 
 /* Gets the real cost from the primal solution. Modified problem for the branch and bound. */
-double lagFlow::getRealCostFromPath(int d, CapacityScaling<ListDigraph,int,double> &costScale, const ListDigraph::Node &SOURCE, const ListDigraph::Node &TARGET){
+double lagFlow::getRealCostFromPath(int d, CapacityScaling<FilterArcs<ListDigraph>,int,double> &costScale, const ListDigraph::Node &SOURCE, const ListDigraph::Node &TARGET){
     double total = 0.0;
     IterableValueMap<ListDigraph,ListDigraph::Arc,double> auxiliary(*vecGraph[d]);
     costScale.flowMap(auxiliary);
@@ -458,32 +285,9 @@ double lagFlow::getRealCostFromPath(int d, CapacityScaling<ListDigraph,int,doubl
 /* Changes an array of doubles according to the dual solution: the multipliers. */
 /* It most follows the order that the constraints were added to the cbc model in the flow formulation. */
 void lagFlow::getDualSolution(double *rowprice){
-    int nbDemands = getNbDemandsToBeRouted();
-    int notComputedMultipliers = nbDemands*(instance.getNbNodes()+1);
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){  
-        notComputedMultipliers+=(countNodes(*vecGraph[d])-2);
-    }
-
+    int notComputedMultipliers = getNbNotRelaxedRows();
     std::fill(rowprice,rowprice+notComputedMultipliers,0.0);
-
-    /* Length multipliers. */
-    std::copy(lagrangianMultiplierLength.begin(),lagrangianMultiplierLength.end(),rowprice+notComputedMultipliers);
-
-    /* Non overlapping multipliers. */
-    notComputedMultipliers = notComputedMultipliers+nbDemands;
-    for (int i = 0; i < instance.getNbEdges(); i++){
-        std::copy(lagrangianMultiplierOverlap[i].begin(),lagrangianMultiplierOverlap[i].end(),rowprice+notComputedMultipliers);
-        int nbSlicesEdges = auxNbSlicesLimitFromEdge[i];
-        notComputedMultipliers = notComputedMultipliers + nbSlicesEdges;
-    }
-
-    /* Maximum used slice overall multipliers. */
-    if(instance.getInput().isObj8(0)){
-        std::copy(lagrangianMultiplierMaxUsedSliceOverall.begin(),lagrangianMultiplierMaxUsedSliceOverall.end(),rowprice+notComputedMultipliers);
-    }
-
-    /* Clear the multipliers vector. */
-    clearDualSolution();
+    std::copy(dualMultiplier.data(),dualMultiplier.data()+dualMultiplier.size(),rowprice+notComputedMultipliers);
 }
 
 /* ******************************************************* MODULES *****************************************************/
@@ -946,7 +750,7 @@ void lagFlow::runGeneralObj(){
         const ListDigraph::Node SOURCE = getFirstNodeFromLabel(d, getToBeRouted_k(d).getSource());
         const ListDigraph::Node TARGET = getFirstNodeFromLabel(d, getToBeRouted_k(d).getTarget());
 
-        DijkstraCost shortestPath((*vecGraph[d]), addMapFinal);
+        DijkstraCost shortestPath((*vecGraph[d]), addMapFinal, shortestPathPool);
         shortestPath.run(SOURCE, TARGET);
 
         if (shortestPath.reached(TARGET) == false){
@@ -994,7 +798,7 @@ void lagFlow::runObj8(){
         const ListDigraph::Node SOURCE = getFirstNodeFromLabel(d, getToBeRouted_k(d).getSource());
         const ListDigraph::Node TARGET = getFirstNodeFromLabel(d, getToBeRouted_k(d).getTarget());
 
-        DijkstraCostObj8 shortestPath((*vecGraph[d]), addMapFinalObj8);   
+        DijkstraCostObj8 shortestPath((*vecGraph[d]), addMapFinalObj8, shortestPathPool);   
         shortestPath.run(SOURCE, TARGET);
 
         if (shortestPath.reached(TARGET) == false){
@@ -1018,14 +822,47 @@ void lagFlow::runObj8(){
 }
 
 /* To solve an iteration  of the adapted problem considering objective 8. (for the branch and bound) */
+/* The subproblem of a demand runs on the subgraph of its open arcs. It is skipped, and its previous solution reused, 
+if neither its bounds nor the multipliers appearing in its costs changed since it was solved. */
 void lagFlow::runAdaptedGeneralObj(){
+    const bool obj8 = instance.getInput().isObj8(0);
+    if((int)adaptedValid.size() != getNbDemandsToBeRouted()){
+        adaptedPath.resize(getNbDemandsToBeRouted());
+        adaptedLagrCost.resize(getNbDemandsToBeRouted(), 0.0);
+        adaptedRealCost.resize(getNbDemandsToBeRouted(), 0.0);
+        adaptedLengthMultiplier.resize(getNbDemandsToBeRouted(), 0.0);
+        adaptedMaxUsedSliceMultiplier.resize(getNbDemandsToBeRouted(), 0.0);
+        adaptedValid.assign(getNbDemandsToBeRouted(), false);
+    }
+
+    /* The overlap multipliers appear in the costs of every demand. */
+    const double *overlapMultiplier = dualMultiplier.data() + dualLayout.getSegmentOffset(overlapSegment);
+    const int nbOverlapMultipliers = dualLayout.getSegmentSize(overlapSegment);
+    if((int)adaptedOverlapMultiplier.size() != nbOverlapMultipliers || !std::equal(overlapMultiplier, overlapMultiplier + nbOverlapMultipliers, adaptedOverlapMultiplier.begin())){
+        adaptedOverlapMultiplier.assign(overlapMultiplier, overlapMultiplier + nbOverlapMultipliers);
+        std::fill(adaptedValid.begin(), adaptedValid.end(), false);
+    }
+
     operatorCost oper(lagrangianMultiplierOverlap); 
     for (int d = 0; d < getNbDemandsToBeRouted(); d++){
+        const double lengthMultiplier = getLengthMultiplier_k(d);
+        const double maxUsedSliceMultiplier = obj8 ? getMaxUsedSliceOverallMultiplier_k(d) : 0.0;
+
+        if(adaptedValid[d] && !boundsChanged[d] && lengthMultiplier == adaptedLengthMultiplier[d] && maxUsedSliceMultiplier == adaptedMaxUsedSliceMultiplier[d]){
+            time.setStart(ClockTime::getTimeNow());
+            updateAssignmentFromAdaptedPath_k(d);
+            incCurrentLagrCost(adaptedLagrCost[d]);
+            incCurrentRealCost(adaptedRealCost[d]);
+            nbReusedSubproblems++;
+            incUpdateVariablesTime(time.getTimeInSecFromStart());
+            continue;
+        }
+        adaptedValid[d] = false;
 
         /* Time to compute costs */
         time.setStart(ClockTime::getTimeNow());  
 
-        double scale = getLengthMultiplier_k(d)/getToBeRouted_k(d).getMaxLength();
+        double scale = lengthMultiplier/getToBeRouted_k(d).getMaxLength();
         ScaleMapCost scaleMap((*vecArcLength[d]),scale);  // Multiply length Map Arc by length constraint multiplier
         AddMapCost addMap((*coeff[d]),scaleMap);  // Add to the coefficients
         oper.setDemandLoad(getToBeRouted_k(d).getLoad());
@@ -1035,10 +872,10 @@ void lagFlow::runAdaptedGeneralObj(){
         const ListDigraph::Node SOURCE = getFirstNodeFromLabel(d, getToBeRouted_k(d).getSource());
         const ListDigraph::Node TARGET = getFirstNodeFromLabel(d, getToBeRouted_k(d).getTarget());
 
-        CapacityScaling<ListDigraph,int,double> costScale((*vecGraph[d]));
+        CapacityScaling<FilterArcs<ListDigraph>,int,double> &costScale = shortestPathPool.getCapacityScaling(*openSubgraphs[d]);
 
-        if(instance.getInput().isObj8(0)){
-            operatorCostObj8 operCostObj8(getFirstNodeFromLabel(d, getToBeRouted_k(d).getSource()),getMaxUsedSliceOverallMultiplier_k(d),0.0);
+        if(obj8){
+            operatorCostObj8 operCostObj8(getFirstNodeFromLabel(d, getToBeRouted_k(d).getSource()),maxUsedSliceMultiplier,0.0);
             //operatorCostObj8 operCostObj8(getFirstNodeFromLabel(d, getToBeRouted_k(d).getSource()),getMaxUsedSliceOverallMultiplier_k(d),getMaxUsedSliceOverallAuxMultiplier_k(d));
             SourceMap<ListDigraph> sourceMap((*vecGraph[d])); 
             CombineMapCostObj8 combineObj8((*vecArcSlice[d]),sourceMap,operCostObj8); 
@@ -1055,14 +892,14 @@ void lagFlow::runAdaptedGeneralObj(){
         costScale.upperMap(*upperBound[d]);
         costScale.lowerMap(*lowerBound[d]);
         costScale.stSupply(SOURCE,TARGET,1);
-        CapacityScaling<ListDigraph,int,double>::ProblemType problemType = costScale.run();
+        CapacityScaling<FilterArcs<ListDigraph>,int,double>::ProblemType problemType = costScale.run();
 
-        if(problemType == CapacityScaling<ListDigraph,int,double>::INFEASIBLE){
+        if(problemType == CapacityScaling<FilterArcs<ListDigraph>,int,double>::INFEASIBLE){
             setStatus(STATUS_INFEASIBLE);
             std::cout << "> RSA is infeasible because there is no path from " << getToBeRouted_k(d).getSource()+1 << " to " << getToBeRouted_k(d).getTarget()+1 << " required for routing demand " << getToBeRouted_k(d).getId()+1 << "." << std::endl;
             return;
         }
-        if(problemType == CapacityScaling<ListDigraph,int,double>::UNBOUNDED){
+        if(problemType == CapacityScaling<FilterArcs<ListDigraph>,int,double>::UNBOUNDED){
             std::cout << "> The problem should not be unbounded because all the variables considered have upper bound at most equal to 1." << std::endl;
         }
         incShorstestPathTime(time.getTimeInSecFromStart());
@@ -1070,17 +907,21 @@ void lagFlow::runAdaptedGeneralObj(){
 
         time.setStart(ClockTime::getTimeNow());
         updateAssignment_k(d, costScale, SOURCE, TARGET);
-        incCurrentLagrCost(costScale.totalCost());
-        if(!instance.getInput().isObj8(0)){
-            incCurrentRealCost(getRealCostFromPath(d, costScale, SOURCE, TARGET));
-        }
+        adaptedLagrCost[d] = costScale.totalCost();
+        adaptedRealCost[d] = obj8 ? 0.0 : getRealCostFromPath(d, costScale, SOURCE, TARGET);
+        adaptedLengthMultiplier[d] = lengthMultiplier;
+        adaptedMaxUsedSliceMultiplier[d] = maxUsedSliceMultiplier;
+        adaptedValid[d] = true;
+        boundsChanged[d] = false;
+        incCurrentLagrCost(adaptedLagrCost[d]);
+        incCurrentRealCost(adaptedRealCost[d]);
         incUpdateVariablesTime(time.getTimeInSecFromStart());
     }
     time.setStart(ClockTime::getTimeNow());
     subtractConstantValuesFromLagrCost();
     incSubstractMultipliersTime(time.getTimeInSecFromStart());
 
-    if(instance.getInput().isObj8(0)){
+    if(obj8){
         solveProblemMaxUsedSliceOverall();
     }
 }
@@ -1114,6 +955,60 @@ void lagFlow::solveProblemMaxUsedSliceOverall(){
     incCurrentRealCost(realMaxUsedSliceOverall);
 }
 
+/* Copies the arc costs used by runGeneralObj or runObj8 for the current multipliers. */
+void lagFlow::getReducedCost(int d, ArcCost &cost){
+    operatorCost oper(lagrangianMultiplierOverlap);
+    double scale = getLengthMultiplier_k(d)/getToBeRouted_k(d).getMaxLength();
+    ScaleMapCost scaleMap((*vecArcLength[d]),scale);
+    AddMapCost addMap((*coeff[d]),scaleMap);
+    oper.setDemandLoad(getToBeRouted_k(d).getLoad());
+    CombineMapCost combine((*vecArcLabel[d]),(*vecArcSlice[d]),oper);
+    AddMapFinalCost addMapFinal(combine,addMap);
+
+    if(instance.getInput().isObj8(0)){
+        operatorCostObj8 operCostObj8(getFirstNodeFromLabel(d, getToBeRouted_k(d).getSource()),getMaxUsedSliceOverallMultiplier_k(d),0.0);
+        SourceMap<ListDigraph> sourceMap((*vecGraph[d]));
+        CombineMapCostObj8 combineObj8((*vecArcSlice[d]),sourceMap,operCostObj8);
+        AddMapFinalCostObj8 addMapFinalObj8(addMapFinal,combineObj8);
+        for (ListDigraph::ArcIt a(*vecGraph[d]); a != INVALID; ++a){
+            cost[a] = addMapFinalObj8[a];
+        }
+    }else{
+        for (ListDigraph::ArcIt a(*vecGraph[d]); a != INVALID; ++a){
+            cost[a] = addMapFinal[a];
+        }
+    }
+}
+
+/* The sub problem of demand d is a shortest path, so the best solution using arc (u,v) costs the current lagrangian
+cost - dist(s,t) + dist(s,u) + cost(u,v) + dist(v,t). The distances to the target are computed on the reverse graph. */
+void lagFlow::getArcLagrangianBound(int d, ArcCost &bound){
+    ArcCost cost(*vecGraph[d]);
+    getReducedCost(d, cost);
+
+    const ListDigraph::Node SOURCE = getFirstNodeFromLabel(d, getToBeRouted_k(d).getSource());
+    const ListDigraph::Node TARGET = getFirstNodeFromLabel(d, getToBeRouted_k(d).getTarget());
+
+    DijkstraCostArc forward((*vecGraph[d]), cost, shortestPathPool);
+    forward.run(SOURCE);
+
+    ReverseDigraph<ListDigraph> reverse(*vecGraph[d]);
+    ReverseDijkstraCostArc backward(reverse, cost, shortestPathPool);
+    backward.run(TARGET);
+
+    double shortest = forward.reached(TARGET) ? forward.dist(TARGET) : 0.0;
+    for (ListDigraph::ArcIt a(*vecGraph[d]); a != INVALID; ++a){
+        ListDigraph::Node u = (*vecGraph[d]).source(a);
+        ListDigraph::Node v = (*vecGraph[d]).target(a);
+        if (forward.reached(u) && backward.reached(v)){
+            bound[a] = getLagrCurrentCost() - shortest + forward.dist(u) + cost[a] + backward.dist(v);
+        }else{
+            bound[a] = DBL_MAX;
+        }
+    }
+    shortestPathPool.release(&reverse);
+}
+
 /*void lagFlow::solveProblemMaxUsedSliceOverall(){
     std::fill(varAuxZ.begin(), varAuxZ.end(), false);
     double min = __DBL_MAX__; int ind = 0;
@@ -7,12 +7,24 @@ using namespace lemon;
 
 class lagFlow :public AbstractLagFormulation{ 
 
+    private:
+        /* Solution of the adapted subproblem (branch and bound) of each demand. It is reused while the bounds of the 
+        demand, its length and max used slice overall multipliers and the overlap multipliers do not change. */
+        std::vector< std::vector<ListDigraph::Arc> > adaptedPath;
+        std::vector<double> adaptedLagrCost;
+        std::vector<double> adaptedRealCost;
+        std::vector<double> adaptedLengthMultiplier;
+        std::vector<double> adaptedMaxUsedSliceMultiplier;
+        std::vector<bool> adaptedValid;
+        AlignedDoubleVector adaptedOverlapMultiplier;
+        int nbReusedSubproblems;
+
     public:
 
         /* **************************************************************************************************************
         *                                             CONSTRUCTOR
         ************************************************************************************************************** */
-        lagFlow(const Instance &instance):AbstractLagFormulation(instance){}
+        lagFlow(const Instance &instance):AbstractLagFormulation(instance),nbReusedSubproblems(0){}
 
         /* **************************************************************************************************************
         *                                         INITIALIZATION METHODS
@@ -23,34 +35,21 @@ class lagFlow :public AbstractLagFormulation{
 
         /*********************************************** MULTIPLIERS ***************************************************/
 
+        /** Sets the relaxed constraints in the dual vectors. **/
+        void initDualLayout();
+
+        /** Returns the number of rows of the cbc model that are not relaxed. **/
+        int getNbNotRelaxedRows();
+
         void startMultipliers(double *,int,int);
 
         /** Sets the initial lagrangian multipliers values for the subgradient to run. **/
         void initMultipliers();
 
-        void clearDualSolution();
-
-        /********************************************** STABILITY CENTER ************************************************/
-
-        /** Initializes the stability center of relaxed constraints. **/
-        void initStabilityCenter();
-
         /*************************************************** SLACK ******************************************************/
 
-        /** Initializes the slack of relaxed constraints. **/
-        void initSlacks();
-
         void resetSlacks();
 
-        void initPrimalSlacks();
-
-        void clearSlacks();
-
-        /************************************************** DIRECTION ****************************************************/
-
-        /** Initializes the direction of relaxed constraints. **/
-        void initDirection();
-
         /* *****************************************************************************************************************
         *                                                  RUNING METHODS
         ***************************************************************************************************************** */
@@ -73,6 +72,14 @@ class lagFlow :public AbstractLagFormulation{
         /** SOlve sub problem when objective 8 is chosen. Minimizing the maximum slice overall. **/
         void solveProblemMaxUsedSliceOverall();
 
+        /** Fills the map with the cost of each arc of demand d in the sub problem, for the current multipliers. **/
+        void getReducedCost(int d, ArcCost &cost);
+
+        /** Computes, for each arc of demand d, the lagrangian bound of the solutions routing the demand through it: the
+         * current lagrangian cost where the shortest path of the demand is replaced by the shortest path using the arc
+         * (+infinity if no path uses it). Must be called after run. **/
+        void getArcLagrangianBound(int d, ArcCost &bound);
+
         /** Checks if sub problem solution is feasible. **/
         bool checkFeasibility();
 
@@ -91,7 +98,10 @@ class lagFlow :public AbstractLagFormulation{
         /** Returns the cost considering the objective function coefficient of the resulting sub problem solution **/
         double getRealCostFromPath(int d, DijkstraCost &path, const ListDigraph::Node &SOURCE, const ListDigraph::Node &TARGET);
 
-        double getRealCostFromPath(int d, CapacityScaling<ListDigraph,int,double> &costScale, const ListDigraph::Node &SOURCE, const ListDigraph::Node &TARGET);
+        double getRealCostFromPath(int d, CapacityScaling<FilterArcs<ListDigraph>,int,double> &costScale, const ListDigraph::Node &SOURCE, const ListDigraph::Node &TARGET);
+
+        /** Returns the number of demand subproblems whose previous solution was reused in the adapted runs. **/
+        int getNbReusedSubproblems() const override { return nbReusedSubproblems; }
 
         
         /* Returns the physical length of the path. */
@@ -130,30 +140,6 @@ class lagFlow :public AbstractLagFormulation{
         /*										               Update								           			   */
         /*******************************************************************************************************************/
 
-        /*************************************************** MULTIPLIERS ***************************************************/
-
-        /* Updates lagrangian multipliers with the rule: u[k+1] = u[k] + t[k]*violation */
-        void updateMultiplier(double);
-
-        /************************************** MULTIPLIER CONSIDERING THE STABILITY CENTER ********************************/
-
-        /* Updates lagrangian multipliers with the rule: u[k+1] = stability center[k] + t[k]*violation */
-        void updateMultiplier_v2(double);
-
-        /************************************************** STABILITY CENTER ***********************************************/
-
-        /* Updates stability center */
-        void updateStabilityCenter();
-        
-        /********************************************* SLACK PRIMAL APPROXIMATION ********************************************/
-
-        void updatePrimalSlack(double);
-
-        /****************************************************** DIRECTION****************************************************/
-
-        /* Updates direction */
-        void updateDirection();
-
         /************************************************** ASSIGNMENT MATRIX **********************************************/
 
         /** Updates the assignment of a demand based on the a given path. @param d The d-th demand. @param path The path on which the demand is routed. @param SOURCE The path's source. @param TARGET The path's target. **/
@@ -161,7 +147,10 @@ class lagFlow :public AbstractLagFormulation{
 
         void updateAssignment_k(int d, DijkstraCostObj8 &path, const ListDigraph::Node &SOURCE, const ListDigraph::Node &TARGET);
 
-        void updateAssignment_k(int d, CapacityScaling<ListDigraph,int,double> &, const ListDigraph::Node &, const ListDigraph::Node &);
+        void updateAssignment_k(int d, CapacityScaling<FilterArcs<ListDigraph>,int,double> &, const ListDigraph::Node &, const ListDigraph::Node &);
+
+        /** Updates the assignment and the slacks of a demand from the arcs of its last adapted subproblem solution. **/
+        void updateAssignmentFromAdaptedPath_k(int d);
 
         
         /********************************************************************************************************************/
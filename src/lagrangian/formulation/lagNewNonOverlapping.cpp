@@ -5,54 +5,17 @@ void lagNewNonOverlapping::getDualSolution(double *rowprice){
     std::cout<< "Branch and bound for no overlapping not defined yet.\n";
 }
 
-void lagNewNonOverlapping::clearSlacks(){
-    lengthDirection.clear();
-    lengthSlack.clear();
-    lengthSlack_v2.clear();
-
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        sourceTargetSlack[d].clear();
-        sourceTargetSlack_v2[d].clear();
-        sourceTargetDirection[d].clear();
-
-        flowSlack[d].clear();
-        flowSlack_v2[d].clear();
-        flowDirection[d].clear();
-    }
-    sourceTargetSlack.clear();
-    sourceTargetSlack_v2.clear();
-    sourceTargetDirection.clear();
-
-    flowSlack.clear();
-    flowSlack_v2.clear();
-    flowDirection.clear();
-
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        oneSlicePerDemandDirection[e].clear();
-        oneSlicePerDemandSlack[e].clear();
-        oneSlicePerDemandSlack_v2[e].clear();
-    }
-
-    oneSlicePerDemandDirection.clear();
-    oneSlicePerDemandSlack.clear();
-    oneSlicePerDemandSlack_v2.clear();
-
-    if(instance.getInput().isObj8(0)){
-        maxUsedSliceOverallSlack.clear();
-        maxUsedSliceOverallSlack_v2.clear();
-        maxUsedSliceOverallDirection.clear();
-    }
-}
-
 /* *******************************************************************************************************************
 *                                              INITIALIZATION METHODS
 ******************************************************************************************************************** */
 
 void lagNewNonOverlapping::init(bool initMult){
+    initDualStorage();
 
     /** Lagrangian Values **/
     if(initMult){
         initMultipliers();
+        initStoredMultipliers();
     }
     initSlacks();
     initDirection();
@@ -71,6 +34,19 @@ void lagNewNonOverlapping::init(bool initMult){
 
 /*************************************************** MULTIPLIERS ******************************************************/
 
+/* Sets the relaxed constraints in the dual vectors: length, source/target, flow, one slice per demand and, for 
+objective 8, the max used slice overall constraints. */
+void lagNewNonOverlapping::initDualLayout(){
+    addLengthSegment();
+    addSourceTargetSegment();
+    addFlowSegment();
+    addOneSlicePerDemandSegment();
+
+    if(instance.getInput().isObj8(0)){
+        addMaxUsedSliceOverallSegment();
+    }
+}
+
 /************************************************* Initial multiplier ************************************************/
 
 void lagNewNonOverlapping::startMultipliers(double *row ,int size,int objSignal){
@@ -156,42 +132,8 @@ void lagNewNonOverlapping::initMultipliersWarmstart(){
     }    
 }
 
-/************************************************ STABILITY CENTER ****************************************************/
-
-void lagNewNonOverlapping::initStabilityCenter(){
-    initializeLengthSC();
-    initializeSourceTargetSC();
-    initializeFlowSC();
-
-    initializeOneSlicePerDemandSC();
-
-    if(instance.getInput().isObj8(0)){
-        initializeMaxUsedSliceOverallSC();
-        //initializeMaxUsedSliceOverallAuxSC();
-        //initializeMaxUsedSliceOverall2SC();
-        //initializeMaxUsedSliceOverall3SC();
-    }
-}
-
 /**************************************************** SLACKS **********************************************************/
 
-/* Initializes the slack of relaxed constraints. */
-void lagNewNonOverlapping::initSlacks(){
-    initializeLengthSlacks();
-    initializeSourceTargetSlacks();
-    initializeFlowSlacks();
-
-    initializeOneSlicePerDemandSlacks();
-
-    if(instance.getInput().isObj8(0)){
-        initializeMaxUsedSliceOverallSlacks();
-        //initializeMaxUsedSliceOverallAuxSlacks();
-        //initializeMaxUsedSliceOverall2Slacks();
-        //initializeMaxUsedSliceOverall3Slacks();
-    }   
-    std::cout << "> Initial Slacks were defined. " << std::endl;
-}
-
 void lagNewNonOverlapping::resetSlacks(){
     resetLengthSlacks();
     resetSourceTargetSlacks();
@@ -207,43 +149,6 @@ void lagNewNonOverlapping::resetSlacks(){
     }   
 }
 
-/********************************************* SLACKS PRIMAL APPROXIMATION *************************************************/
-
-/* Initializes the slack of relaxed constraints. */
-void lagNewNonOverlapping::initPrimalSlacks(){
-    initializeLengthPrimalSlacks();
-    initializeSourceTargetPrimalSlacks();
-    initializeFlowPrimalSlacks();
-
-    initializeOneSlicePerDemandPrimalSlacks();
-
-    if(instance.getInput().isObj8(0)){
-        initializeMaxUsedSliceOverallPrimalSlacks();
-        //initializeMaxUsedSliceOverallAuxPrimalSlacks();
-        //initializeMaxUsedSliceOverall2Slacks();
-        //initializeMaxUsedSliceOverall3Slacks();
-    }   
-    std::cout << "> Initial Slacks were defined. " << std::endl;
-}
-
-/*************************************************** DIRECTION ********************************************************/
-
-void lagNewNonOverlapping::initDirection(){
-    initializeLengthDirection();
-    initializeSourceTargetDirection();
-    initializeFlowDirection();
-
-    initializeOneSlicePerDemandDirection();
-
-    if(instance.getInput().isObj8(0)){
-        initializeMaxUsedSliceOverallDirection();
-        //initializeMaxUsedSliceOverallAuxDirection();
-        //initializeMaxUsedSliceOverall2Direction();
-        //initializeMaxUsedSliceOverall3Direction();
-    }
-    std::cout << "> Initial Direction were defined. " << std::endl;
-}
-
 /********************************************* BUILD AUXILIARY GRAPH **************************************************/
 
 void lagNewNonOverlapping::build_Graphs_e(){
@@ -352,58 +257,6 @@ void lagNewNonOverlapping::addArcE(int label, int demand, int slice, int index,d
 *                                                  UPDATE METHODS
 *********************************************************************************************************************** */
 
-/*************************************************** MULTIPLIERS ********************************************************/
-
-/* Updates lagrangian multiplier with the rule: u[k+1] = u[k] + t[k]*violation */
-void lagNewNonOverlapping::updateMultiplier(double step){
-    updateLengthMultiplier(step);
-    updateSourceTargetMultiplier(step);
-    updateFlowMultiplier(step);
-
-    updateOneSlicePerDemandMultiplier(step);
-
-    if(instance.getInput().isObj8(0)){
-        updateMaxUsedSliceOverallMultiplier(step);
-        //updateMaxUsedSliceOverallAuxMultiplier(step);
-        //updateMaxUsedSliceOverall2Multiplier(step);
-        //updateMaxUsedSliceOverall3Multiplier(step);
-    }
-}
-
-/************************************** MULTIPLIER CONSIDERING THE STABILITY CENTER **************************************/
-
-void lagNewNonOverlapping::updateMultiplier_v2(double step){
-    updateLengthMultiplier_v2(step);
-    updateSourceTargetMultiplier_v2(step);
-    updateFlowMultiplier_v2(step);
-
-    updateOneSlicePerDemandMultiplier_v2(step);
-
-    if(instance.getInput().isObj8(0)){
-        updateMaxUsedSliceOverallMultiplier_v2(step);
-        //updateMaxUsedSliceOverallAuxMultiplier_v2(step);
-        //updateMaxUsedSliceOverall2Multiplier_v2(step);
-        //updateMaxUsedSliceOverall3Multiplier_v2(step);
-    }
-}
-
-/***************************************************** STABILITY CENTER ***************************************************/
-
-void lagNewNonOverlapping::updateStabilityCenter(){
-    updateLengthSC();
-    updateSourceTargetSC();
-    updateFlowSC();
-
-    updateOneSlicePerDemandSC();
-
-    if(instance.getInput().isObj8(0)){
-        updateMaxUsedSliceOverallSC();
-        //updateMaxUsedSliceOverallAuxSC();
-        //updateMaxUsedSliceOverall2SC();
-        //updateMaxUsedSliceOverall3SC();
-    }
-}
-
 /********************************************************** SLACK *********************************************************/
 
 void lagNewNonOverlapping::updateSlack(int d, const ListDigraph::Arc & arc){
@@ -421,39 +274,6 @@ void lagNewNonOverlapping::updateSlack(int d, const ListDigraph::Arc & arc){
     }
 }
 
-void lagNewNonOverlapping::updatePrimalSlack(double alpha){
-    updateLengthPrimalSlack(alpha);
-    updateSourceTargetPrimalSlack(alpha);
-    updateFlowPrimalSlack(alpha);
-
-    updateOneSlicePerDemandPrimalSlack(alpha);
-
-    if(instance.getInput().isObj8(0)){
-        updateMaxUsedSliceOverallPrimalSlack(alpha);
-        //updateMaxUsedSliceOverallAuxPrimalSlack(alpha);
-        //updateMaxUsedSliceOverall2PrimalSlack(alpha);
-        //updateMaxUsedSliceOverall3PrimalSlack(alpha);
-    }
-}
-
-/********************************************************** DIRECTION *****************************************************/
-
-void lagNewNonOverlapping::updateDirection(){
-    double theta = getDirectionMult();
-    updateLengthDirection(theta);
-    updateSourceTargetDirection(theta);
-    updateFlowDirection(theta);
-
-    updateOneSlicePerDemandDirection(theta);
-
-    if(instance.getInput().isObj8(0)){
-        updateMaxUsedSliceOverallDirection(theta);
-        //updateMaxUsedSliceOverallAuxDirection(theta);
-        //updateMaxUsedSliceOverall2Direction(theta);
-        //updateMaxUsedSliceOverall3Direction(theta);
-    }
-}
-
 /**************************************************** ASSIGNMENT MATRIX *****************************************************/
 
 /* Updates the assignment of a edge based on the a given path. */
@@ -1147,7 +967,7 @@ void lagNewNonOverlapping::runGeneralObj(){
 
         /* Solving a shortest path for each edge considering the auxiliary graph */
         /* From the artificial source to the artificial target*/
-        BellmanFordCostE shortestPath((*vecEGraph[e]), addFinalOneSlicePerDemand);
+        BellmanFordCostE shortestPath((*vecEGraph[e]), addFinalOneSlicePerDemand, shortestPathPool);
         shortestPath.run(SOURCE);
         
         /* There is always a path analysing the auxiliary graph */
@@ -1211,7 +1031,7 @@ void lagNewNonOverlapping::runObj8(){
 
         /* Solving a shortest path for each edge considering the auxiliary graph */
         /* From the artificial source to the artificial target*/
-        BellmanFordCostE shortestPath((*vecEGraph[e]), addFinalOneSlicePerDemand);
+        BellmanFordCostE shortestPath((*vecEGraph[e]), addFinalOneSlicePerDemand, shortestPathPool);
         shortestPath.run(SOURCE);
         
         /* There is always a path analysing the auxiliary graph */
@@ -1438,3 +1258,12 @@ void lagNewNonOverlapping::updateCost(){
 
 }
 
+/* *********************************************************************************************************************
+*                                                    DESTRUCTOR
+********************************************************************************************************************* */
+
+lagNewNonOverlapping::~lagNewNonOverlapping(){
+    for (unsigned int e = 0; e < vecEGraph.size(); e++){
+        shortestPathPool.release(vecEGraph[e].get());
+    }
+}
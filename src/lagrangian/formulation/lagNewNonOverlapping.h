@@ -126,6 +126,9 @@ class lagNewNonOverlapping:public AbstractLagFormulation{
         void init(bool=true);
 
         /********************************************** MULTIPLIERS ************************************************/
+
+        /** Sets the relaxed constraints in the dual vectors. **/
+        void initDualLayout();
         
         void startMultipliers(double *,int,int);
         
@@ -135,27 +138,10 @@ class lagNewNonOverlapping:public AbstractLagFormulation{
         /** Sets the initial lagrangian flow multipliers values using a warmstart procedure. **/
         void initMultipliersWarmstart();
 
-        /******************************************** STABILITY CENTER *********************************************/
-
-        /** Sets the initial lagrangian stability center values for the subgradient to run. **/
-        void initStabilityCenter();
-
         /************************************************* SLACK ***************************************************/
 
-        /** Initializes the slack of relaxed constraints. **/
-        void initSlacks();
-
         void resetSlacks();
 
-        void initPrimalSlacks();
-
-        void clearSlacks();
-
-        /*********************************************** DIRECTION *************************************************/
-
-        /** Initializes the direction of relaxed constraints. **/
-        void initDirection();
-
         /*************************************** BUILDING AUXILIARY GRAPH ******************************************/
 
         /** Constructs auxiliary graphs for each edge. **/
@@ -168,33 +154,11 @@ class lagNewNonOverlapping:public AbstractLagFormulation{
         *                                               UPDATE METHODS
         ***************************************************************************************************************** */
 
-        /************************************************ MULTIPLIERS *****************************************************/
-
-        /* Updates lagrangian multipliers with the rule: u[k+1] = u[k] + t[k]*violation */
-        void updateMultiplier(double);
-
-        /*********************************** MULTIPLIER CONSIDERING THE STABILITY CENTER **********************************/
-
-        /* Updates lagrangian multipliers with the rule: u[k+1] = SC[k] + t[k]*violation */
-        void updateMultiplier_v2(double);
-
-        /************************************************ STABILITY CENTER *************************************************/
-
-        /* Updates stability center: best result found so far. */
-        void updateStabilityCenter();
-        
         /**************************************************** SLACK ********************************************************/
 
         /* Updates relaxed constraints slacks */
         void updateSlack(int, const ListDigraph::Arc &);
 
-        void updatePrimalSlack(double);
-
-        /*************************************************** DIRECTION*******************************************************/
-
-        /* Updates relaxed constraints direction */
-        void updateDirection();
-
         /************************************************ ASSIGNMENT MATRIX *************************************************/
 
         /* Updates the assignment considering the obtained path result in each edge subproblem*/
@@ -270,6 +234,12 @@ class lagNewNonOverlapping:public AbstractLagFormulation{
         void displayMultiplier(std::ostream & = std::cout);
 
         void updateCost();
+
+        /* *********************************************************************************************************************
+        *                                                    DESTRUCTOR
+        ********************************************************************************************************************* */
+
+        ~lagNewNonOverlapping();
 };
 
 
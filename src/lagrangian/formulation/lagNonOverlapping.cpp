@@ -5,54 +5,17 @@ void lagNonOverlapping::getDualSolution(double *rowprice){
     std::cout<< "Branch and bound for no overlapping not defined yet.\n";
 }
 
-void lagNonOverlapping::clearSlacks(){
-    lengthDirection.clear();
-    lengthSlack.clear();
-    lengthSlack_v2.clear();
-
-    for (int d = 0; d < getNbDemandsToBeRouted(); d++){
-        sourceTargetSlack[d].clear();
-        sourceTargetSlack_v2[d].clear();
-        sourceTargetDirection[d].clear();
-
-        flowSlack[d].clear();
-        flowSlack_v2[d].clear();
-        flowDirection[d].clear();
-    }
-    sourceTargetSlack.clear();
-    sourceTargetSlack_v2.clear();
-    sourceTargetDirection.clear();
-
-    flowSlack.clear();
-    flowSlack_v2.clear();
-    flowDirection.clear();
-
-    for (int e = 0; e < instance.getNbEdges(); e++){
-        oneSlicePerDemandDirection[e].clear();
-        oneSlicePerDemandSlack[e].clear();
-        oneSlicePerDemandSlack_v2[e].clear();
-    }
-
-    oneSlicePerDemandDirection.clear();
-    oneSlicePerDemandSlack.clear();
-    oneSlicePerDemandSlack_v2.clear();
-
-    if(instance.getInput().isObj8(0)){
-        maxUsedSliceOverallSlack.clear();
-        maxUsedSliceOverallSlack_v2.clear();
-        maxUsedSliceOverallDirection.clear();
-    }
-}
-
 /* *******************************************************************************************************************
 *                                              INITIALIZATION METHODS
 ******************************************************************************************************************** */
 
 void lagNonOverlapping::init(bool initMult){
+    initDualStorage();
 
     /** Lagrangian Values **/
     if(initMult){
         initMultipliers();
+        initStoredMultipliers();
     }
     initSlacks();
     initDirection();
@@ -71,6 +34,21 @@ void lagNonOverlapping::init(bool initMult){
 
 /*************************************************** MULTIPLIERS ******************************************************/
 
+/* Sets the relaxed constraints in the dual vectors: length, source/target, flow and, for objective 8, the max used 
+slice overall constraints. */
+void lagNonOverlapping::initDualLayout(){
+    addLengthSegment();
+    addSourceTargetSegment();
+    addFlowSegment();
+
+    Input::ObjectiveMetric chosenMetric = getInstance().getInput().getChosenObj_k(0);
+    if(chosenMetric == Input::OBJECTIVE_METRIC_8){
+        addMaxUsedSliceOverallSegment();
+        addMaxUsedSliceOverall2Segment();
+        addMaxUsedSliceOverall3Segment();
+    }
+}
+
 /************************************************* Initial multiplier ************************************************/
 
 void lagNonOverlapping::startMultipliers(double *row ,int size,int objSignal){
@@ -221,39 +199,8 @@ void lagNonOverlapping::contractNodesFromLabel_v2(std::shared_ptr<ListDigraph> v
     //std::cout << "> Number of nodes with label " << label << " contracted: " << nb << std::endl; 
 }
 
-/************************************************ STABILITY CENTER ****************************************************/
-
-void lagNonOverlapping::initStabilityCenter(){
-    initializeLengthSC();
-    initializeSourceTargetSC();
-    initializeFlowSC();
-
-    Input::ObjectiveMetric chosenMetric = getInstance().getInput().getChosenObj_k(0);
-    if(chosenMetric == Input::OBJECTIVE_METRIC_8){
-        initializeMaxUsedSliceOverallSC();
-        initializeMaxUsedSliceOverall2SC();
-        initializeMaxUsedSliceOverall3SC();
-    }
-}
-
 /**************************************************** SLACKS **********************************************************/
 
-/* Initializes the slack of relaxed constraints. */
-void lagNonOverlapping::initSlacks(){
-    initializeLengthSlacks();
-    initializeSourceTargetSlacks();
-    initializeFlowSlacks();
-
-    Input::ObjectiveMetric chosenMetric = getInstance().getInput().getChosenObj_k(0);
-    if(chosenMetric == Input::OBJECTIVE_METRIC_8){
-        initializeMaxUsedSliceOverallSlacks();
-        initializeMaxUsedSliceOverall2Slacks();
-        initializeMaxUsedSliceOverall3Slacks();
-    }
-    
-    std::cout << "> Initial Slacks were defined. " << std::endl;
-}
-
 void lagNonOverlapping::resetSlacks(){
     resetLengthSlacks();
     resetSourceTargetSlacks();
@@ -267,41 +214,6 @@ void lagNonOverlapping::resetSlacks(){
     }
 }
 
-/********************************************* SLACKS PRIMAL APPROXIMATION *************************************************/
-
-/* Initializes the slack of relaxed constraints. */
-void lagNonOverlapping::initPrimalSlacks(){
-    initializeLengthPrimalSlacks();
-    initializeSourceTargetPrimalSlacks();
-    initializeFlowPrimalSlacks();
-
-    initializeOneSlicePerDemandPrimalSlacks();
-
-    Input::ObjectiveMetric chosenMetric = getInstance().getInput().getChosenObj_k(0);
-    if(chosenMetric == Input::OBJECTIVE_METRIC_8){
-        initializeMaxUsedSliceOverallPrimalSlacks();
-        initializeMaxUsedSliceOverallAuxPrimalSlacks();
-        //initializeMaxUsedSliceOverall2Slacks();
-        //initializeMaxUsedSliceOverall3Slacks();
-    }   
-    std::cout << "> Initial Slacks were defined. " << std::endl;
-}
-
-/*************************************************** DIRECTION ********************************************************/
-
-void lagNonOverlapping::initDirection(){
-    initializeLengthDirection();
-    initializeSourceTargetDirection();
-    initializeFlowDirection();
-
-    Input::ObjectiveMetric chosenMetric = getInstance().getInput().getChosenObj_k(0);
-    if(chosenMetric == Input::OBJECTIVE_METRIC_8){
-        initializeMaxUsedSliceOverallDirection();
-        initializeMaxUsedSliceOverall2Direction();
-        initializeMaxUsedSliceOverall3Direction();
-    }
-}
-
 /********************************************* BUILD AUXILIARY GRAPH **************************************************/
 
 /* Builds an auxiliary graph for each edge */
@@ -393,52 +305,6 @@ void lagNonOverlapping::addENode(int e, int demand, int slice, int firstConst,co
 *                                                  UPDATE METHODS
 *********************************************************************************************************************** */
 
-/*************************************************** MULTIPLIERS ********************************************************/
-
-/* Updates lagrangian multiplier with the rule: u[k+1] = u[k] + t[k]*violation */
-void lagNonOverlapping::updateMultiplier(double step){
-    updateLengthMultiplier(step);
-    updateSourceTargetMultiplier(step);
-    updateFlowMultiplier(step);
-
-    Input::ObjectiveMetric chosenMetric = getInstance().getInput().getChosenObj_k(0);
-    if(chosenMetric == Input::OBJECTIVE_METRIC_8){
-        updateMaxUsedSliceOverallMultiplier(step);
-        updateMaxUsedSliceOverall2Multiplier(step);
-        updateMaxUsedSliceOverall3Multiplier(step);
-    }
-}
-
-/************************************** MULTIPLIER CONSIDERING THE STABILITY CENTER **************************************/
-
-void lagNonOverlapping::updateMultiplier_v2(double step){
-    updateLengthMultiplier_v2(step);
-    updateSourceTargetMultiplier_v2(step);
-    updateFlowMultiplier_v2(step);
-
-    Input::ObjectiveMetric chosenMetric = getInstance().getInput().getChosenObj_k(0);
-    if(chosenMetric == Input::OBJECTIVE_METRIC_8){
-        updateMaxUsedSliceOverallMultiplier_v2(step);
-        updateMaxUsedSliceOverall2Multiplier_v2(step);
-        updateMaxUsedSliceOverall3Multiplier_v2(step);
-    }
-}
-
-/***************************************************** STABILITY CENTER ***************************************************/
-
-void lagNonOverlapping::updateStabilityCenter(){
-    updateLengthSC();
-    updateSourceTargetSC();
-    updateFlowSC();
-
-    Input::ObjectiveMetric chosenMetric = getInstance().getInput().getChosenObj_k(0);
-    if(chosenMetric == Input::OBJECTIVE_METRIC_8){
-        updateMaxUsedSliceOverallSC();
-        updateMaxUsedSliceOverall2SC();
-        updateMaxUsedSliceOverall3SC();
-    }
-}
-
 /********************************************************** SLACK *********************************************************/
 
 void lagNonOverlapping::updateSlack(int d, const ListDigraph::Arc & arc){
@@ -454,42 +320,10 @@ void lagNonOverlapping::updateSlack(int d, const ListDigraph::Arc & arc){
     }
 }
 
-void lagNonOverlapping::updatePrimalSlack(double alpha){
-    updateLengthPrimalSlack(alpha);
-    updateSourceTargetPrimalSlack(alpha);
-    updateFlowPrimalSlack(alpha);
-
-    updateOneSlicePerDemandPrimalSlack(alpha);
-
-    Input::ObjectiveMetric chosenMetric = getInstance().getInput().getChosenObj_k(0);
-    if(chosenMetric == Input::OBJECTIVE_METRIC_8){
-        updateMaxUsedSliceOverallPrimalSlack(alpha);
-        updateMaxUsedSliceOverallAuxPrimalSlack(alpha);
-        //updateMaxUsedSliceOverall2PrimalSlack(alpha);
-        //updateMaxUsedSliceOverall3PrimalSlack(alpha);
-    }
-}
-
-/********************************************************** DIRECTION *****************************************************/
-
-void lagNonOverlapping::updateDirection(){
-    double theta = getDirectionMult();
-    updateLengthDirection(theta);
-    updateSourceTargetDirection(theta);
-    updateFlowDirection(theta);
-
-    Input::ObjectiveMetric chosenMetric = getInstance().getInput().getChosenObj_k(0);
-    if(chosenMetric == Input::OBJECTIVE_METRIC_8){
-        updateMaxUsedSliceOverallDirection(theta);
-        updateMaxUsedSliceOverall2Direction(theta);
-        updateMaxUsedSliceOverall3Direction(theta);
-    }
-}
-
 /**************************************************** ASSIGNMENT MATRIX *****************************************************/
 
 /* Updates the assignment of a edge based on the a given path. */
-void lagNonOverlapping::updateAssignment_k(int label, BellmanFord< ListDigraph, ListDigraph::ArcMap<double> > &path, const ListDigraph::Node &SOURCE, const ListDigraph::Node &TARGET){
+void lagNonOverlapping::updateAssignment_k(int label, BellmanFordCostArc &path, const ListDigraph::Node &SOURCE, const ListDigraph::Node &TARGET){
     
     ListDigraph::Node currentNode = TARGET;
     while (currentNode != SOURCE){
@@ -581,7 +415,7 @@ ListDigraph::Node lagNonOverlapping::getNodeFromIndex(int e, int id){
     return INVALID;
 }
 
-double lagNonOverlapping::getRealCostFromPath(int e, BellmanFord< ListDigraph, ListDigraph::ArcMap<double> > &path, const ListDigraph::Node &SOURCE, const ListDigraph::Node &TARGET){
+double lagNonOverlapping::getRealCostFromPath(int e, BellmanFordCostArc &path, const ListDigraph::Node &SOURCE, const ListDigraph::Node &TARGET){
     double total = 0.0;
     ListDigraph::Node currentNode = TARGET;
     while (currentNode != SOURCE){
@@ -1136,7 +970,7 @@ void lagNonOverlapping::run(bool adaptedSubproblem){
 
         /* Solving a shortest path for each edge considering the auxiliary graph */
         /* From the artificial source to the artificial target*/
-        BellmanFord<ListDigraph,ListDigraph::ArcMap<double>> shortestPath((*vecEGraph[e]), (*vecECost[e]));
+        BellmanFordCostArc shortestPath((*vecEGraph[e]), (*vecECost[e]), shortestPathPool);
         shortestPath.run(SOURCE);
         
         if(shortestPath.reached(TARGET) == false){ // There is always a path in this graph.
@@ -1685,29 +1519,10 @@ void lagNonOverlapping::createGraphFile(int it){
 ******************************************************************************* */
 
 lagNonOverlapping::~lagNonOverlapping(){
-    lagrangianMultiplierLength.clear();
-    lagrangianMultiplierSourceTarget.clear();
-    lagrangianMultiplierFlow.clear();
-
-    lengthSlack.clear();
-    sourceTargetSlack.clear();
-    flowSlack.clear();
-
-    lengthSlack_v2.clear();
-    sourceTargetSlack_v2.clear();
-    flowSlack_v2.clear();
-
-    lagrangianSCLength.clear();
-    lagrangianSCSourceTarget.clear();
-    lagrangianSCFlow.clear();
-
-    lengthDirection.clear();
-    sourceTargetDirection.clear();
-    flowDirection.clear();
-
     assignmentMatrix.clear();
 
     for (int e = 0; e < instance.getNbEdges(); e++){
+        shortestPathPool.release(vecEGraph[e].get());
         vecEGraph[e]->clear();
     }
     vecEGraph.clear();
@@ -83,6 +83,9 @@ class lagNonOverlapping: public AbstractLagFormulation{
 
         /********************************* MULTIPLIERS ***********************************/
 
+        /** Sets the relaxed constraints in the dual vectors. **/
+        void initDualLayout();
+
         void startMultipliers(double *,int,int);
         
         /** Sets the initial lagrangian multipliers values for the subgradient to run. **/
@@ -92,26 +95,10 @@ class lagNonOverlapping: public AbstractLagFormulation{
 
         void contractNodesFromLabel_v2(std::shared_ptr<ListDigraph>, ListDigraph::NodeMap<ListDigraph::Node>, int, int);
 
-        /********************************* STABILITY CENTER ***********************************/
-
-        /** Sets the initial lagrangian stability center values for the subgradient to run. **/
-        void initStabilityCenter();
-
         /********************************** SLACK ***************************************/
 
-        /** Initializes the slack of relaxed constraints. **/
-        void initSlacks();
-
         void resetSlacks();
 
-        void initPrimalSlacks();
-
-        void clearSlacks();
-
-        /********************************** DIRECTION **********************************/
-
-        void initDirection();
-
         /***************************** BUILDING AUXILIARY GRAPH *******************************/
 
         /** Constructs the auxiliary graphs for each edge e **/
@@ -125,9 +112,9 @@ class lagNonOverlapping: public AbstractLagFormulation{
         ******************************************************************************* */
         void run(bool=false);
 
-        double getRealCostFromPath(int, BellmanFord< ListDigraph, ListDigraph::ArcMap<double> > &, const ListDigraph::Node &, const ListDigraph::Node &);
+        double getRealCostFromPath(int, BellmanFordCostArc &, const ListDigraph::Node &, const ListDigraph::Node &);
         
-        void updateAssignment_k(int, BellmanFord< ListDigraph, ListDigraph::ArcMap<double> > &, const ListDigraph::Node &, const ListDigraph::Node &);
+        void updateAssignment_k(int, BellmanFordCostArc &, const ListDigraph::Node &, const ListDigraph::Node &);
 
         void subtractConstantValuesFromLagrCost();
 
@@ -208,7 +195,6 @@ class lagNonOverlapping: public AbstractLagFormulation{
         /** Returns the product of the normal slack with the slack considering the primal variables **/
         double getSlackPrimalSlackProd(double = -1.0);
 
-
         /****************************************************************************************/
         /*										Setters											*/
         /****************************************************************************************/
@@ -253,29 +239,10 @@ class lagNonOverlapping: public AbstractLagFormulation{
         /*										Update											*/
         /****************************************************************************************/
 
-        /********************************* MULTIPLIERS ***********************************/
-
-        /* Updates lagrangian multipliers with the rule: u[k+1] = u[k] + t[k]*violation */
-        void updateMultiplier(double);
-
-        /******** MULTIPLIER CONSIDERING THE STABILITY CENTER ************/
-
-        void updateMultiplier_v2(double);
-
-        /********************************* STABILITY CENTER ***********************************/
-
-        void updateStabilityCenter();
-
         /********************************* SLACK ***********************************/
 
         void updateSlack(int, const ListDigraph::Arc &);
 
-        void updatePrimalSlack(double);
-
-        /********************************* DIRECTION ***********************************/
-
-        void updateDirection();
-
         /********************************* COSTS ***********************************/
 
         /** Updates the arc costs. @note cost = coeff + u_d*length **/
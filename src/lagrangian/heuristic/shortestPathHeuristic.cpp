@@ -9,10 +9,26 @@ shortestPathHeuristic::shortestPathHeuristic(AbstractLagFormulation* form): Abst
         /* Initializing costs */
         heuristicCosts.emplace_back( std::make_shared<ArcCost>(*formulation->getVecGraphD(d), 0.0)); 
         freeArcs.emplace_back(std::make_shared<ListDigraph::ArcMap<bool>>(*formulation->getVecGraphD(d),true));
+        freeSubgraphs.emplace_back(std::make_shared<FilterArcs<ListDigraph>>(*formulation->getVecGraphD(d),(*freeArcs[d])));
         mapItLabel.emplace_back(std::make_shared<IterableIntMap<ListDigraph, ListDigraph::Arc>>(*formulation->getVecGraphD(d)));
         mapCopy<ListDigraph,ArcMap,IterableIntMap<ListDigraph, ListDigraph::Arc>>((*formulation->getVecGraphD(d)),(*formulation->getArcLabelMap(d)),(*mapItLabel[d]));
         mapItLower.emplace_back(std::make_shared<IterableIntMap<ListDigraph, ListDigraph::Arc>>(*formulation->getVecGraphD(d)));
     }  
+    if (Telemetry::isEnabled()){
+        Telemetry::measureMemory(Telemetry::MEMORY_HEURISTIC, getMemory());
+    }
+}
+
+/* Per arc: the cost, the free flag, two iterable int maps (a value and two links) and the iterable bool map of the 
+solution (a position and an item). */
+std::size_t shortestPathHeuristic::getMemory() const{
+    std::size_t bytes = 0;
+    for (int d = 0; d < formulation->getNbDemandsToBeRouted(); d++){
+        const ListDigraph &g = *formulation->getVecGraphD(d);
+        bytes += MemoryUsage::ofArcMap(g, sizeof(double) + sizeof(bool) + 2*3*sizeof(int) + 2*sizeof(int));
+        bytes += MemoryUsage::ofVector(heuristicSolution[d]);
+    }
+    return bytes;
 }
 
 /* *******************************************************************************
@@ -199,8 +215,7 @@ bool shortestPathHeuristic::heuristicRun(int d){
     const ListDigraph::Node TARGET = formulation->getFirstNodeFromLabel(d, formulation->getToBeRouted_k(d).getTarget());
 
     /** Shortest path with the heuristic cost**/
-    FilterArcs<ListDigraph> subgraph((*formulation->getVecGraphD(d)), (*freeArcs[d]));
-    Dijkstra< FilterArcs<ListDigraph>, ListDigraph::ArcMap<double> > shortestPath(subgraph, (*heuristicCosts[d]));
+    PooledDijkstra< FilterArcs<ListDigraph>, ListDigraph::ArcMap<double> > shortestPath((*freeSubgraphs[d]), (*heuristicCosts[d]), shortestPathPool);
     //Dijkstra< ListDigraph, ListDigraph::ArcMap<double> > shortestPath(*formulation->getVecGraphD(d), (*heuristicCosts[d]));
     shortestPath.run(SOURCE, TARGET);
    
@@ -238,8 +253,7 @@ bool shortestPathHeuristic::heuristicAdaptedRun(int d){
     const ListDigraph::Node TARGET = formulation->getFirstNodeFromLabel(d, formulation->getToBeRouted_k(d).getTarget());
 
     /** Shortest path with the heuristic cost**/
-    FilterArcs<ListDigraph> subgraph(*formulation->getVecGraphD(d), (*freeArcs[d]));
-    CapacityScaling<FilterArcs<ListDigraph>,int,double> costScale(subgraph);
+    CapacityScaling<FilterArcs<ListDigraph>,int,double> &costScale = shortestPathPool.getCapacityScaling(*freeSubgraphs[d]);
     costScale.costMap((*heuristicCosts[d]));
     costScale.lowerMap((*formulation->getArcLowerMap(d)));
     costScale.upperMap((*formulation->getArcUpperMap(d)));
@@ -459,7 +473,7 @@ void shortestPathHeuristic::insertPath_k(int d, CapacityScaling<FilterArcs<ListD
 }
 
 /* Changes the heuristic Solution considering the found path for demand d*/
-void shortestPathHeuristic::insertPath_k(int d, Dijkstra< FilterArcs<ListDigraph>, ListDigraph::ArcMap<double> > &path, const ListDigraph::Node &SOURCE, const ListDigraph::Node &TARGET){
+void shortestPathHeuristic::insertPath_k(int d, PooledDijkstra< FilterArcs<ListDigraph>, ListDigraph::ArcMap<double> > &path, const ListDigraph::Node &SOURCE, const ListDigraph::Node &TARGET){
     ListDigraph::Node currentNode = TARGET;
     while (currentNode != SOURCE){
         ListDigraph::Arc arc = path.predArc(currentNode);
@@ -524,7 +538,7 @@ void shortestPathHeuristic::remove_Arc(int d, Dijkstra< ListDigraph, ListDigraph
 }
 
 /* "Remove" (cost infinite) arc with highest length, so  it can not be selected -> respect length constraints  */
-void shortestPathHeuristic::remove_Arc(int d, Dijkstra< FilterArcs<ListDigraph>, ListDigraph::ArcMap<double> > &path, const ListDigraph::Node &SOURCE, const ListDigraph::Node &TARGET){
+void shortestPathHeuristic::remove_Arc(int d, PooledDijkstra< FilterArcs<ListDigraph>, ListDigraph::ArcMap<double> > &path, const ListDigraph::Node &SOURCE, const ListDigraph::Node &TARGET){
     ListDigraph::Node currentNode = TARGET;
     ListDigraph::Arc arcHighestLength = path.predArc(currentNode);
     double length = formulation->getArcLength(arcHighestLength,d);
@@ -583,7 +597,7 @@ double shortestPathHeuristic::getPathLength(int d, Dijkstra< ListDigraph, ListDi
 }
 
 /* Returns the physical length of the path. */
-double shortestPathHeuristic::getPathLength(int d, Dijkstra< FilterArcs<ListDigraph>, ListDigraph::ArcMap<double> > &path, const ListDigraph::Node &s, const ListDigraph::Node &t){
+double shortestPathHeuristic::getPathLength(int d, PooledDijkstra< FilterArcs<ListDigraph>, ListDigraph::ArcMap<double> > &path, const ListDigraph::Node &s, const ListDigraph::Node &t){
     double pathLength = 0.0;
     ListDigraph::Node n = t;
     while (n != s){
@@ -614,6 +628,10 @@ double shortestPathHeuristic::getPathLength(int d, CapacityScaling<FilterArcs<Li
 ******************************************************************************* */
 
 shortestPathHeuristic::~shortestPathHeuristic(){
+    for (unsigned int d = 0; d < freeSubgraphs.size(); d++){
+        shortestPathPool.release(freeSubgraphs[d].get());
+    }
+    freeSubgraphs.clear();
     heuristicCosts.clear();
     freeArcs.clear();
     mapItLabel.clear();
@@ -14,6 +14,12 @@ class shortestPathHeuristic : public AbstractHeuristic{
         /* A list of pointers to the bool Map Arc storing if the arc is used in the Heuristic Shortest Path */
         std::vector<std::shared_ptr<ListDigraph::ArcMap<bool>>> freeArcs;
 
+        /* A list of pointers to the subgraphs restricted to the free arcs. They are kept alive so the shortest path workspaces of the pool are reused */
+        std::vector<std::shared_ptr<FilterArcs<ListDigraph>>> freeSubgraphs;
+
+        /* The shortest path workspaces and min-cost flow solvers of the subgraphs above */
+        ShortestPathPool shortestPathPool;
+
         std::vector<std::shared_ptr<IterableIntMap<ListDigraph, ListDigraph::Arc>>> mapItLabel; 
 
         std::vector<std::shared_ptr<IterableIntMap<ListDigraph, ListDigraph::Arc>>> mapItLower;
@@ -37,6 +43,9 @@ class shortestPathHeuristic : public AbstractHeuristic{
         /* Initializes the Heuristics elements to run the algorithm */
         void init(bool=true);
 
+        /* Returns the memory (bytes) estimated for the maps of the heuristic, the solution maps of AbstractHeuristic included */
+        std::size_t getMemory() const;
+
         /* Initialize the sets of not analysed demands and analysed demands for the Heuristic - to run the algorithm*/
         void initDemandsSets();
 
@@ -66,7 +75,7 @@ class shortestPathHeuristic : public AbstractHeuristic{
         /* Changes the heuristic Solutin including the found path to demand d */
         void insertPath_k(int, Dijkstra< ListDigraph, ListDigraph::ArcMap<double> > &, const ListDigraph::Node &, const ListDigraph::Node &);
 
-        void insertPath_k(int d, Dijkstra< FilterArcs<ListDigraph>, ListDigraph::ArcMap<double> > &, const ListDigraph::Node &, const ListDigraph::Node &);
+        void insertPath_k(int d, PooledDijkstra< FilterArcs<ListDigraph>, ListDigraph::ArcMap<double> > &, const ListDigraph::Node &, const ListDigraph::Node &);
 
         void insertPath_k(int d, CapacityScaling<FilterArcs<ListDigraph>,int,double> &path, const ListDigraph::Node &SOURCE, const ListDigraph::Node &TARGET);
 
@@ -83,14 +92,14 @@ class shortestPathHeuristic : public AbstractHeuristic{
         /* "Remove" (cost infinite) arc with highest length, so  it can not be selected -> respect length constraints  */
         void remove_Arc(int, Dijkstra< ListDigraph, ListDigraph::ArcMap<double> > &, const ListDigraph::Node &, const ListDigraph::Node &);
 
-        void remove_Arc(int, Dijkstra< FilterArcs<ListDigraph>, ListDigraph::ArcMap<double> > &, const ListDigraph::Node &, const ListDigraph::Node &);
+        void remove_Arc(int, PooledDijkstra< FilterArcs<ListDigraph>, ListDigraph::ArcMap<double> > &, const ListDigraph::Node &, const ListDigraph::Node &);
 
         void remove_Arc(int d, CapacityScaling<FilterArcs<ListDigraph>,int,double> &, const ListDigraph::Node &, const ListDigraph::Node &);
  
         /* Returns the physical length of the path. */
         double getPathLength(int d, Dijkstra< ListDigraph, ListDigraph::ArcMap<double> > &path, const ListDigraph::Node &s, const ListDigraph::Node &t);
 
-        double getPathLength(int d, Dijkstra< FilterArcs<ListDigraph>, ListDigraph::ArcMap<double> > &path, const ListDigraph::Node &s, const ListDigraph::Node &t);
+        double getPathLength(int d, PooledDijkstra< FilterArcs<ListDigraph>, ListDigraph::ArcMap<double> > &path, const ListDigraph::Node &s, const ListDigraph::Node &t);
 
         double getPathLength(int d, CapacityScaling<FilterArcs<ListDigraph>,int,double> &costScale);
 
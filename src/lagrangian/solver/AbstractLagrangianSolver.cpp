@@ -6,7 +6,7 @@
 
 AbstractLagSolver::AbstractLagSolver(const Instance &inst, const Status &s): MAX_NB_IT_WITHOUT_IMPROVEMENT(inst.getInput().getNbIterationsWithoutImprovement()), 
         MAX_NB_IT(inst.getInput().getMaxNbIterations()), INITIAL_STEPSIZE(inst.getInput().getInitialLagrangianLambda()),
-        MIN_STEPSIZE(0.0001), PRIMAL_ABS_PRECISION(0.0001), UBINIT(__DBL_MAX__/2),DUAL_LIMIT(__DBL_MAX__/2),currentStatus(s),dualinf(false),time(ClockTime::getTimeNow()),generalTime(ClockTime::getTimeNow()){
+        MIN_STEPSIZE(0.0001), PRIMAL_ABS_PRECISION(0.0001), UBINIT(__DBL_MAX__/2),DUAL_LIMIT(__DBL_MAX__/2),hotStart(false),currentStatus(s),dualinf(false),time(ClockTime::getTimeNow()),generalTime(ClockTime::getTimeNow()),recordedReusedSubproblems(0){
 
     lagFormulationFactory factory;
     formulation = factory.createFormulation(inst);
@@ -73,6 +73,40 @@ void AbstractLagSolver::updateUB(double bound){
     }
 }
 
+/* Reports the time accumulated by each phase and the subproblems reused since the last report. */
+void AbstractLagSolver::recordTelemetry(){
+    if (!Telemetry::isEnabled()){
+        return;
+    }
+    const std::pair<const char*, double> times[] = {
+        std::make_pair("solvingSubProblem", solvingSubProblemTime), std::make_pair("updatingSlack", updatingSlackTime),
+        std::make_pair("updatingBounds", updatingBoundsTime), std::make_pair("heuristicBound", heuristicBoundTime),
+        std::make_pair("updatingMultipliers", updatingMultipliersTime), std::make_pair("updatingCosts", updatingCostsTime),
+        std::make_pair("stoppingCriterion", stoppingCriterionTime), std::make_pair("updatingPrimalVariables", updatingPrimalVariablesTime),
+        std::make_pair("updateVariables", updateVariablesTime), std::make_pair("shortestPath", ShorstestPathTime),
+        std::make_pair("substractMultipliers", substractMultipliersTime), std::make_pair("updateStepLambda", updateStepLambdaTime),
+        std::make_pair("cost", costTime)
+    };
+    for (unsigned int i = 0; i < sizeof(times)/sizeof(times[0]); i++){
+        double &recorded = recordedTimes[times[i].first];
+        /* A time that went down was reset by a setter: all of it is new. */
+        double elapsed = (times[i].second >= recorded) ? times[i].second - recorded : times[i].second;
+        if (elapsed > 0.0){
+            Telemetry::record(times[i].first, elapsed);
+        }
+        recorded = times[i].second;
+    }
+    int nbReused = formulation->getNbReusedSubproblems();
+    Telemetry::count(Telemetry::COUNTER_REUSED_SUBPROBLEMS, nbReused - recordedReusedSubproblems);
+    recordedReusedSubproblems = nbReused;
+}
+
+/* Counts an evaluation of the sub problem and traces the lower bound it leaves. */
+void AbstractLagSolver::traceEvaluation(){
+    boundTrace.push_back(getLB());
+    Telemetry::count(Telemetry::COUNTER_SUBPROBLEMS);
+}
+
 /******************************************************************************************************************************/
 /*										                    DISPLAY  									                      */
 /******************************************************************************************************************************/
@@ -4,6 +4,7 @@
 #include "../formulation/lagFormulationFactory.h"
 #include "../heuristic/heuristicFactory.h"
 #include "../../tools/clockTime.h"
+#include "../../tools/telemetry.h"
 #include "../../topology/instance.h"
 
 /**********************************************************************************************
@@ -36,6 +37,7 @@ class AbstractLagSolver{
         double UBINIT;
         double DUAL_LIMIT;
         bool feasibleHeuristic;
+        bool hotStart;                              /**< True while solving from a hot start: the stability center and primal approximation are kept. **/
 
         Status currentStatus;
         bool dualinf;
@@ -66,6 +68,15 @@ class AbstractLagSolver{
 
         double totalTime;
 
+        /** Accumulated times already reported to the telemetry, by phase name. **/
+        std::map<std::string, double> recordedTimes;
+
+        /** Number of reused subproblems already reported to the telemetry. **/
+        int recordedReusedSubproblems;
+
+        /** Lower bound after each evaluation of the sub problem since the last initialization. **/
+        std::vector<double> boundTrace;
+
         int iteration;
         int itWithoutImprovement;
         int globalItWithoutImprovement;
@@ -106,10 +117,10 @@ class AbstractLagSolver{
         std::string getStop() const { return stop;}
 
         int getNbMaxIterations() const {return MAX_NB_IT; }
-        int& getNbMaxIterations() {return MAX_NB_IT; } /*for the hot start in the OsiLagSolverInterface */
         double getPrimalAbsPrecision() const { return PRIMAL_ABS_PRECISION;}
         double getUBInit() const { return UBINIT;}
         double getDualLimit() const { return DUAL_LIMIT;}
+        bool isHotStart() const { return hotStart;}
         bool getDualInf() const { return dualinf;}
 
         ClockTime getGeneralTime() const { return generalTime;}
@@ -137,6 +148,10 @@ class AbstractLagSolver{
 
 
         int getIteration() const { return iteration; }
+
+        /** Returns the lower bound after each evaluation of the sub problem since the last initialization. **/
+        const std::vector<double> & getBoundTrace() const { return boundTrace; }
+
         int getItWithoutImprovement() const { return itWithoutImprovement; }
 
         int getGlobalItWithoutImprovement() const { return globalItWithoutImprovement;}
@@ -168,38 +183,39 @@ class AbstractLagSolver{
         void setPrimalAbsPrecision(double value) { PRIMAL_ABS_PRECISION = value;}
         void setUBInit(double value) { UBINIT = value;}
         void setDualLimit(double value) { DUAL_LIMIT = value;}
+        void setHotStart(bool value) { hotStart = value;}
         void setDualInf(bool value) { dualinf = value;}
 
-        void setFormulationConstTime(double value) { formulationConstTime = value; }
-        void setHeuristicConstTime(double value) { heuristicConstTime = value; }
-        void setInitializationTime(double value) { initializationTime = value; }
-        void setConstAuxGraphTime(double value) { constAuxGraphTime = value;}
+        void setFormulationConstTime(double value) { formulationConstTime = value; Telemetry::record("formulation", value); }
+        void setHeuristicConstTime(double value) { heuristicConstTime = value; Telemetry::record("heuristic", value); }
+        void setInitializationTime(double value) { initializationTime = value; Telemetry::record("initialization", value); }
+        void setConstAuxGraphTime(double value) { constAuxGraphTime = value; Telemetry::record("auxiliaryGraph", value); }
         void setSolvingSubProblemTime(double value) { solvingSubProblemTime = value;}
-        void incSolvingSubProblemTime(double value) { solvingSubProblemTime += value;}
+        void incSolvingSubProblemTime(double value) { solvingSubProblemTime += value; }
         void setUpdatingSlackTime(double value) {updatingSlackTime = value;}
-        void incUpdatingSlackTime(double value) {updatingSlackTime += value;}
+        void incUpdatingSlackTime(double value) { updatingSlackTime += value; }
         void setUpdatingBoundsTime(double value) {updatingBoundsTime = value;}
-        void incUpdatingBoundsTime(double value) {updatingBoundsTime += value;}
+        void incUpdatingBoundsTime(double value) { updatingBoundsTime += value; }
         void setHeuristicBoundTime(double value) {heuristicBoundTime = value;}
-        void incHeuristicBoundTime(double value) {heuristicBoundTime += value;}
+        void incHeuristicBoundTime(double value) { heuristicBoundTime += value; }
         void setUpdatingMultipliersTime(double value) {updatingMultipliersTime = value;}
-        void incUpdatingMultipliersTime(double value) {updatingMultipliersTime += value;}
+        void incUpdatingMultipliersTime(double value) { updatingMultipliersTime += value; }
         void setUpdatingCostsTime(double value) {updatingCostsTime = value;}
-        void incUpdatingCostsTime(double value) {updatingCostsTime += value;}
+        void incUpdatingCostsTime(double value) { updatingCostsTime += value; }
         void setStoppingCriterionTime(double value) {stoppingCriterionTime = value;}
-        void incStoppingCriterionTime(double value) {stoppingCriterionTime += value;}
+        void incStoppingCriterionTime(double value) { stoppingCriterionTime += value; }
         void setUpdatingPrimalVariablesTime(double value) {updatingPrimalVariablesTime = value;}
-        void incUpdatingPrimalVariablesTime(double value) {updatingPrimalVariablesTime += value;}
+        void incUpdatingPrimalVariablesTime(double value) { updatingPrimalVariablesTime += value; }
         void setUpdateVariablesTime(double value) { updateVariablesTime = value; }
         void incUpdateVariablesTime(double value) { updateVariablesTime += value; }
         void setShorstestPathTime(double value) { ShorstestPathTime = value; }
         void incShorstestPathTime(double value) { ShorstestPathTime += value; }
         void setSubstractMultipliersTime(double value) { substractMultipliersTime = value;}
-        void incSubstractMultipliersTime(double value) { substractMultipliersTime+=value;}
+        void incSubstractMultipliersTime(double value) { substractMultipliersTime+=value; }
         void setUpdateStepLambdaTime(double value) { updateStepLambdaTime=value;}
-        void incUpdateStepLambdaTime(double value) {updateStepLambdaTime+=value;}
+        void incUpdateStepLambdaTime(double value) { updateStepLambdaTime+=value; }
         void setCostTime(double value) { costTime=value;}
-        void incCostTime(double value) {costTime+=value;}
+        void incCostTime(double value) { costTime+=value; }
         void setRSAGraphConstructionTime(double val) { RSAGraphConstructionTime = val;}
         void setPreprocessingTime(double val) { PreprocessingTime = val;}
 
@@ -231,6 +247,13 @@ class AbstractLagSolver{
         /* Updates the known upper bound. */
         void updateUB(double bound);
 
+        /* Reports to the telemetry the time accumulated by each phase and the subproblems reused since the last report. The
+        inc*Time setters only accumulate, as they are called in the inner loops; this is called once at the end of each run. */
+        void recordTelemetry();
+
+        /* Counts an evaluation of the sub problem and traces the lower bound it leaves. Called at each iteration, after the lower bound is updated. */
+        void traceEvaluation();
+
         /* Updates the step size with the rule: lambda*(UB - Z[u])/|slack| */
         virtual void updateStepSize() = 0;
         
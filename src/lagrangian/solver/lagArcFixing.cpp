@@ -0,0 +1,83 @@
+#include "lagArcFixing.h"
+
+/****************************************************************************************/
+/*										Methods											*/
+/****************************************************************************************/
+
+/* The Lagrangian relaxation is solved on a copy of the instance using the fixing method and the flow formulation,
+since the bounds rely on its sub problem being a shortest path per demand. */
+void lagArcFixing::run(){
+    ClockTime time(ClockTime::getTimeNow());
+    std::cout << "--- Lagrangian arc fixing was invoked ---" << std::endl;
+    instance.clearFixedArcs();
+
+    Input input(instance.getInput());
+    switch (instance.getInput().getChosenFixingMethod()){
+        case Input::FIXING_VOLUME:
+            input.setChosenNodeMethod(Input::NODE_METHOD_VOLUME);
+            break;
+        case Input::FIXING_BUNDLE:
+            input.setChosenNodeMethod(Input::NODE_METHOD_BUNDLE);
+            break;
+        default:
+            input.setChosenNodeMethod(Input::NODE_METHOD_SUBGRADIENT);
+            break;
+    }
+    input.setChosenLagFormulation(Input::LAG_FLOW);
+    Instance lagInstance(instance, input);
+
+    lagSolverFactory factory;
+    solver = factory.createSolver(lagInstance);
+    solver->run();
+
+    lagFlow *formulation = dynamic_cast<lagFlow*>(solver->getLagrangianFormulation());
+    upperBound = solver->getUB();
+    if (formulation == NULL || upperBound >= solver->getUBInit() - FIXING_PRECISION){
+        std::cout << "> No upper bound was found. No arc is fixed." << std::endl;
+        fixingTime = time.getTimeInSecFromStart();
+        return;
+    }
+
+    /* The bounds must be computed with the multipliers at hand, which may not be the ones of the best lower bound. */
+    formulation->run();
+    if (formulation->getStatus() == RSA::STATUS_INFEASIBLE){
+        std::cout << "> The Lagrangian sub problem is infeasible. No arc is fixed." << std::endl;
+        fixingTime = time.getTimeInSecFromStart();
+        return;
+    }
+    lowerBound = formulation->getLagrCurrentCost();
+    fixArcs(*formulation);
+
+    fixingTime = time.getTimeInSecFromStart();
+    displayStatistics();
+}
+
+/* An arc is fixed if the best solution routing its demand through it has a Lagrangian bound greater than the upper bound. */
+void lagArcFixing::fixArcs(lagFlow &formulation){
+    nbArcs = 0;
+    nbFixedArcs = 0;
+    for (int d = 0; d < formulation.getNbDemandsToBeRouted(); d++){
+        const ListDigraph &graph = *formulation.getVecGraphD(d);
+        int demandId = formulation.getToBeRouted_k(d).getId();
+        ArcCost bound(graph);
+        formulation.getArcLagrangianBound(d, bound);
+        for (ListDigraph::ArcIt a(graph); a != INVALID; ++a){
+            nbArcs++;
+            if (bound[a] > upperBound + FIXING_PRECISION){
+                int uLabel = formulation.getNodeLabel(graph.source(a), d);
+                instance.addFixedArc(demandId, formulation.getArcLabel(a, d), formulation.getArcSlice(a, d), uLabel);
+                nbFixedArcs++;
+            }
+        }
+    }
+}
+
+/****************************************************************************************/
+/*										Display											*/
+/****************************************************************************************/
+
+void lagArcFixing::displayStatistics(std::ostream & saida){
+    double ratio = (nbArcs > 0) ? (100.0*nbFixedArcs)/nbArcs : 0.0;
+    saida << "> Lagrangian arc fixing: LB = " << lowerBound << ", UB = " << upperBound << "." << std::endl;
+    saida << "> " << nbFixedArcs << " of " << nbArcs << " arcs were fixed to zero (" << ratio << "%) in " << fixingTime << " secs." << std::endl;
+}
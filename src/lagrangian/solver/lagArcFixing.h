@@ -0,0 +1,67 @@
+#ifndef LAG_ARC_FIXING_H
+#define LAG_ARC_FIXING_H
+
+#include "lagSolverFactory.h"
+#include "../formulation/lagFlow.h"
+
+/**********************************************************************************************
+ * Lagrangian arc fixing, run before the MIP is built. The Lagrangian flow relaxation is solved
+ * with the chosen method; its lower bound and the upper bound of its heuristic are then used to
+ * discard arcs: for each arc of each demand, the Lagrangian bound of the solutions routing the
+ * demand through the arc is computed from forward and backward shortest path distances on the
+ * reduced costs. If this bound exceeds the upper bound, no solution at least as good as the
+ * incumbent uses the arc, which is fixed to zero in the instance and erased from the graph of
+ * the demand when the RSA of the MIP is built.
+ * *******************************************************************************************/
+
+class lagArcFixing{
+
+    private:
+        const double FIXING_PRECISION;  /**< Arcs are fixed if their bound exceeds the upper bound by more than this value. **/
+
+        Instance &instance;             /**< The instance receiving the fixed arcs. **/
+        AbstractLagSolver *solver;      /**< The Lagrangian solver giving the bounds and the multipliers. **/
+
+        double lowerBound;              /**< Lagrangian cost at the multipliers used for fixing. **/
+        double upperBound;              /**< Upper bound given by the heuristic. **/
+        int nbArcs;                     /**< Number of arcs in the graphs of the Lagrangian formulation. **/
+        int nbFixedArcs;                /**< Number of arcs fixed to zero. **/
+        double fixingTime;              /**< Time spent in the fixing stage (including the Lagrangian solve). **/
+
+    public:
+        /************************************************/
+	    /*				    Constructors 		   		*/
+	    /************************************************/
+        lagArcFixing(Instance &inst):FIXING_PRECISION(0.0001),instance(inst),solver(NULL),lowerBound(0.0),upperBound(0.0),nbArcs(0),nbFixedArcs(0),fixingTime(0.0){}
+
+        /************************************************/
+	    /*				    GETTERS      		   		*/
+	    /************************************************/
+
+        double getLowerBound() const { return lowerBound; }
+        double getUpperBound() const { return upperBound; }
+        int getNbArcs() const { return nbArcs; }
+        int getNbFixedArcs() const { return nbFixedArcs; }
+        double getFixingTime() const { return fixingTime; }
+
+        /************************************************/
+	    /*				    Methods      		   		*/
+	    /************************************************/
+
+        /** Solves the Lagrangian relaxation and fixes the arcs of the instance. **/
+        void run();
+
+        /** Fixes the arcs whose Lagrangian bound exceeds the upper bound. **/
+        void fixArcs(lagFlow &);
+
+        /************************************************/
+	    /*				    Display      		   		*/
+	    /************************************************/
+
+        void displayStatistics(std::ostream & = std::cout);
+
+        ~lagArcFixing(){ delete solver; }
+
+};
+
+#endif
@@ -0,0 +1,562 @@
+#include "lagBundle.h"
+
+/*****************************************************************************************************************************/
+/*					                                      INITIALIZATION 		    		                                 */
+/*****************************************************************************************************************************/
+
+/* Sets the initial parameters for the bundle method to run. */
+void lagBundle::initialization(bool initMultipliers){
+    /** Setting initial time **/
+    setInitializationTime(0.0);
+    setConstAuxGraphTime(0.0);
+    setSolvingSubProblemTime(0.0);
+    setUpdateVariablesTime(0.0);
+    setShorstestPathTime(0.0);
+    setSubstractMultipliersTime(0.0);
+    setUpdatingSlackTime(0.0);
+    setUpdatingBoundsTime(0.0);
+    setHeuristicBoundTime(0.0);
+    setUpdatingMultipliersTime(0.0);
+    setUpdatingCostsTime(0.0);
+    setStoppingCriterionTime(0.0);
+    setUpdatingPrimalVariablesTime(0.0);
+    setUpdateStepLambdaTime(0.0);
+    setCostTime(0.0);
+
+    time.setStart(ClockTime::getTimeNow());
+
+    setIteration(0);
+    boundTrace.clear();
+    setItWithoutImprovement(0);
+    setGlobalItWithoutImprovement(0);
+    setStepSize(0.000);
+
+    setLB(-__DBL_MAX__);
+    setUB(1000000);
+
+    formulation->setStatus(RSA::STATUS_UNKNOWN);
+
+    initLambda();
+    formulation->init(initMultipliers);
+
+    UBINIT = formulation->initialUBValue();
+    setUB(UBINIT);
+    std::cout << "Bundle: Initial UB: " << UBINIT << std::endl;
+
+    /** Empty bundle **/
+    int n = formulation->getNbDuals();
+    cutSlack.clear();
+    cutValue.clear();
+    cutWeight.clear();
+    gram.assign(MAX_BUNDLE_SIZE*MAX_BUNDLE_SIZE, 0.0);
+    mask.assign(formulation->getDualActiveData(), formulation->getDualActiveData() + n);
+    gramMask = mask;
+    aggregated.assign(n, 0.0);
+    trialStep.assign(n, 0.0);
+
+    centerValue = -__DBL_MAX__;
+    predictedIncrease = __DBL_MAX__;
+    trialPredictedIncrease = 0.0;
+    trialIncrease = 0.0;
+    initialProx = 1.0;
+    nbSeriousSteps = 0;
+    nbNullSteps = 0;
+    nbConsecutiveNullSteps = 0;
+    seriousStep = false;
+
+    setStatus(STATUS_UNKNOWN);
+    setDualInf(false);
+
+    setInitializationTime(time.getTimeInSecFromStart());
+    setConstAuxGraphTime(formulation->getConstAuxGraphTime());
+
+    feasibleHeuristic = true;
+
+    std::cout << "> Initialization is done. " << std::endl;
+}
+
+/*****************************************************************************************************************************/
+/*					                                       RUNNING METHODS 		    		                                 */
+/*****************************************************************************************************************************/
+
+void lagBundle::run(bool initMultipliers, bool modifiedSubproblem){
+    std::cout << "--- Bundle was invoked ---" << std::endl;
+
+    initialization(initMultipliers);
+
+    bool STOP = false;
+    while (!STOP){
+        runIteration(modifiedSubproblem);
+        if (formulation->getStatus() != RSA::STATUS_INFEASIBLE){
+
+            time.setStart(ClockTime::getTimeNow());
+            updateBundle();
+            incUpdatingSlackTime(time.getTimeInSecFromStart());
+
+            time.setStart(ClockTime::getTimeNow());
+            updateMultipliers();
+            incUpdatingMultipliersTime(time.getTimeInSecFromStart());
+
+            displayMainParameters(fichier);
+
+            time.setStart(ClockTime::getTimeNow());
+            bool alternativeStop = formulation->getInstance().getInput().getAlternativeStop();
+            if((getLB() >= getUB() - 0.001) && (getLB() < (UBINIT-0.001))){
+                STOP = true;
+                formulation->setStatus(RSA::STATUS_OPTIMAL);
+                setStatus(STATUS_OPTIMAL);
+                setStop("Optimal");
+                std::cout << "Bundle: Integer Optimal by UB: " << getLB() << std::endl;
+            }
+            else if(formulation->checkSlacknessCondition() && formulation->checkFeasibility()){
+                STOP = true;
+                formulation->setStatus(RSA::STATUS_OPTIMAL);
+                setStatus(STATUS_OPTIMAL);
+                setStop("Optimal");
+                std::cout << "Bundle: Integer Optimal by slackness: " << getLB() << " " << formulation->getLagrCurrentCost() << std::endl;
+            }
+            else if(predictedIncrease <= MIN_REL_PREDICTED_INCREASE*std::max(1.0, std::abs(centerValue))){
+                STOP = true;
+                setStatus(STATUS_OPTIMAL);
+                setStop("Small predicted increase");
+                std::cout << "Bundle: Small predicted increase: " << getLB() << std::endl;
+            }
+            else if (getIteration() >= MAX_NB_IT){
+                STOP = true;
+                setStatus(STATUS_OPTIMAL);
+                setStop("Max It");
+                std::cout << "Bundle: Maximum number iterations: " << getLB() << std::endl;
+            }
+            else if(alternativeStop){
+                if(getGlobalItWithoutImprovement() >= 5*MAX_NB_IT_WITHOUT_IMPROVEMENT){
+                    STOP = true;
+                    setStatus(STATUS_OPTIMAL);
+                    setStop("Alternative stop");
+                    std::cout << "Bundle: Alternative stop." << std::endl;
+                }
+            }
+            if(getLB() >= UBINIT -1){
+                STOP = true;
+                setStatus(STATUS_INFEASIBLE);
+                setStop("Infeasible");
+                std::cout << "Bundle: Primal infeasible, dual unbounded." << std::endl;
+            }
+            if(getLB() >= DUAL_LIMIT){
+                STOP = true;
+                setStop("dual limit");
+                std::cout << "Bundle: Dual limit reached." << std::endl;
+            }
+            if(STOP){
+                /* The dual solution is the stability center. */
+                formulation->updateMultiplierFromCenter(aggregated.data(), 0.0);
+            }
+            incStoppingCriterionTime(time.getTimeInSecFromStart());
+        }
+        else{
+            STOP = true;
+            setStatus(STATUS_INFEASIBLE);
+            setDualInf(true);
+            setStop("Infeasible");
+            std::cout << "Bundle: infeasible sub problem." << std::endl;
+        }
+        if(STOP==true){
+            setTotalTime(getGeneralTime().getTimeInSecFromStart());
+            setUpdateVariablesTime(formulation->getUpdateVariablesTime());
+            setShorstestPathTime(formulation->getShorstestPathTime());
+            setSubstractMultipliersTime(formulation->getSubstractMultipliersTime());
+            setCostTime(formulation->getCostTime());
+            setRSAGraphConstructionTime(formulation->getRSAGraphConstructionTime());
+            setPreprocessingTime(formulation->getPreprocessingTime());
+            recordTelemetry();
+            if(modifiedSubproblem){
+                formulation->verifyLowerUpperBound();
+            }
+        }
+    }
+}
+
+/* Evaluates the dual function at the current multipliers: runs the sub problem and updates the bounds. */
+void lagBundle::runIteration(bool modifiedSubproblem){
+    incIteration();
+
+    /** Solving sub problem **/
+    time.setStart(ClockTime::getTimeNow());
+    formulation->run(modifiedSubproblem);
+    incSolvingSubProblemTime(time.getTimeInSecFromStart());
+
+    /** Updating feasibility **/
+    time.setStart(ClockTime::getTimeNow());
+    if (formulation->checkFeasibility() == true && formulation->getStatus()!= RSA::STATUS_INFEASIBLE){
+        formulation->setStatus(RSA::STATUS_FEASIBLE);
+    }
+
+    /** Updating lower bound **/
+    updateLB(formulation->getLagrCurrentCost());
+    traceEvaluation();
+
+    /** Updating upper bound **/
+    if(formulation->getStatus() == RSA::STATUS_FEASIBLE){
+        double feasibleSolutionCost = formulation->getRealCurrentCost();
+        if (feasibleSolutionCost < getUB()){
+            updateUB(feasibleSolutionCost);
+            if(formulation->getInstance().getInput().isObj8(0)){
+                formulation->updateMaxUsedSliceOverallUpperBound(feasibleSolutionCost);
+            }
+            std::cout << " Ub by feasibility." << std::endl;
+        }
+    }
+    incUpdatingBoundsTime(time.getTimeInSecFromStart());
+
+    time.setStart(ClockTime::getTimeNow());
+    if(!modifiedSubproblem){
+        if(getIteration()<=5 || getIteration()%30 ==0){
+            heuristic->run(modifiedSubproblem);
+            double feasibleSolutionCostHeur = heuristic->getCurrentHeuristicCost();
+            updateUB(feasibleSolutionCostHeur);
+            if(formulation->getInstance().getInput().isObj8(0)){
+                formulation->updateMaxUsedSliceOverallUpperBound(feasibleSolutionCostHeur);
+            }
+        }
+    }
+    incHeuristicBoundTime(time.getTimeInSecFromStart());
+}
+
+/****************************************************************************************************************************/
+/*					                                      UPDATE 		    		                                        */
+/****************************************************************************************************************************/
+
+/* Updates the known lower bound. */
+void lagBundle::updateLB(double bound){
+    if (bound >= getLB() + __DBL_EPSILON__){
+        setLB(bound);
+        setItWithoutImprovement(0);
+        setGlobalItWithoutImprovement(0);
+    }
+    else{
+        incItWithoutImprovement();
+        incGlobalItWithoutImprovement();
+    }
+}
+
+/* Updates the proximal parameter. It is kept within [1e-6,1e6] times its initial value. */
+void lagBundle::updateStepSize(){
+    double t = getStepSize();
+    if(seriousStep){
+        if(trialIncrease >= GOOD_STEP_RATIO*trialPredictedIncrease){
+            t = std::min(t*UPD_PROX_INCREASE, initialProx*1e6);
+        }
+    }
+    else if(nbConsecutiveNullSteps >= MAX_NB_NULL_STEPS){
+        t = std::max(t*UPD_PROX_DECREASE, initialProx*1e-6);
+        nbConsecutiveNullSteps = 0;
+    }
+    setStepSize(t);
+}
+
+/* Adds the cut given by the last evaluation. The trial point becomes the stability center (serious step) if the
+dual function increased by at least a fraction of what the model predicted. */
+void lagBundle::updateBundle(){
+    const int n = formulation->getNbDuals();
+    const double *slack = formulation->getDualSlackData();
+    const double *active = formulation->getDualActiveData();
+    double value = formulation->getLagrCurrentCost();
+
+    /** First evaluation: it is the stability center and sets the initial proximal parameter as a Polyak step. **/
+    if(cutValue.empty()){
+        centerValue = value;
+        formulation->updateStabilityCenter();
+        addCut(slack, value);
+        seriousStep = true;
+        nbSeriousSteps++;
+        double norm = dualDot(slack, slack, active, n);
+        initialProx = (norm > __DBL_EPSILON__) ? getLambda()*std::abs(getUB() - value)/norm : 1.0;
+        if(initialProx <= __DBL_EPSILON__){
+            initialProx = 1.0;
+        }
+        setStepSize(initialProx);
+        return;
+    }
+
+    /** Model value at the trial point and value of the cuts at the trial point relative to the center. **/
+    const double *multiplier = formulation->getDualMultiplierData();
+    const double *center = formulation->getDualStabilityCenterData();
+    for (int i = 0; i < n; i++){
+        trialStep[i] = multiplier[i] - center[i];
+    }
+    std::vector<double> cutStep(cutValue.size());
+    double model = __DBL_MAX__;
+    for (unsigned int j = 0; j < cutValue.size(); j++){
+        cutStep[j] = dualDot(cutSlack[j].data(), trialStep.data(), active, n);
+        model = std::min(model, cutValue[j] - cutStep[j]);
+    }
+    trialPredictedIncrease = model - centerValue;
+    trialIncrease = value - centerValue;
+
+    double newCutValue;
+    if((trialIncrease > 0.0) && (trialIncrease >= SERIOUS_STEP_RATIO*trialPredictedIncrease)){
+        /* Serious step: the cuts are now written at the new center. */
+        for (unsigned int j = 0; j < cutValue.size(); j++){
+            cutValue[j] -= cutStep[j];
+        }
+        centerValue = value;
+        formulation->updateStabilityCenter();
+        newCutValue = value;
+        seriousStep = true;
+        nbSeriousSteps++;
+        nbConsecutiveNullSteps = 0;
+    }
+    else{
+        /* Null step: the cut is written at the current center. */
+        newCutValue = value + dualDot(slack, trialStep.data(), active, n);
+        seriousStep = false;
+        nbNullSteps++;
+        nbConsecutiveNullSteps++;
+    }
+    updateStepSize();
+
+    compressBundle();
+    addCut(slack, newCutValue);
+}
+
+/* Solves the master problem, possibly several times if multipliers at their bounds must be left out, and moves the
+multipliers to center - t*aggregated, projected on their bounds. */
+void lagBundle::updateMultipliers(){
+    const int n = formulation->getNbDuals();
+    for (int pass = 0; pass < MAX_NB_MASK_PASSES; pass++){
+        updateGram(getBundleSize());
+        solveMasterProblem();
+        computeAggregated();
+        if(!computeMask()){
+            break;
+        }
+    }
+    double t = getStepSize();
+    predictedIncrease = t*dualDot(aggregated.data(), aggregated.data(), gramMask.data(), n);
+    for (unsigned int j = 0; j < cutValue.size(); j++){
+        predictedIncrease += cutWeight[j]*std::max(0.0, cutValue[j] - centerValue);
+    }
+    formulation->updateMultiplierFromCenter(aggregated.data(), t);
+}
+
+/****************************************************************************************************************************/
+/*					                                      BUNDLE 		    		                                        */
+/****************************************************************************************************************************/
+
+void lagBundle::addCut(const double *slack, double value){
+    const int n = formulation->getNbDuals();
+    cutSlack.push_back(AlignedDoubleVector(slack, slack + n));
+    cutValue.push_back(value);
+    cutWeight.push_back(0.0);
+    updateGram(getBundleSize() - 1);
+}
+
+/* The last cut takes the place of the removed one. */
+void lagBundle::removeCut(int j){
+    const int M = MAX_BUNDLE_SIZE;
+    int last = getBundleSize() - 1;
+    if(j != last){
+        cutSlack[j].swap(cutSlack[last]);
+        cutValue[j] = cutValue[last];
+        cutWeight[j] = cutWeight[last];
+        for (int k = 0; k < last; k++){
+            if(k != j){
+                gram[j*M + k] = gram[last*M + k];
+                gram[k*M + j] = gram[j*M + k];
+            }
+        }
+        gram[j*M + j] = gram[last*M + last];
+    }
+    cutSlack.pop_back();
+    cutValue.pop_back();
+    cutWeight.pop_back();
+}
+
+void lagBundle::compressBundle(){
+    while(getBundleSize() >= MAX_BUNDLE_SIZE){
+        int unused = -1;
+        for (int j = 0; j < getBundleSize() && unused == -1; j++){
+            if(cutWeight[j] <= QP_PRECISION){
+                unused = j;
+            }
+        }
+        if(unused != -1){
+            removeCut(unused);
+        }
+        else{
+            /* All cuts are in use: they are replaced by their convex combination, which is also a valid cut. */
+            computeAggregated();
+            double aggregatedValue = 0.0;
+            for (int j = 0; j < getBundleSize(); j++){
+                aggregatedValue += cutWeight[j]*cutValue[j];
+            }
+            cutSlack.clear();
+            cutValue.clear();
+            cutWeight.clear();
+            addCut(aggregated.data(), aggregatedValue);
+            cutWeight[0] = 1.0;
+        }
+    }
+}
+
+void lagBundle::updateGram(int first){
+    const int n = formulation->getNbDuals();
+    const int M = MAX_BUNDLE_SIZE;
+    if(!std::equal(mask.begin(), mask.end(), gramMask.begin())){
+        gramMask = mask;
+        first = 0;
+    }
+    for (int i = first; i < getBundleSize(); i++){
+        for (int j = 0; j <= i; j++){
+            gram[i*M + j] = dualDot(cutSlack[i].data(), cutSlack[j].data(), gramMask.data(), n);
+            gram[j*M + i] = gram[i*M + j];
+        }
+    }
+}
+
+/* Pairwise (SMO-like) descent: the weight moves from the used cut with the largest gradient to the cut with the
+smallest gradient, with an exact line search, until the gradients of the used cuts are all minimal. The previous
+weights are the starting point. */
+void lagBundle::solveMasterProblem(){
+    const int B = getBundleSize();
+    const int M = MAX_BUNDLE_SIZE;
+    const double t = getStepSize();
+
+    std::vector<double> error(B);
+    for (int j = 0; j < B; j++){
+        error[j] = std::max(0.0, cutValue[j] - centerValue);
+    }
+
+    double sum = 0.0;
+    for (int j = 0; j < B; j++){
+        sum += cutWeight[j];
+    }
+    if(sum <= QP_PRECISION){
+        std::fill(cutWeight.begin(), cutWeight.end(), 0.0);
+        cutWeight[B-1] = 1.0;
+    }
+    else{
+        for (int j = 0; j < B; j++){
+            cutWeight[j] /= sum;
+        }
+    }
+
+    /** Gradient: t*Q*theta + e **/
+    std::vector<double> gradient(B);
+    for (int k = 0; k < B; k++){
+        gradient[k] = error[k];
+        for (int j = 0; j < B; j++){
+            gradient[k] += t*gram[k*M + j]*cutWeight[j];
+        }
+    }
+
+    for (int it = 0; it < MAX_NB_QP_IT; it++){
+        int from = -1;
+        int to = 0;
+        for (int j = 0; j < B; j++){
+            if(cutWeight[j] > 0.0 && (from == -1 || gradient[j] > gradient[from])){
+                from = j;
+            }
+            if(gradient[j] < gradient[to]){
+                to = j;
+            }
+        }
+        double gap = gradient[from] - gradient[to];
+        if(from == to || gap <= QP_PRECISION*(1.0 + std::abs(gradient[from]))){
+            break;
+        }
+        double curvature = t*(gram[from*M + from] + gram[to*M + to] - 2.0*gram[from*M + to]);
+        double delta = (curvature > 0.0) ? std::min(cutWeight[from], gap/curvature) : cutWeight[from];
+        cutWeight[from] -= delta;
+        cutWeight[to] += delta;
+        for (int k = 0; k < B; k++){
+            gradient[k] += t*delta*(gram[k*M + to] - gram[k*M + from]);
+        }
+    }
+}
+
+void lagBundle::computeAggregated(){
+    const int n = formulation->getNbDuals();
+    std::fill(aggregated.begin(), aggregated.end(), 0.0);
+    for (int j = 0; j < getBundleSize(); j++){
+        if(cutWeight[j] > 0.0){
+            dualAxpby(cutWeight[j], cutSlack[j].data(), 1.0, aggregated.data(), n);
+        }
+    }
+}
+
+bool lagBundle::computeMask(){
+    const int n = formulation->getNbDuals();
+    dualDirectionMask(mask.data(), aggregated.data(), formulation->getDualStabilityCenterData(), formulation->getDualLowerData(), formulation->getDualActiveData(), true, n);
+    return !std::equal(mask.begin(), mask.end(), gramMask.begin());
+}
+
+/******************************************************************************************************************************/
+/*										                    DISPLAY  									                      */
+/******************************************************************************************************************************/
+
+void lagBundle::displayMainParameters(std::ostream & sortie){
+    int k = getIteration();
+    std::vector<int> sizeOfField;
+    sizeOfField.resize(12);
+    sizeOfField[0] = 5;
+    sizeOfField[1] = 7;
+    sizeOfField[2] = 6;
+    sizeOfField[3] = 6;
+    sizeOfField[4] = 10;
+    sizeOfField[5] = 9;
+    sizeOfField[6] = 9;
+    sizeOfField[7] = 9;
+    sizeOfField[8] = 8;
+    sizeOfField[9] = 9;
+    sizeOfField[10] = 11;
+    sizeOfField[11] = 9;
+    char space = ' ';
+
+    std::vector<std::string> field;
+    field.resize(12);
+    if (k == 1){
+        field[0] = "Iter";
+        field[1] = "Serious";
+        field[2] = "Null";
+        field[3] = "Bundle";
+        field[4] = "LB";
+        field[5] = "Lagr Cost";
+        field[6] = "Center";
+        field[7] = "UB";
+        field[8] = "Prox t";
+        field[9] = "Predicted";
+        field[10] = "Feasibility";
+        field[11] = "Time";
+
+        for (unsigned int i = 0; i < field.size(); i++){
+            field[i].resize(sizeOfField[i], space);
+            sortie << field[i] << " | ";
+        }
+        sortie << std::endl;
+    }
+    field[0] = std::to_string(k);
+    field[1] = std::to_string(getNbSeriousSteps());
+    field[2] = std::to_string(getNbNullSteps());
+    field[3] = std::to_string(getBundleSize());
+    field[4] = std::to_string(getLB());
+    field[5] = std::to_string(formulation->getLagrCurrentCost());
+    field[6] = std::to_string(centerValue);
+    field[7] = std::to_string(getUB());
+    field[8] = std::to_string(getStepSize());
+    field[9] = std::to_string(getPredictedIncrease());
+
+    if (formulation->checkFeasibility()){
+        field[10] = "YES";
+    }
+    else{
+        field[10] = "NO";
+    }
+
+    field[11] = std::to_string(generalTime.getTimeInSecFromStart());
+
+    for (unsigned int i = 0; i < field.size(); i++){
+        field[i].resize(sizeOfField[i], space);
+        sortie << field[i] << " | ";
+    }
+    sortie << std::endl;
+}
@@ -0,0 +1,157 @@
+#ifndef LAG_BUNDLE_H
+#define LAG_BUNDLE_H
+
+#include "AbstractLagrangianSolver.h"
+
+/**********************************************************************************************
+ * Proximal bundle method. The Lagrangian dual function is concave and piecewise linear: each
+ * evaluation (a run of the sub problem) gives a cut, i.e., a linearization of the function
+ * given by the Lagrangian cost and the slacks. The next multipliers maximize the minimum of
+ * the cuts in the bundle, penalized by the distance to the stability center:
+ *      max  min_j { alpha_j - slack_j * (u - center) } - |u - center|^2 / (2t)
+ * It is solved in its dual form, a small dense QP over the unit simplex, whose solution theta
+ * gives the aggregated slack sum_j theta_j slack_j and the trial point center - t*aggregated.
+ * The center only moves (serious step) when the function increases by a fraction of what the
+ * model predicted; otherwise the cut enriches the model (null step).
+ * *******************************************************************************************/
+
+class lagBundle: public AbstractLagSolver{
+
+    private:
+
+        const int MAX_BUNDLE_SIZE;                  /**< Maximum number of cuts kept in the bundle. **/
+        const double SERIOUS_STEP_RATIO;            /**< Fraction of the predicted increase needed for a serious step. **/
+        const double GOOD_STEP_RATIO;               /**< Fraction of the predicted increase above which t is increased. **/
+        const int MAX_NB_NULL_STEPS;                /**< Number of consecutive null steps after which t is decreased. **/
+        const double UPD_PROX_INCREASE;             /**< Update of t after good serious steps. **/
+        const double UPD_PROX_DECREASE;             /**< Update of t after consecutive null steps. **/
+        const double MIN_REL_PREDICTED_INCREASE;    /**< If the relative predicted increase is smaller than this, stop. **/
+        const int MAX_NB_QP_IT;                     /**< Maximum number of iterations of the master QP solver. **/
+        const double QP_PRECISION;                  /**< Precision of the master QP solver. **/
+        const int MAX_NB_MASK_PASSES;               /**< Maximum number of master solutions per iteration when multipliers hit their bounds. **/
+
+        /** Slack of each cut (the subgradient is minus the slack). **/
+        std::vector<AlignedDoubleVector> cutSlack;
+
+        /** Value of each cut at the stability center. **/
+        std::vector<double> cutValue;
+
+        /** Weight of each cut in the last master solution. **/
+        std::vector<double> cutWeight;
+
+        /** Gram matrix of the cut slacks, restricted to gramMask: gram[i*MAX_BUNDLE_SIZE+j]. **/
+        std::vector<double> gram;
+
+        /** Relaxed constraints considered in the master problem. The multipliers at their lower bound that the
+        aggregated slack would push out of the feasible set are left out. **/
+        AlignedDoubleVector mask;
+
+        /** Mask used when the Gram matrix was computed. **/
+        AlignedDoubleVector gramMask;
+
+        /** Aggregated slack, sum_j theta_j slack_j. **/
+        AlignedDoubleVector aggregated;
+
+        /** Difference between the last trial point and the stability center. **/
+        AlignedDoubleVector trialStep;
+
+        /** Value of the dual function at the stability center. **/
+        double centerValue;
+
+        /** Increase of the dual function predicted by the last master problem. **/
+        double predictedIncrease;
+
+        /** Increase predicted by the model and actual increase of the dual function at the last trial point. **/
+        double trialPredictedIncrease;
+        double trialIncrease;
+
+        /** Initial proximal parameter, used to bound its updates. **/
+        double initialProx;
+
+        int nbSeriousSteps;
+        int nbNullSteps;
+        int nbConsecutiveNullSteps;
+        bool seriousStep;
+
+    public:
+        /************************************************/
+	    /*				    Constructors 		   		*/
+	    /************************************************/
+        lagBundle(const Instance &inst):AbstractLagSolver(inst),MAX_BUNDLE_SIZE(20),SERIOUS_STEP_RATIO(0.1),GOOD_STEP_RATIO(0.5),MAX_NB_NULL_STEPS(5),UPD_PROX_INCREASE(2.0),UPD_PROX_DECREASE(0.5),MIN_REL_PREDICTED_INCREASE(1e-6),MAX_NB_QP_IT(1000),QP_PRECISION(1e-9),MAX_NB_MASK_PASSES(3){}
+
+        /************************************************/
+	    /*				    GETTERS      		   		*/
+	    /************************************************/
+
+        int getBundleSize() const { return (int)cutValue.size(); }
+        int getNbSeriousSteps() const { return nbSeriousSteps; }
+        int getNbNullSteps() const { return nbNullSteps; }
+        bool getSeriousStep() const { return seriousStep; }
+        double getPredictedIncrease() const { return predictedIncrease; }
+
+        void getSolution(double *colsol) { formulation->getPrimalSolution(colsol);
+                                           formulation->clearAssignmentMatrix();
+                                           formulation->clearBestFeasibleSolution();
+                                           formulation->clearSlacks(); }
+
+        /************************************************/
+	    /*				    Methods      		   		*/
+	    /************************************************/
+
+        void initialization(bool=true);
+
+        void run(bool=true,bool=false);
+
+        void runIteration(bool=false);
+
+        void updateLB(double);
+
+        /* Updates the proximal parameter t, kept as the step size: increased after good serious steps, decreased after
+        consecutive null steps. */
+        void updateStepSize();
+
+        /* Lambda is only used to set the initial proximal parameter. */
+        void updateLambda(){}
+
+        /* Adds the cut of the last evaluation to the bundle and decides between a serious and a null step. */
+        void updateBundle();
+
+        /* Solves the master problem and moves the multipliers to the next trial point. */
+        void updateMultipliers();
+
+        /************************************************/
+	    /*				    Bundle      		   		*/
+	    /************************************************/
+
+        /* Adds a cut with the given slack and value at the stability center. */
+        void addCut(const double *, double);
+
+        /* Removes a cut from the bundle. */
+        void removeCut(int);
+
+        /* Makes room for a new cut: removes the unused cuts or, if all are used, replaces them by their aggregation. */
+        void compressBundle();
+
+        /* Recomputes the Gram matrix if the mask changed, otherwise only the rows of the given cuts onwards. */
+        void updateGram(int);
+
+        /* Solves the dual of the master problem: min t/2 |sum theta_j slack_j|^2 + sum theta_j e_j over the unit simplex. */
+        void solveMasterProblem();
+
+        /* Computes the aggregated slack from the cut weights. */
+        void computeAggregated();
+
+        /* Computes the mask from the aggregated slack. Returns true if it changed. */
+        bool computeMask();
+
+        /************************************************/
+	    /*				    Display      		   		*/
+	    /************************************************/
+
+        void displayMainParameters(std::ostream & = std::cout);
+
+        ~lagBundle(){}
+
+};
+
+#endif
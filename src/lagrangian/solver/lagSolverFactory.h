@@ -4,6 +4,7 @@
 // include all concrete solvers
 #include "lagSubgradient.h"
 #include "lagVolume.h"
+#include "lagBundle.h"
 
 class lagSolverFactory{
     public:
@@ -18,6 +19,10 @@ class lagSolverFactory{
                     return new lagVolume(instance);
                     break;
                 }
+                case Input::NODE_METHOD_BUNDLE:{
+                    return new lagBundle(instance);
+                    break;
+                }
                 default:{
                     std::cout << "ERROR: Invalid Lagrangian Node Method." << std::endl;
                     exit(0);
@@ -25,6 +25,7 @@ void lagSubgradient::initialization(bool initMultipliers){
     time.setStart(ClockTime::getTimeNow());
     
     setIteration(0);
+    boundTrace.clear();
     setItWithoutImprovement(0);
     setGlobalItWithoutImprovement(0);
     setStepSize(0.000);
@@ -152,6 +153,7 @@ void lagSubgradient::run(bool initMultipliers, bool modifiedSubproblem){
             setCostTime(formulation->getCostTime());
             setRSAGraphConstructionTime(formulation->getRSAGraphConstructionTime());
             setPreprocessingTime(formulation->getPreprocessingTime());
+            recordTelemetry();
         }
     }
 
@@ -179,6 +181,7 @@ void lagSubgradient::runIteration(bool modifiedSubproblem){
 
     /** Updating lower bound **/
     updateLB(formulation->getLagrCurrentCost());
+    traceEvaluation();
     
     /** Updating upper bound **/
     if(formulation->getStatus() == RSA::STATUS_FEASIBLE){
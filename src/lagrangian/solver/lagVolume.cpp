@@ -21,6 +21,7 @@ void lagVolume::initialization(bool initMultipliers){
 
     time.setStart(ClockTime::getTimeNow());
     setIteration(0);
+    boundTrace.clear();
     setGreenIt(false);
     setNbRedIt(0);
     setNbYellowIt(0);
@@ -170,6 +171,7 @@ void lagVolume::run(bool initMultipliers, bool modifiedSubproblem){
             setCostTime(formulation->getCostTime());
             setRSAGraphConstructionTime(formulation->getRSAGraphConstructionTime());
             setPreprocessingTime(formulation->getPreprocessingTime());
+            recordTelemetry();
             if(formulation->isInteger()){
                 std::cout << "The solution is integer." << std::endl;
             }
@@ -189,9 +191,9 @@ void lagVolume::runIteration(bool modifiedSubproblem){
     formulation->run(modifiedSubproblem);
     incSolvingSubProblemTime(time.getTimeInSecFromStart());
 
-    /* Initialize primal solution if first iteration */
+    /* Initialize primal solution if first iteration (a hot start keeps the saved one) */
     time.setStart(ClockTime::getTimeNow());
-    if(getIteration()==1){
+    if(getIteration()==1 && (!isHotStart() || formulation->getPrimalVariables().empty())){
         formulation->initPrimalApproximation();
     }
     incUpdatingPrimalVariablesTime(time.getTimeInSecFromStart());
@@ -204,6 +206,7 @@ void lagVolume::runIteration(bool modifiedSubproblem){
 
     /* Updating LOWER BOUND*/
     updateLB(formulation->getLagrCurrentCost());
+    traceEvaluation();
 
     updateTarget();
 
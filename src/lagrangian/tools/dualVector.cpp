@@ -0,0 +1,90 @@
+#include "dualVector.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+/* ****************************************************************************************************************
+*                                                   LAYOUT
+**************************************************************************************************************** */
+
+/* Appends a segment with the given row sizes. */
+int DualLayout::addSegment(const std::vector<int> & rowSizes){
+    std::vector<int> start(rowSizes.size() + 1, totalSize);
+    for (unsigned int i = 0; i < rowSizes.size(); i++){
+        start[i+1] = start[i] + rowSizes[i];
+    }
+    totalSize = start.back();
+    rowStart.push_back(start);
+    return (int)rowStart.size() - 1;
+}
+
+/* Appends a segment with a single row. */
+int DualLayout::addSegment(int size){
+    return addSegment(std::vector<int>(1, size));
+}
+
+/* ****************************************************************************************************************
+*                                                   VECTOR
+**************************************************************************************************************** */
+
+void DualVector::allocate(const DualLayout & l, double init){
+    layout = &l;
+    values.assign(layout->getTotalSize(), init);
+}
+
+void DualVector::fill(double value){
+    std::fill(values.begin(), values.end(), value);
+}
+
+void DualVector::fill(int seg, double value){
+    double *begin = values.data() + layout->getSegmentOffset(seg);
+    std::fill(begin, begin + layout->getSegmentSize(seg), value);
+}
+
+void DualVector::copy(const DualVector & other){
+    std::copy(other.values.begin(), other.values.end(), values.begin());
+}
+
+/* ****************************************************************************************************************
+*                                                   KERNELS
+**************************************************************************************************************** */
+
+/* The constraint is written as >= for the minimization problem, so the violation is -direction. */
+void dualProjectedStep(double *x, const double *center, const double *direction, const double *lower, const double *upper, double step, int n){
+    for (int i = 0; i < n; i++){
+        double value = center[i] - step*direction[i];
+        value = (value < lower[i]) ? lower[i] : value;
+        x[i] = (value > upper[i]) ? upper[i] : value;
+    }
+}
+
+void dualAxpby(double a, const double *x, double b, double *y, int n){
+    for (int i = 0; i < n; i++){
+        y[i] = a*x[i] + b*y[i];
+    }
+}
+
+/* Four independent partial sums, so the additions are not serialized on a single accumulator. */
+double dualDot(const double *x, const double *y, const double *weight, int n){
+    double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+    int i = 0;
+    for (; i + 3 < n; i += 4){
+        s0 += weight[i]*x[i]*y[i];
+        s1 += weight[i+1]*x[i+1]*y[i+1];
+        s2 += weight[i+2]*x[i+2]*y[i+2];
+        s3 += weight[i+3]*x[i+3]*y[i+3];
+    }
+    for (; i < n; i++){
+        s0 += weight[i]*x[i]*y[i];
+    }
+    return (s0 + s1) + (s2 + s3);
+}
+
+void dualDirectionMask(double *mask, const double *direction, const double *multiplier, const double *lower, const double *active, bool improved, int n){
+    for (int i = 0; i < n; i++){
+        bool nullMultiplier = !improved || (std::fabs(multiplier[i]) < DBL_EPSILON);
+        bool blocked = (lower[i] == 0.0) && (-direction[i] < -DBL_EPSILON) && nullMultiplier;
+        mask[i] = blocked ? 0.0 : active[i];
+    }
+}
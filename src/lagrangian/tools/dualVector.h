@@ -0,0 +1,169 @@
+#ifndef DUAL_VECTOR_H
+#define DUAL_VECTOR_H
+
+#include <cstdlib>
+#include <cstddef>
+#include <new>
+#include <vector>
+
+/*****************************************************************************************************************
+ * The Lagrangian formulations keep, for every relaxed constraint, a multiplier, a stability center, a slack, a
+ * slack considering the primal approximation and a direction. All of them are stored in flat vectors sharing the
+ * same layout: each family of relaxed constraints is a segment of consecutive positions, and each segment is split
+ * in rows (e.g., one row per edge for the non-overlapping constraints). The families then only keep views on their
+ * segment, and the subgradient/volume updates are plain loops over contiguous, cache-line aligned memory.
+ *****************************************************************************************************************/
+
+/** Memory alignment (in bytes) of the dual vectors: one cache line, also enough for any SIMD register width. **/
+#define DUAL_VECTOR_ALIGNMENT 64
+
+/** Allocator returning memory aligned on Alignment bytes. **/
+template <typename T, std::size_t Alignment = DUAL_VECTOR_ALIGNMENT>
+class AlignedAllocator{
+    public:
+        typedef T value_type;
+        template <typename U> struct rebind { typedef AlignedAllocator<U, Alignment> other; };
+
+        AlignedAllocator(){}
+        template <typename U> AlignedAllocator(const AlignedAllocator<U, Alignment> &){}
+
+        T * allocate(std::size_t n){
+            void *p = NULL;
+            if(posix_memalign(&p, Alignment, n*sizeof(T)) != 0){
+                throw std::bad_alloc();
+            }
+            return static_cast<T*>(p);
+        }
+        void deallocate(T *p, std::size_t){ free(p); }
+};
+
+template <typename T, typename U, std::size_t A>
+bool operator==(const AlignedAllocator<T,A> &, const AlignedAllocator<U,A> &){ return true; }
+template <typename T, typename U, std::size_t A>
+bool operator!=(const AlignedAllocator<T,A> &, const AlignedAllocator<U,A> &){ return false; }
+
+typedef std::vector<double, AlignedAllocator<double> > AlignedDoubleVector;
+
+/** Non-owning view of a row of a dual vector. **/
+class DualRow{
+    private:
+        double *values;
+        int nbValues;
+    public:
+        DualRow():values(NULL),nbValues(0){}
+        DualRow(double *val, int n):values(val),nbValues(n){}
+
+        double & operator[](int i) { return values[i]; }
+        const double & operator[](int i) const { return values[i]; }
+
+        int size() const { return nbValues; }
+        double * begin() { return values; }
+        double * end() { return values + nbValues; }
+        const double * begin() const { return values; }
+        const double * end() const { return values + nbValues; }
+};
+
+/** Non-owning view of a segment of a dual vector, seen as a sequence of rows. **/
+class DualMatrix{
+    private:
+        double *values;
+        const int *rowStart;
+        int nbRows;
+    public:
+        DualMatrix():values(NULL),rowStart(NULL),nbRows(0){}
+        DualMatrix(double *val, const int *start, int n):values(val),rowStart(start),nbRows(n){}
+
+        DualRow operator[](int i) const { return DualRow(values + rowStart[i], rowStart[i+1] - rowStart[i]); }
+
+        int size() const { return nbRows; }
+};
+
+/** Describes how the relaxed constraints are placed in the dual vectors. **/
+class DualLayout{
+    private:
+        /* Position of the first element of each row of each segment in the vector. The segment s has its rows
+        starting at rowStart[s][0],...,rowStart[s][n-1] and ending at rowStart[s][n]. */
+        std::vector< std::vector<int> > rowStart;
+        int totalSize;
+    public:
+        DualLayout():totalSize(0){}
+
+        /** Appends a segment with the given row sizes to the layout and returns its identifier. **/
+        int addSegment(const std::vector<int> &);
+
+        /** Appends a segment with a single row of the given size and returns its identifier. **/
+        int addSegment(int);
+
+        int getNbSegments() const { return (int)rowStart.size(); }
+        int getTotalSize() const { return totalSize; }
+        int getNbRows(int seg) const { return (int)rowStart[seg].size() - 1; }
+        int getSegmentOffset(int seg) const { return rowStart[seg].front(); }
+        int getSegmentSize(int seg) const { return rowStart[seg].back() - rowStart[seg].front(); }
+        const int * getRowStart(int seg) const { return rowStart[seg].data(); }
+
+        void clear(){ rowStart.clear(); totalSize = 0; }
+
+        /** Returns the memory (bytes) allocated by the layout. **/
+        std::size_t getMemory() const {
+            std::size_t bytes = rowStart.capacity()*sizeof(std::vector<int>);
+            for (unsigned int seg = 0; seg < rowStart.size(); seg++){
+                bytes += rowStart[seg].capacity()*sizeof(int);
+            }
+            return bytes;
+        }
+};
+
+/** A flat, aligned vector of doubles following a DualLayout. **/
+class DualVector{
+    private:
+        const DualLayout *layout;
+        AlignedDoubleVector values;
+    public:
+        DualVector():layout(NULL){}
+
+        /** Allocates the vector for the given layout (which must outlive it) and sets all values to init. **/
+        void allocate(const DualLayout &, double init = 0.0);
+
+        double * data() { return values.data(); }
+        const double * data() const { return values.data(); }
+        int size() const { return (int)values.size(); }
+
+        /** Returns the memory (bytes) allocated by the vector. **/
+        std::size_t getMemory() const { return values.capacity()*sizeof(double); }
+
+        /** Returns a view on a segment with a single row. **/
+        DualRow row(int seg) { return DualRow(values.data() + layout->getSegmentOffset(seg), layout->getSegmentSize(seg)); }
+
+        /** Returns a view on a segment split in rows. **/
+        DualMatrix matrix(int seg) { return DualMatrix(values.data(), layout->getRowStart(seg), layout->getNbRows(seg)); }
+
+        /** Sets all values of the vector. **/
+        void fill(double);
+
+        /** Sets all values of a segment. **/
+        void fill(int seg, double);
+
+        /** Copies the values of another vector with the same layout. **/
+        void copy(const DualVector &);
+};
+
+/*****************************************************************************************************************
+ * Kernels over contiguous arrays of size n. They are written as simple branch-free loops (selects instead of
+ * branches, independent partial sums in the reductions) so the compiler vectorises them.
+ *****************************************************************************************************************/
+
+/** Projected step: x[i] = min(upper[i], max(lower[i], center[i] - step*direction[i])). **/
+void dualProjectedStep(double *x, const double *center, const double *direction, const double *lower, const double *upper, double step, int n);
+
+/** y[i] = a*x[i] + b*y[i]. **/
+void dualAxpby(double a, const double *x, double b, double *y, int n);
+
+/** Returns sum of weight[i]*x[i]*y[i]. **/
+double dualDot(const double *x, const double *y, const double *weight, int n);
+
+/** Projection filter. mask[i] = active[i], except for the inequalities (lower[i] == 0) whose direction leads the
+ * multiplier out of the feasible set, which get 0. With the improved projection, only the inequalities with a null
+ * multiplier are filtered. **/
+void dualDirectionMask(double *mask, const double *direction, const double *multiplier, const double *lower, const double *active, bool improved, int n);
+
+#endif
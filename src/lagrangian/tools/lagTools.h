@@ -8,10 +8,13 @@
 #include <lemon/list_graph.h>
 #include <lemon/concepts/graph.h>
 #include <lemon/maps.h>
+#include <lemon/adaptors.h>
 #include <lemon/concepts/maps.h>
 #include "../../topology/input.h"
 #include "../../formulation/rsa.h"
 #include "../../formulation/flowForm.h"
+#include "dualVector.h"
+#include "../../tools/shortestPathPool.h"
 
 
 using namespace lemon;
@@ -19,7 +22,6 @@ using namespace lemon;
 /* Auxiliary Functors antecipated definition */
 class operatorCost;
 class operatorCostObj8;
-class operatorCoefficient;
 class operatorSliceCoefficient;
 class operatorCostEFlow;
 class operatorCostESource;
@@ -42,7 +44,6 @@ typedef operatorArcCostArcIndex<double> operatorArcCostArcIndexVar;
 
 /* Coefficient computation */
 typedef CombineMap<ArcMap,SourceMap<ListDigraph>,operatorSliceCoefficient,int> CombineMapCoeffSlice;
-typedef CombineMap<ArcCost,CombineMapCoeffSlice,operatorCoefficient,double> CombineMapCoeff;
 
 /* Cost flow formulation */
 typedef ScaleMap< ArcCost, double > ScaleMapCost;
@@ -83,27 +84,32 @@ typedef CombineMap<ArcMap,ArcMap,operatorLowerUpperBound,int> CombineArcMapArcMa
 typedef CombineMap<ArcMap,ArcCost,operatorHeuristicAdaptedCost,double> CombineArcMapArcCostHeuristicAdaptedCost;
 
 /* Auxiliaries */
-typedef Dijkstra< ListDigraph, AddMapFinalCost > DijkstraCost;
-typedef Dijkstra< ListDigraph, AddMapFinalCostObj8> DijkstraCostObj8;
-
-typedef Dijkstra<ListDigraph,AddMapFinalOneSlicePerDemand> DijkstraCostE;
-typedef BellmanFord<ListDigraph,AddMapFinalOneSlicePerDemand> BellmanFordCostE;
+/* The shortest paths of the subproblems run on pooled workspaces (see tools/shortestPathPool.h). */
+typedef PooledDijkstra< ListDigraph, AddMapFinalCost > DijkstraCost;
+typedef PooledDijkstra< ListDigraph, AddMapFinalCostObj8> DijkstraCostObj8;
+
+typedef PooledDijkstra<ListDigraph,AddMapFinalOneSlicePerDemand> DijkstraCostE;
+typedef PooledBellmanFord<ListDigraph,AddMapFinalOneSlicePerDemand> BellmanFordCostE;
+typedef PooledBellmanFord< ListDigraph, ListDigraph::ArcMap<double> > BellmanFordCostArc;
+typedef PooledDijkstra< ListDigraph, ArcCost > DijkstraCostArc;
+typedef PooledDijkstra< ReverseDigraph<ListDigraph>, ArcCost > ReverseDijkstraCostArc;
 typedef ArcCost::MapIt ArcCostIt;
 
 /* Class to compute the cost related with Non Overlap Multipliers.
  *  -> Used in the CombineMap class to return a new map with the cost 
- *  related to Overlap Multipliers*/
+ *  related to Overlap Multipliers.
+ *  -> It only keeps a view of the multipliers owned by the formulation, which must 
+ *  outlive the operator. No copy is made when building it at each iteration. */
 class operatorCost{
     private:
         int demandLoad;
-        std::vector<std::vector<double>> lagrangianMultiplierOverlap;
+        DualMatrix lagrangianMultiplierOverlap;
                 
     public:
-        operatorCost(std::vector<std::vector<double>> lag);
+        operatorCost(const DualMatrix & lag):demandLoad(0),lagrangianMultiplierOverlap(lag){}
         void setDemandLoad(int load){demandLoad = load;}
         double getDemandLoad() const {return demandLoad;}       
         double operator() (int label,int slice) const;
-        ~operatorCost(){ lagrangianMultiplierOverlap.clear();}
 };
 
 /* Class to compute the cost related with objective 8 constraints Multipliers.
@@ -122,20 +128,6 @@ class operatorCostObj8{
 };
 
 /*********************************************** COMPUTING COEFF MAP ***********************************************/
-/* Class to compute the arcs coefficient in the objective function.
- *   It combines the maps vecArcLength and vecArcSlice (an adaptation where
- * only arcs leaving the source have values != from 0 - see operatorSliceCoefficient).
- *  -> Used in the CombineMap class to return a new map with the arcs coefficients values */
-class operatorCoefficient{
-    private:
-        int demandLoad;
-        Input::ObjectiveMetric chosenObj; 
-    public:
-        operatorCoefficient(Input::ObjectiveMetric obj):chosenObj(obj){}
-        void setDemandLoad(double load) { demandLoad = load; }
-        double operator()(double,int) const;
-};
-
 /** Class to compute the arcs slices for the objective function.
  *  Arcs leaving the source maintain their slice, the others have their slice
  *  changed to 0. */
@@ -154,34 +146,26 @@ class operatorSliceCoefficient{
 template <typename T>
 class operatorHeuristicCost{
     private:
-        std::vector<std::vector<T> > variables;
+        const std::vector<std::vector<T> > * variables;
         int demand;
     public:
-        operatorHeuristicCost(std::vector<std::vector<T> >);
+        operatorHeuristicCost(const std::vector<std::vector<T> > &);
         void setDemand(int d){ demand = d;}
         double operator()(double,int) const;
-        ~operatorHeuristicCost();
 };
 
-/** Initilialization operatorHeuristicCost class : it has as attribut a vector that is either the assignment matrix 
+/** Initilialization operatorHeuristicCost class : it keeps a view of a vector that is either the assignment matrix 
  * or the primal variables. **/
 template <typename T>
-operatorHeuristicCost<T>::operatorHeuristicCost(std::vector<std::vector<T> > var){
-    variables.resize(var.size());
-    for(int i = 0; i < var.size();i++){
-        std::copy(var[i].begin(), var[i].end(),std::back_inserter(variables[i]));
-    } 
-}
+operatorHeuristicCost<T>::operatorHeuristicCost(const std::vector<std::vector<T> > & var):variables(&var),demand(0){}
+
 /** Operator for the cost : (1-x)*coeff **/
 template <typename T>
 double operatorHeuristicCost<T>::operator()(double coeff,int index) const{
-    return coeff*(1.0-variables[demand][index]);
-    //return (1.0-variables[demand][index]);
+    return coeff*(1.0-(*variables)[demand][index]);
+    //return (1.0-(*variables)[demand][index]);
 }
 
-template <typename T>
-operatorHeuristicCost<T>::~operatorHeuristicCost(){ variables.clear(); }
-
 
 class operatorCostHeuristicRemoveArcs{
     private:
@@ -206,40 +190,33 @@ class operatorCostHeuristicRemoveArcs{
 template <typename T>
 class operatorArcCostArcIndex{
     private:
-        std::vector<std::vector<T> > variables;
+        const std::vector<std::vector<T> > * variables;
         int demand;
     public:
-        operatorArcCostArcIndex(std::vector<std::vector<T> >);
+        operatorArcCostArcIndex(const std::vector<std::vector<T> > &);
         void setDemand(int d){ demand = d;}
         double operator()(double,int) const;
-        ~operatorArcCostArcIndex();
 };
 
 template <typename T>
-operatorArcCostArcIndex<T>::operatorArcCostArcIndex(std::vector<std::vector<T> > var){
-    variables.resize(var.size());
-    for(int i = 0; i < var.size();i++){
-        std::copy(var[i].begin(), var[i].end(),std::back_inserter(variables[i]));
-    } 
-}
+operatorArcCostArcIndex<T>::operatorArcCostArcIndex(const std::vector<std::vector<T> > & var):variables(&var),demand(0){}
 
 template <typename T>
 double operatorArcCostArcIndex<T>::operator()(double cost,int index) const{
-    return cost*(variables[demand][index]);
+    return cost*((*variables)[demand][index]);
 }
 
-template <typename T>
-operatorArcCostArcIndex<T>::~operatorArcCostArcIndex(){ variables.clear(); }
-
 
 /**************************************************** COMPUTING NON OVERLAP COST ************************************************/
+/* The operators below only keep views of the multipliers (and demand data) owned by the 
+ * formulation, which must outlive them. They are built at each iteration without copying. */
 
 class operatorCostEFlow{
     private:
-        std::vector<std::vector<double> > multiplier;
+        DualMatrix multiplier;
         int signal;
     public:
-        operatorCostEFlow(std::vector<std::vector<double> >);
+        operatorCostEFlow(const DualMatrix &);
         void setSignal(int s) {signal = s;}
         double operator()(int, int) const;
 
@@ -247,37 +224,37 @@ class operatorCostEFlow{
 
 class operatorCostETarget{
     private:
-        std::vector<std::vector<double> > multiplier;
-        std::vector<int> labelTarget;
+        DualMatrix multiplier;
+        const std::vector<int> * labelTarget;
     public:
-        operatorCostETarget(std::vector<std::vector<double> >,std::vector<int>);
+        operatorCostETarget(const DualMatrix &,const std::vector<int> &);
         double operator()(int, int) const;
 };
 
 class operatorCostESource{
     private:
-        std::vector<std::vector<double> > multiplier;
-        std::vector<int> labelSource;
+        DualMatrix multiplier;
+        const std::vector<int> * labelSource;
     public:
-        operatorCostESource(std::vector<std::vector<double> >,std::vector<int>);
+        operatorCostESource(const DualMatrix &,const std::vector<int> &);
         double operator()(int, int) const;
 };
 
 class operatorCostELength{
     private:
-        std::vector<double>  multiplier;
-        std::vector<double> maxLength;
+        DualRow multiplier;
+        const std::vector<double> * maxLength;
     public:
-        operatorCostELength(std::vector<double> ,std::vector<double>);
+        operatorCostELength(const DualRow &,const std::vector<double> &);
         double operator()(int, double) const;
 };
 
 class operatorCostEOneSlicePerDemand{
     private:
         int label;
-        std::vector<std::vector<double> > multiplier;
+        DualMatrix multiplier;
     public:
-        operatorCostEOneSlicePerDemand(std::vector<std::vector<double>>);
+        operatorCostEOneSlicePerDemand(const DualMatrix &);
         void setLabel(int val) { label = val;}
         double operator()(int,int) const;
 };
@@ -0,0 +1,108 @@
+#include "multiplierStore.h"
+
+#include <iomanip>
+#include <limits>
+
+/****************************************************************************************/
+/*                                      Getters                                         */
+/****************************************************************************************/
+
+int MultiplierStore::size() const{
+    int total = 0;
+    for (std::map<int, FamilyMap>::const_iterator it = multipliers.begin(); it != multipliers.end(); ++it){
+        total += (int)it->second.size();
+    }
+    return total;
+}
+
+bool MultiplierStore::get(Family family, int first, int second, int third, double &value) const{
+    std::map<int, FamilyMap>::const_iterator itFamily = multipliers.find(family);
+    if(itFamily == multipliers.end()){
+        return false;
+    }
+    FamilyMap::const_iterator it = itFamily->second.find(std::make_tuple(first, second, third));
+    if(it == itFamily->second.end()){
+        return false;
+    }
+    value = it->second;
+    return true;
+}
+
+bool MultiplierStore::hasDemand(int id, int source, int target, int load) const{
+    std::map<int, DemandSignature>::const_iterator it = demands.find(id);
+    if(it == demands.end()){
+        return false;
+    }
+    DemandSignature signature = {source, target, load};
+    return it->second == signature;
+}
+
+/****************************************************************************************/
+/*                                      Setters                                         */
+/****************************************************************************************/
+
+void MultiplierStore::setDemand(int id, int source, int target, int load){
+    DemandSignature signature = {source, target, load};
+    demands[id] = signature;
+}
+
+/****************************************************************************************/
+/*                                       Files                                          */
+/****************************************************************************************/
+
+/* Each line is either a demand "D id source target load" or a multiplier "M family first second third value". Lines
+"M family first second value" written before the three-part keys are read with third = 0. FLOW lines of that format
+were keyed by node index, which does not persist, so they are skipped. */
+bool MultiplierStore::read(const std::string &fileName){
+    std::ifstream file(fileName.c_str());
+    if(!file.is_open()){
+        return false;
+    }
+    clear();
+    std::string line;
+    while(std::getline(file, line)){
+        std::istringstream fields(line);
+        std::string type;
+        if(!(fields >> type)){
+            continue;
+        }
+        if(type == "D"){
+            int id, source, target, load;
+            if(fields >> id >> source >> target >> load){
+                setDemand(id, source, target, load);
+            }
+        }
+        else if(type == "M"){
+            std::vector<std::string> values;
+            std::string field;
+            while(fields >> field){
+                values.push_back(field);
+            }
+            if(values.size() == 5){
+                set((Family)std::stoi(values[0]), std::stoi(values[1]), std::stoi(values[2]), std::stoi(values[3]), std::stod(values[4]));
+            }
+            else if(values.size() == 4 && std::stoi(values[0]) != FLOW){
+                set((Family)std::stoi(values[0]), std::stoi(values[1]), std::stoi(values[2]), std::stod(values[3]));
+            }
+        }
+    }
+    std::cout << "> " << size() << " Lagrangian multipliers were read from " << fileName << "." << std::endl;
+    return true;
+}
+
+void MultiplierStore::write(const std::string &fileName) const{
+    std::ofstream file(fileName.c_str());
+    if(!file.is_open()){
+        std::cerr << "ERROR: Could not open " << fileName << " to write the Lagrangian multipliers." << std::endl;
+        return;
+    }
+    file << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for (std::map<int, DemandSignature>::const_iterator it = demands.begin(); it != demands.end(); ++it){
+        file << "D " << it->first << " " << it->second.source << " " << it->second.target << " " << it->second.load << std::endl;
+    }
+    for (std::map<int, FamilyMap>::const_iterator itFamily = multipliers.begin(); itFamily != multipliers.end(); ++itFamily){
+        for (FamilyMap::const_iterator it = itFamily->second.begin(); it != itFamily->second.end(); ++it){
+            file << "M " << itFamily->first << " " << std::get<0>(it->first) << " " << std::get<1>(it->first) << " " << std::get<2>(it->first) << " " << it->second << std::endl;
+        }
+    }
+}
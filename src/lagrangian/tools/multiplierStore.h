@@ -0,0 +1,112 @@
+#ifndef MULTIPLIER_STORE_H
+#define MULTIPLIER_STORE_H
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <map>
+#include <tuple>
+#include <vector>
+
+/**********************************************************************************************
+ * Store of Lagrangian multipliers kept between solves. The multipliers of one solve are the
+ * starting point of the next one (next online iteration, next demand file or next CBC root).
+ * Multipliers are keyed by what persists between solves rather than by their position in the
+ * dual vectors: (edge, slice) and (node, slice) for the network constraints, (demand id, index)
+ * for the constraints of a demand, and (demand id, node label, slice) for the flow constraints,
+ * whose node indices change with the batch and the preprocessing. A demand multiplier is only
+ * reused if the demand has the same source, target and load; new demands keep the default
+ * initial multipliers.
+ * *******************************************************************************************/
+
+class MultiplierStore{
+
+    public:
+        /** Families of relaxed constraints. **/
+        enum Family {
+            LENGTH = 0,                         /**< Key (0, demand). **/
+            SOURCE_TARGET = 1,                  /**< Key (demand, node). **/
+            FLOW = 2,                           /**< Key (demand, node label, slice). **/
+            OVERLAP = 3,                        /**< Key (edge, slice). **/
+            ONE_SLICE_PER_DEMAND = 4,           /**< Key (edge, demand). **/
+            MAX_USED_SLICE_OVERALL = 5,         /**< Key (0, demand). **/
+            MAX_USED_SLICE_OVERALL_AUX = 6,     /**< Key (0, demand). **/
+            MAX_USED_SLICE_OVERALL_2 = 7,       /**< Key (edge, slice). **/
+            MAX_USED_SLICE_OVERALL_3 = 8        /**< Key (node, slice). **/
+        };
+
+        /** Characteristics of a demand checked before reusing its multipliers. **/
+        struct DemandSignature {
+            int source;
+            int target;
+            int load;
+            bool operator==(const DemandSignature &other) const { return source == other.source && target == other.target && load == other.load; }
+        };
+
+    private:
+        typedef std::map< std::tuple<int,int,int>, double > FamilyMap;
+
+        /** Multipliers of each family. **/
+        std::map<int, FamilyMap> multipliers;
+
+        /** Signature of the demands whose multipliers are stored, by demand id. **/
+        std::map<int, DemandSignature> demands;
+
+    public:
+        /************************************************/
+        /*                 Constructors                 */
+        /************************************************/
+        MultiplierStore(){}
+
+        /************************************************/
+        /*                    Getters                   */
+        /************************************************/
+
+        /** Returns the total number of stored multipliers. **/
+        int size() const;
+
+        bool empty() const { return size() == 0; }
+
+        /** Looks for the multiplier of a constraint. Returns false if it is not stored. **/
+        bool get(Family family, int first, int second, double &value) const { return get(family, first, second, 0, value); }
+
+        /** Looks for the multiplier of a constraint with a three-part key (FLOW). Returns false if it is not stored. **/
+        bool get(Family family, int first, int second, int third, double &value) const;
+
+        /** Returns true if the multipliers of the demand with the given id were stored for the same source, target and load. **/
+        bool hasDemand(int id, int source, int target, int load) const;
+
+        /************************************************/
+        /*                    Setters                   */
+        /************************************************/
+
+        /** Stores the multiplier of a constraint. **/
+        void set(Family family, int first, int second, double value) { set(family, first, second, 0, value); }
+
+        /** Stores the multiplier of a constraint with a three-part key (FLOW). **/
+        void set(Family family, int first, int second, int third, double value) { multipliers[family][std::make_tuple(first, second, third)] = value; }
+
+        /** Stores the signature of a demand. **/
+        void setDemand(int id, int source, int target, int load);
+
+        /** Removes the multipliers of a family. **/
+        void clearFamily(Family family) { multipliers.erase(family); }
+
+        /** Removes everything. **/
+        void clear() { multipliers.clear(); demands.clear(); }
+
+        /************************************************/
+        /*                     Files                    */
+        /************************************************/
+
+        /** Reads the store from a file written by write. Returns false if the file cannot be opened. **/
+        bool read(const std::string &fileName);
+
+        /** Writes the store to a file. **/
+        void write(const std::string &fileName) const;
+
+        ~MultiplierStore(){}
+};
+
+#endif
@@ -10,6 +10,7 @@ ILOSTLBEGIN
 #include <lemon/concepts/graph.h>
 
 #include "tools/clockTime.h"
+#include "tools/telemetry.h"
 #include "topology/instance.h"
 #include "solver/solverFactory.h"
 
@@ -36,6 +37,9 @@ int main(int argc, char *argv[]) {
 	}
 	std::cout << "PARAMETER FILE: " << parameterFile << std::endl;
 	Input input(parameterFile);
+	if (!input.getTelemetryFile().empty()){
+		Telemetry::open(input.getTelemetryFile());
+	}
 	
 	/********************************************************************/
 	/* 				For each file of demands, optimize it 				*/
@@ -79,6 +83,7 @@ int main(int argc, char *argv[]) {
 			optimizationCounter++;
 			outputCode = getInBetweenString(nextFile, "/", ".") + "_" + std::to_string(optimizationCounter);
 			ClockTime ITERATION_TIME(ClockTime::getTimeNow());
+			Telemetry::beginIteration(outputCode);
 			if ((instance.getInput().getOptimizationTimeLimit() - OPTIMIZATION_TIME.getTimeInSecFromStart()) < instance.getInput().getIterationTimeLimit()){
 				instance.setTimeLimit(std::max(0, instance.getInput().getOptimizationTimeLimit() - (int)OPTIMIZATION_TIME.getTimeInSecFromStart()));
 			}
@@ -87,8 +92,12 @@ int main(int argc, char *argv[]) {
 			/* 								Solve	 							*/
 			/********************************************************************/
 			SolverFactory factory;
+			Telemetry::Span buildSpan("build", true);
 			AbstractSolver *solver = factory.createSolver(instance);
+			buildSpan.stop();
+			Telemetry::Span solveSpan("solve", true);
 			solver->solve();
+			solveSpan.stop();
 			solver->outputLogResults(outputCode);
 			//std::cout << "call update" << std::endl;
 			std::cout << " Time: " << solver->getDurationTime() << std::endl << std::endl;
@@ -112,7 +121,11 @@ int main(int argc, char *argv[]) {
 			std::cout << "GAP: " << solver->getMipGap() << std::endl;
 			std::cout << "Tree size: " << solver->getTreeSize() << std::endl;
 			std::cout << " Time: " << solver->getDurationTime() << std::endl << std::endl;
-			std::cout << "Algo: " << ((SolverCplex*)solver)->getAlgorithm()  << std::endl;
+			SolverCplex *cplexSolver = dynamic_cast<SolverCplex*>(solver);
+			if (cplexSolver != NULL){
+				std::cout << "Algo: " << cplexSolver->getAlgorithm()  << std::endl;
+			}
+			Telemetry::endIteration();
 		}
 		
 
@@ -133,6 +146,7 @@ int main(int argc, char *argv[]) {
 	std::cout << "Total time taken by program is : ";
 	std::cout << std::fixed  << GLOBAL_TIME.getTimeInSecFromStart() << std::setprecision(9); 
 	std::cout << " sec" << std::endl;
+	Telemetry::close();
 
 	return 0;
 }
@@ -39,6 +39,15 @@ int main(int argc, char *argv[]) {
 	std::cout << "PARAMETER FILE: " << parameterFile << std::endl;
 	Input input(parameterFile);
 	
+	/********************************************************************/
+	/* 		Multipliers kept from one optimization to the next 			*/
+	/********************************************************************/
+	std::shared_ptr<MultiplierStore> multiplierStore = std::make_shared<MultiplierStore>();
+	std::string multiplierStoreFile = input.getMultiplierStoreFile();
+	if (!multiplierStoreFile.empty()){
+		multiplierStore->read(multiplierStoreFile);
+	}
+
 	/********************************************************************/
 	/* 				For each file of demands, optimize it 				*/
 	/********************************************************************/
@@ -70,7 +79,12 @@ int main(int argc, char *argv[]) {
         ClockTime LAG1_OPTIMIZATION_TIME(ClockTime::getTimeNow());
 		lagSolverFactory factory;
 		AbstractLagSolver *solver = factory.createSolver(instance);
+		solver->getLagrangianFormulation()->setMultiplierStore(multiplierStore);
 		solver->run();
+		solver->getLagrangianFormulation()->storeMultipliers(*multiplierStore);
+		if (!multiplierStoreFile.empty()){
+			multiplierStore->write(multiplierStoreFile);
+		}
 		//Subgradient sub(instance);
 
 		std::cout << "UB: "<< solver->getUB() << std::endl;
@@ -0,0 +1,72 @@
+#include "AbstractQoTEvaluator.h"
+
+const std::string AbstractQoTEvaluator::TRANSCEIVER_TYPE = "Voyager";
+
+/* Writes the path requests in the json format expected by gnpy-path-request. */
+void AbstractQoTEvaluator::writeServiceFile(FILE *serviceFile, const std::vector<QoTRequest> &requests){
+    JsonWriter json(serviceFile);
+    json.beginObject();
+    json.key("path-request");
+    json.beginArray();
+    for (unsigned int i = 0; i < requests.size(); i++){
+        writePathRequest(json, requests[i]);
+    }
+    json.endArray();
+    json.key("synchronization");
+    json.beginArray();
+    json.endArray();
+    json.endObject();
+}
+
+void AbstractQoTEvaluator::writePathRequest(JsonWriter &json, const QoTRequest &request){
+    std::string source = std::to_string(request.source+1) + ".1";
+    std::string destination = std::to_string(request.target+1) + ".1";
+    json.beginObject();
+    json.key("request-id"); json.value(getRequestId(request));
+    json.key("source"); json.value(source);
+    json.key("destination"); json.value(destination);
+    json.key("src-tp-id"); json.value(source);
+    json.key("dst-tp-id"); json.value(destination);
+    json.key("bidirectional"); json.value(false);
+
+    json.key("path-constraints");
+    json.beginObject();
+    json.key("te-bandwidth");
+    json.beginObject();
+    json.key("technology"); json.value(std::string("flexi-grid"));
+    json.key("trx_type"); json.value(TRANSCEIVER_TYPE);
+    json.key("trx_mode"); json.value(request.mode);
+    json.key("effective-freq-slot");
+    json.beginArray();
+    json.beginObject();
+    json.key("N"); json.value(std::string("null"));
+    json.key("M"); json.value(std::string("null"));
+    json.endObject();
+    json.endArray();
+    json.key("spacing"); json.number(request.spacing);
+    json.key("max-nb-of-channel"); json.nullValue();
+    json.key("output-power"); json.nullValue();
+    json.key("path_bandwidth"); json.number(request.pathBandwidth);
+    json.endObject();
+    json.endObject();
+
+    json.key("explicit-route-objects");
+    json.beginObject();
+    json.key("route-object-include-exclude");
+    json.beginArray();
+    for (unsigned int i = 0; i < request.nodes.size(); i++){
+        json.beginObject();
+        json.key("explicit-route-usage"); json.value(std::string("route-include-ero"));
+        json.key("index"); json.value((int)i);
+        json.key("num-unnum-hop");
+        json.beginObject();
+        json.key("node-id"); json.value(std::to_string(request.nodes[i]+1));
+        json.key("link-tp-id"); json.value(std::string("link-tp-id is not used"));
+        json.key("hop-type"); json.value(std::string("STRICT"));
+        json.endObject();
+        json.endObject();
+    }
+    json.endArray();
+    json.endObject();
+    json.endObject();
+}
@@ -0,0 +1,72 @@
+#ifndef ABSTRACT_QOT_EVALUATOR_H
+#define ABSTRACT_QOT_EVALUATOR_H
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../topology/input.h"
+#include "../tools/jsonWriter.h"
+
+/** A lightpath whose quality of transmission is evaluated: a demand routed on a path of the physical topology. **/
+struct QoTRequest {
+    int demandId;                       /**< The demand's id. **/
+    int source;                         /**< The demand's source node id. **/
+    int target;                         /**< The demand's target node id. **/
+    std::vector<int> nodes;             /**< Node ids of the path, from source to target. **/
+    std::vector<double> linkLengths;    /**< Length of each link of the path (km). **/
+    std::string mode;                   /**< The GNPY mode of transmission. **/
+    std::string spacing;                /**< The GNPY spacing. **/
+    std::string pathBandwidth;          /**< The GNPY path_bandwidth. **/
+};
+
+/** Outcome of the evaluation of a lightpath. **/
+struct QoTResult {
+    int demandId;                       /**< The demand's id. **/
+    bool feasible;                      /**< True if the lightpath satisfies the QoT requirements of its mode. **/
+    double osnr;                        /**< Estimated OSNR (dB, 0.1 nm reference bandwidth), NaN if the backend does not give it. **/
+    double margin;                      /**< OSNR minus the OSNR required by the mode (dB), NaN if the backend does not give it. **/
+};
+
+/***********************************************************************************************
+ * Evaluates the quality of transmission (QoT) of lightpaths. Every integer candidate of the
+ * branch-and-cut is checked through an evaluator: the paths of all demands are given at once
+ * and one result is returned per path, in the same order. Concrete evaluators differ by their
+ * backend (GNPY called by command, persistent GNPY worker, native GN model). Evaluations may be
+ * requested concurrently by different threads of the MIP solver.
+ * ********************************************************************************************/
+class AbstractQoTEvaluator{
+
+    protected:
+        Input input;                    /**< The input giving the GNPY files and the output path. **/
+
+    public:
+        static const std::string TRANSCEIVER_TYPE;  /**< The GNPY transceiver (trx_type) of every lightpath. **/
+
+        /************************************************/
+        /*                 Constructors                 */
+        /************************************************/
+        AbstractQoTEvaluator(const Input &i):input(i){}
+
+        /************************************************/
+        /*                    Methods                   */
+        /************************************************/
+
+        /** Evaluates the lightpaths. @param requests The lightpaths. @param threadNo The calling thread. **/
+        virtual std::vector<QoTResult> evaluate(const std::vector<QoTRequest> &requests, int threadNo) = 0;
+
+        /** Returns the name of the GNPY request associated with a demand. **/
+        static std::string getRequestId(const QoTRequest &request) { return "Demand " + std::to_string(request.demandId+1); }
+
+        /** Streams the GNPY service file (path requests) of the lightpaths to a file or a pipe. **/
+        static void writeServiceFile(FILE *serviceFile, const std::vector<QoTRequest> &requests);
+
+        /** Streams the GNPY path request of a lightpath. **/
+        static void writePathRequest(JsonWriter &json, const QoTRequest &request);
+
+        virtual ~AbstractQoTEvaluator(){}
+};
+
+#endif
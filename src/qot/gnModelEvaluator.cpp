@@ -0,0 +1,314 @@
+#include "gnModelEvaluator.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include <limits>
+
+#include <boost/algorithm/string.hpp>
+
+#include "../tools/jsonReader.h"
+
+namespace {
+    const double PLANCK = 6.62607015e-34;   /* Planck constant (J.s). */
+    const double LIGHT_SPEED = 299792458.0; /* Speed of light in vacuum (m/s). */
+    const double PI = 3.14159265358979323846;
+
+    double dbToLinear(double db) { return std::pow(10.0, db/10.0); }
+    double linearToDb(double lin) { return 10.0*std::log10(lin); }
+
+    /* An object listed in a section of a GNPY file (e.g., an amplifier type of the equipment or an element of the
+     * topology). Nested values are named by their path from the object, e.g., "params/loss_coef" or "mode/0/OSNR". */
+    struct JsonObject {
+        std::string section;
+        std::map<std::string, std::string> values;
+
+        bool has(const std::string &name) const { return (values.find(name) != values.end()); }
+        std::string get(const std::string &name, const std::string &otherwise = "") const {
+            std::map<std::string, std::string>::const_iterator it = values.find(name);
+            return (it == values.end() ? otherwise : it->second);
+        }
+        double getNumber(const std::string &name, double otherwise) const { return (has(name) ? std::atof(get(name).c_str()) : otherwise); }
+    };
+
+    /* Single pass over the tokens of a GNPY file: the objects listed in the arrays of the root object ("Edfa", "SI",
+     * "elements", ...) are flattened. Returns false if the file cannot be opened or is malformed. */
+    bool readSections(const std::string &fileName, std::vector<JsonObject> &objects){
+        /* The parameter file may leave blanks after the name. */
+        std::ifstream file(boost::algorithm::trim_copy(fileName).c_str());
+        if (!file.is_open()){
+            return false;
+        }
+        /* One entry per open object or array, with the name it has in its parent (key or index). */
+        struct Level {
+            bool isArray;
+            int nextIndex;
+            std::string name;
+        };
+        std::vector<Level> levels;
+        std::string key;
+        JsonReader reader(file);
+        JsonReader::Token token = reader.next();
+        while (token != JsonReader::END && token != JsonReader::ERROR){
+            switch (token){
+                case JsonReader::KEY:
+                    key = reader.text();
+                    break;
+                case JsonReader::BEGIN_OBJECT:
+                case JsonReader::BEGIN_ARRAY: {
+                    std::string name = (!levels.empty() && levels.back().isArray) ? std::to_string(levels.back().nextIndex++) : key;
+                    if (token == JsonReader::BEGIN_OBJECT && levels.size() == 2 && levels[1].isArray){
+                        JsonObject object;
+                        object.section = levels[1].name;
+                        objects.push_back(object);
+                    }
+                    Level level = {token == JsonReader::BEGIN_ARRAY, 0, name};
+                    levels.push_back(level);
+                    break;
+                }
+                case JsonReader::END_OBJECT:
+                case JsonReader::END_ARRAY:
+                    if (!levels.empty()){
+                        levels.pop_back();
+                    }
+                    break;
+                default: {
+                    std::string name = (!levels.empty() && levels.back().isArray) ? std::to_string(levels.back().nextIndex++) : key;
+                    if (levels.size() >= 3 && levels[1].isArray && !objects.empty()){
+                        std::string path;
+                        for (unsigned int i = 3; i < levels.size(); i++){
+                            path += levels[i].name + "/";
+                        }
+                        objects.back().values[path + name] = reader.text();
+                    }
+                    break;
+                }
+            }
+            token = reader.next();
+        }
+        return (token == JsonReader::END);
+    }
+}
+
+gnModelEvaluator::gnModelEvaluator(const Input &i):AbstractQoTEvaluator(i), REFERENCE_BANDWIDTH(12.5e9),
+    fiberAttenuation(0.2), fiberGamma(1.27), fiberBeta2(21.27e-27*1000.0), maxSpanLength(80.0),
+    noiseFigure(5.5), launchPower(0.0), wdmBandwidth(4.0e12), frequency(193.5e12), systemMargin(2.0){
+    readParameters();
+}
+
+/* The modes are the ones of the transceiver of the path requests. The spectrum, launch power and margin are the ones of
+ * the first SI. The fibre and amplifier types are the ones placed in the topology; if the topology places no amplifier
+ * type (GNPY then designs the amplification), the types allowed for design are considered. Only the fixed gain (nf0) and
+ * variable gain (nf_min) amplifiers have a noise figure the model can use. */
+void gnModelEvaluator::readParameters(){
+    std::vector<JsonObject> equipment;
+    if (!readSections(input.getGNPYEquipmentFile(), equipment)){
+        std::cout << "WARNING: Could not read the GNPY equipment file '" << input.getGNPYEquipmentFile() << "'. The GN model knows no mode." << std::endl;
+        return;
+    }
+    double defaultTxOsnr = 40.0;
+    std::map<std::string, std::pair<double, double> > fiberTypes;     /* gamma (1/W/m) and dispersion (s/m^2) by type. */
+    std::map<std::string, double> amplifierNoiseFigures;
+    std::vector<std::string> designAmplifiers;
+    bool readSI = false;
+    for (unsigned int i = 0; i < equipment.size(); i++){
+        const JsonObject &object = equipment[i];
+        if (object.section == "SI" && !readSI){
+            readSI = true;
+            launchPower = object.getNumber("power_dbm", launchPower);
+            systemMargin = object.getNumber("sys_margins", systemMargin);
+            defaultTxOsnr = object.getNumber("tx_osnr", defaultTxOsnr);
+            if (object.has("f_min") && object.has("f_max")){
+                wdmBandwidth = object.getNumber("f_max", 0.0) - object.getNumber("f_min", 0.0);
+                frequency = 0.5*(object.getNumber("f_max", 0.0) + object.getNumber("f_min", 0.0));
+            }
+        }
+        else if (object.section == "Span" && object.has("max_length")){
+            maxSpanLength = object.getNumber("max_length", maxSpanLength);
+            if (object.get("length_units", "km") == "m"){
+                maxSpanLength /= 1000.0;
+            }
+        }
+        else if (object.section == "Fiber" || object.section == "RamanFiber"){
+            std::string type = object.get("type_variety");
+            if (object.has("gamma") && object.has("dispersion") && fiberTypes.find(type) == fiberTypes.end()){
+                fiberTypes[type] = std::make_pair(object.getNumber("gamma", 0.0), object.getNumber("dispersion", 0.0));
+            }
+        }
+        else if (object.section == "Edfa"){
+            std::string type = object.get("type_variety");
+            std::string model = object.get("type_def", "variable_gain");
+            std::string noise = (model == "fixed_gain") ? "nf0" : (model == "variable_gain") ? "nf_min" : "";
+            if (!noise.empty() && object.has(noise)){
+                amplifierNoiseFigures[type] = object.getNumber(noise, 0.0);
+                if (object.get("allowed_for_design") != "false"){
+                    designAmplifiers.push_back(type);
+                }
+            }
+        }
+    }
+    for (unsigned int i = 0; i < equipment.size(); i++){
+        const JsonObject &object = equipment[i];
+        if (object.section != "Transceiver" || object.get("type_variety") != TRANSCEIVER_TYPE){
+            continue;
+        }
+        for (int m = 0; object.has("mode/" + std::to_string(m) + "/format"); m++){
+            std::string prefix = "mode/" + std::to_string(m) + "/";
+            Mode mode = {object.getNumber(prefix + "baud_rate", 0.0), object.getNumber(prefix + "OSNR", 0.0), object.getNumber(prefix + "tx_osnr", defaultTxOsnr)};
+            if (mode.baudRate > 0.0 && object.has(prefix + "OSNR")){
+                modes[object.get(prefix + "format")] = mode;
+            }
+        }
+    }
+    if (modes.empty()){
+        std::cout << "WARNING: The GNPY equipment file defines no mode for transceiver " << TRANSCEIVER_TYPE << ". The GN model knows no mode." << std::endl;
+    }
+
+    std::vector<JsonObject> topology;
+    if (!readSections(input.getGNPYTopologyFile(), topology)){
+        std::cout << "WARNING: Could not read the GNPY topology file '" << input.getGNPYTopologyFile() << "'." << std::endl;
+    }
+    double loss = std::numeric_limits<double>::max();
+    double gamma = std::numeric_limits<double>::max();
+    double dispersion = 0.0;
+    std::vector<std::string> placedAmplifiers;
+    for (unsigned int i = 0; i < topology.size(); i++){
+        const JsonObject &element = topology[i];
+        if (element.section != "elements"){
+            continue;
+        }
+        std::string type = element.get("type");
+        if (type == "Fiber" || type == "RamanFiber"){
+            if (element.has("params/loss_coef")){
+                loss = std::min(loss, element.getNumber("params/loss_coef", loss));
+            }
+            std::map<std::string, std::pair<double, double> >::const_iterator it = fiberTypes.find(element.get("type_variety", "SSMF"));
+            if (it != fiberTypes.end()){
+                gamma = std::min(gamma, it->second.first);
+                dispersion = std::max(dispersion, std::fabs(it->second.second));
+            }
+        }
+        else if (type == "Edfa" && !element.get("type_variety").empty()){
+            placedAmplifiers.push_back(element.get("type_variety"));
+        }
+    }
+    if (placedAmplifiers.empty()){
+        placedAmplifiers = designAmplifiers;
+    }
+    double figure = std::numeric_limits<double>::max();
+    for (unsigned int i = 0; i < placedAmplifiers.size(); i++){
+        std::map<std::string, double>::const_iterator it = amplifierNoiseFigures.find(placedAmplifiers[i]);
+        if (it != amplifierNoiseFigures.end()){
+            figure = std::min(figure, it->second);
+        }
+    }
+
+    if (loss < std::numeric_limits<double>::max()){
+        fiberAttenuation = loss;
+    }
+    else{
+        std::cout << "WARNING: The GNPY topology gives no fibre loss. The GN model uses " << fiberAttenuation << " dB/km." << std::endl;
+    }
+    if (gamma < std::numeric_limits<double>::max() && dispersion > 0.0){
+        /* GNPY gives gamma in 1/W/m and the dispersion D in s/m^2, with |beta2| = D lambda^2/(2 pi c). */
+        double wavelength = LIGHT_SPEED/frequency;
+        fiberGamma = gamma*1000.0;
+        fiberBeta2 = dispersion*wavelength*wavelength/(2.0*PI*LIGHT_SPEED)*1000.0;
+    }
+    else{
+        std::cout << "WARNING: The fibre types of the GNPY topology are not in the equipment. The GN model uses SSMF." << std::endl;
+    }
+    if (figure < std::numeric_limits<double>::max()){
+        noiseFigure = figure;
+    }
+    else{
+        std::cout << "WARNING: No amplifier of the GNPY files has a noise figure the GN model can use. It uses " << noiseFigure << " dB." << std::endl;
+    }
+}
+
+const gnModelEvaluator::Mode * gnModelEvaluator::findMode(const std::string &name) const{
+    std::map<std::string, Mode>::const_iterator it = modes.find(name);
+    if (it == modes.end()){
+        return NULL;
+    }
+    return &(it->second);
+}
+
+/* Closed form GN model on each span:
+ * G_NLI = 8/27 gamma^2 G^3 Leff^2 asinh(pi^2/2 |beta2| Leff,a B_wdm^2) / (pi |beta2| Leff,a),
+ * with Leff = (1-exp(-alpha L))/alpha and Leff,a = 1/alpha. The amplifier after the span adds
+ * ASE of power NF h nu Gain over the channel bandwidth. */
+double gnModelEvaluator::getLinkNoiseToSignal(double length, double baudRate) const{
+    if (length <= 0.0){
+        return 0.0;
+    }
+    int nbSpans = (int)std::ceil(length/maxSpanLength);
+    double spanLength = length/nbSpans;
+
+    double alpha = fiberAttenuation/(10.0*std::log10(std::exp(1.0)));      /* 1/km */
+    double effectiveLength = (1.0 - std::exp(-alpha*spanLength))/alpha;
+    double asymptoticLength = 1.0/alpha;
+    double gain = dbToLinear(fiberAttenuation*spanLength);
+
+    double power = dbToLinear(launchPower)*1.0e-3;
+    double psd = power/baudRate;
+    double gnli = (8.0/27.0)*fiberGamma*fiberGamma*psd*psd*psd*effectiveLength*effectiveLength
+                * std::asinh(0.5*PI*PI*fiberBeta2*asymptoticLength*wdmBandwidth*wdmBandwidth)
+                / (PI*fiberBeta2*asymptoticLength);
+    double nli = gnli*baudRate;
+    double ase = dbToLinear(noiseFigure)*PLANCK*frequency*gain*baudRate;
+
+    return nbSpans*(ase + nli)/power;
+}
+
+double gnModelEvaluator::getOsnr(const QoTRequest &request) const{
+    const Mode &mode = *findMode(request.mode);
+    double noiseToSignal = 0.0;
+    for (unsigned int i = 0; i < request.linkLengths.size(); i++){
+        noiseToSignal += getLinkNoiseToSignal(request.linkLengths[i], mode.baudRate);
+    }
+    /* Bring the SNR over the channel bandwidth to the reference bandwidth, then add the transceiver noise. */
+    noiseToSignal *= REFERENCE_BANDWIDTH/mode.baudRate;
+    noiseToSignal += 1.0/dbToLinear(mode.txOsnr);
+    return linearToDb(1.0/noiseToSignal);
+}
+
+/* Inverts getOsnr: the line noise, brought to the reference bandwidth, plus the transceiver noise must not exceed the required noise. */
+double gnModelEvaluator::getNoiseBudget(const std::string &name) const{
+    const Mode &mode = *findMode(name);
+    double budget = 1.0/dbToLinear(mode.requiredOsnr + systemMargin) - 1.0/dbToLinear(mode.txOsnr);
+    return std::max(0.0, budget*mode.baudRate/REFERENCE_BANDWIDTH);
+}
+
+/* The noise of a link is at least its length times the smallest noise per km of a single span, which
+ * is looked for on a grid of span lengths (a 1% slack covers the grid step). */
+double gnModelEvaluator::getReach(const std::string &name) const{
+    double baudRate = findMode(name)->baudRate;
+    double minNoisePerKm = std::numeric_limits<double>::max();
+    for (double length = 0.5; length <= maxSpanLength; length += 0.5){
+        minNoisePerKm = std::min(minNoisePerKm, getLinkNoiseToSignal(length, baudRate)/length);
+    }
+    return 1.01*getNoiseBudget(name)/minNoisePerKm;
+}
+
+std::vector<QoTResult> gnModelEvaluator::evaluate(const std::vector<QoTRequest> &requests, int threadNo){
+    std::vector<QoTResult> results;
+    for (unsigned int i = 0; i < requests.size(); i++){
+        QoTResult result;
+        result.demandId = requests[i].demandId;
+        const Mode *mode = findMode(requests[i].mode);
+        if (mode == NULL){
+            std::cout << "WARNING: Mode " << requests[i].mode << " of " << getRequestId(requests[i]) << " is unknown to the GN model. It is considered unfeasible." << std::endl;
+            result.feasible = false;
+            result.osnr = std::numeric_limits<double>::quiet_NaN();
+            result.margin = std::numeric_limits<double>::quiet_NaN();
+        }
+        else{
+            result.osnr = getOsnr(requests[i]);
+            result.margin = result.osnr - mode->requiredOsnr - systemMargin;
+            result.feasible = (result.margin >= 0.0);
+        }
+        results.push_back(result);
+    }
+    return results;
+}
@@ -0,0 +1,80 @@
+#ifndef GN_MODEL_EVALUATOR_H
+#define GN_MODEL_EVALUATOR_H
+
+#include <map>
+
+#include "AbstractQoTEvaluator.h"
+
+/***********************************************************************************************
+ * Native QoT evaluator based on the closed form of the Gaussian Noise (GN) model. Each link is
+ * cut into equal spans of at most the maximum span length, each followed by an amplifier
+ * compensating the span loss. The OSNR of a lightpath accumulates the ASE noise of the
+ * amplifiers and the nonlinear interference of the spans incoherently, together with the
+ * transceiver OSNR. The lightpath is feasible if its OSNR is at least the OSNR required by its
+ * mode plus the system margin. The parameters are read from the GNPY files of the input: the
+ * modes of the transceiver of the path requests, the launch power, band and margin (SI), the
+ * maximum span length (Span) from the equipment, and the fibres and amplifiers from the
+ * topology. Where the topology holds several fibres or amplifiers, the least noisy values are
+ * taken (lowest loss, lowest nonlinear coefficient, highest dispersion, lowest noise figure);
+ * connector losses are ignored. No process is started, so the evaluation is cheap enough to be
+ * called on every candidate. The model is an approximation of GNPY: it is not known to be
+ * optimistic with respect to it.
+ * ********************************************************************************************/
+class gnModelEvaluator : public AbstractQoTEvaluator{
+
+    private:
+        /** Transceiver mode: symbol rate and OSNR thresholds. **/
+        struct Mode {
+            double baudRate;        /**< Symbol rate (Hz). **/
+            double requiredOsnr;    /**< Minimum OSNR (dB, 0.1 nm reference bandwidth). **/
+            double txOsnr;          /**< OSNR at the transceiver output (dB). **/
+        };
+
+        const double REFERENCE_BANDWIDTH;   /**< OSNR reference bandwidth (Hz). **/
+
+        double fiberAttenuation;    /**< Fibre attenuation (dB/km). **/
+        double fiberGamma;          /**< Nonlinear coefficient (1/W/km). **/
+        double fiberBeta2;          /**< Absolute value of the group velocity dispersion (s^2/km). **/
+        double maxSpanLength;       /**< Maximum length of a span (km). **/
+        double noiseFigure;         /**< Noise figure of the amplifiers (dB). **/
+        double launchPower;         /**< Launch power per channel (dBm). **/
+        double wdmBandwidth;        /**< Total bandwidth of the WDM comb (Hz). **/
+        double frequency;           /**< Centre frequency of the band (Hz). **/
+        double systemMargin;        /**< Margin added to the required OSNR (dB). **/
+
+        std::map<std::string, Mode> modes;  /**< Transceiver modes indexed by their GNPY name. **/
+
+        /** Reads the parameters from the GNPY equipment and topology files of the input. The values missing from the files keep the defaults of GNPY (SSMF fibre, 5.5 dB noise figure, 0 dBm launch power, 80 km spans, 2 dB margin). **/
+        void readParameters();
+
+        /** Returns the mode of a lightpath, NULL if the mode is unknown. **/
+        const Mode * findMode(const std::string &name) const;
+
+        /** Returns the noise-to-signal ratio accumulated on a link by ASE and nonlinear interference. **/
+        double getLinkNoiseToSignal(double length, double baudRate) const;
+
+    public:
+        gnModelEvaluator(const Input &i);
+
+        /** Returns true if the mode is defined for the transceiver of the path requests in the equipment file. **/
+        bool hasMode(const std::string &mode) const { return (findMode(mode) != NULL); }
+
+        /** Returns the OSNR (dB, 0.1 nm reference bandwidth) of a lightpath. The mode must be known (see hasMode). **/
+        double getOsnr(const QoTRequest &request) const;
+
+        /** Returns the noise-to-signal ratio added by a link to a lightpath of the given mode. Noise adds up along a route, so that it can be used as a shortest path length. The mode must be known. **/
+        double getLinkNoise(double length, const std::string &mode) const { return getLinkNoiseToSignal(length, findMode(mode)->baudRate); }
+
+        /** Returns the largest noise-to-signal ratio a route may accumulate (sum of getLinkNoise) for the given mode to be feasible. The mode must be known. **/
+        double getNoiseBudget(const std::string &mode) const;
+
+        /** Returns an upper bound on the length (km) of the routes of the given mode that are feasible for the model. The mode must be known. **/
+        double getReach(const std::string &mode) const;
+
+        /** Evaluates the lightpaths. A lightpath whose mode is unknown is unfeasible, as GNPY finds no path for it. **/
+        std::vector<QoTResult> evaluate(const std::vector<QoTRequest> &requests, int threadNo) override;
+
+        ~gnModelEvaluator(){}
+};
+
+#endif
@@ -0,0 +1,106 @@
+#include "gnpyCommandEvaluator.h"
+
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+#include "../tools/jsonReader.h"
+
+std::vector<QoTResult> gnpyCommandEvaluator::evaluate(const std::vector<QoTRequest> &requests, int threadNo){
+    std::vector<QoTResult> results;
+
+    // write service.json file
+    std::string serviceFileName = input.getOutputPath() + "service_" + std::to_string(threadNo) + ".json";
+    FILE *serviceFile = fopen(serviceFileName.c_str(), "w");
+    if (serviceFile == NULL){
+        std::cout << "ERROR: Could not open " << serviceFileName << "." << std::endl;
+        exit(0);
+    }
+    writeServiceFile(serviceFile, requests);
+    fclose(serviceFile);
+
+    // launch GNPY
+    std::string resultFile = input.getOutputPath() + "result_" + std::to_string(threadNo) + ".json";
+    std::string arguments = input.getGNPYTopologyFile() + " " + serviceFileName;
+    std::string options = "-e " + input.getGNPYEquipmentFile() + " -o " + resultFile;
+    std::string command = "gnpy-path-request " + arguments + " " + options;
+    system(command.c_str());
+
+    // read result.json file
+    std::ifstream ifs(resultFile.c_str());
+    std::map<std::string, bool> responses = readResponses(ifs);
+    for (unsigned int i = 0; i < requests.size(); i++){
+        QoTResult result;
+        result.demandId = requests[i].demandId;
+        std::map<std::string, bool>::const_iterator it = responses.find(getRequestId(requests[i]));
+        if (it == responses.end()){
+            std::cout << "WARNING: No GNPY response for " << getRequestId(requests[i]) << ". It is considered unfeasible." << std::endl;
+            result.feasible = false;
+        }
+        else{
+            result.feasible = it->second;
+        }
+        result.osnr = std::numeric_limits<double>::quiet_NaN();
+        result.margin = std::numeric_limits<double>::quiet_NaN();
+        results.push_back(result);
+    }
+    return results;
+}
+
+/* Single pass over the tokens of the result file. A response is an object with a response-id member; it is unfeasible
+if the same object has a no-path member. Members of nested objects are not considered. */
+std::map<std::string, bool> gnpyCommandEvaluator::readResponses(std::istream &content){
+    /* One entry per open object or array. */
+    struct Level {
+        bool isObject;
+        std::string id;
+        bool hasId;
+        bool noPath;
+    };
+    std::map<std::string, bool> responses;
+    std::vector<Level> levels;
+    JsonReader reader(content);
+    JsonReader::Token token = reader.next();
+    while (token != JsonReader::END && token != JsonReader::ERROR){
+        switch (token){
+            case JsonReader::BEGIN_OBJECT:
+            case JsonReader::BEGIN_ARRAY: {
+                Level level = {token == JsonReader::BEGIN_OBJECT, "", false, false};
+                levels.push_back(level);
+                break;
+            }
+            case JsonReader::END_OBJECT:
+            case JsonReader::END_ARRAY:
+                if (!levels.empty()){
+                    if (levels.back().isObject && levels.back().hasId){
+                        responses[levels.back().id] = !levels.back().noPath;
+                    }
+                    levels.pop_back();
+                }
+                break;
+            case JsonReader::KEY:
+                if (!levels.empty() && levels.back().isObject){
+                    if (reader.text() == "no-path"){
+                        levels.back().noPath = true;
+                    }
+                    else if (reader.text() == "response-id"){
+                        token = reader.next();
+                        if (token == JsonReader::STRING || token == JsonReader::NUMBER){
+                            levels.back().id = reader.text();
+                            levels.back().hasId = true;
+                        }
+                        /* The token following the key was consumed here. */
+                        continue;
+                    }
+                }
+                break;
+            default:
+                break;
+        }
+        token = reader.next();
+    }
+    if (token == JsonReader::ERROR){
+        std::cout << "WARNING: The GNPY result file is malformed. The responses read before the error are kept." << std::endl;
+    }
+    return responses;
+}
@@ -0,0 +1,30 @@
+#ifndef GNPY_COMMAND_EVALUATOR_H
+#define GNPY_COMMAND_EVALUATOR_H
+
+#include <istream>
+#include <map>
+
+#include "AbstractQoTEvaluator.h"
+
+/***********************************************************************************************
+ * QoT evaluator calling the gnpy-path-request command on each candidate. The path requests are
+ * streamed to service_<thread>.json and the responses read from result_<thread>.json in the
+ * output folder, in a single pass. Each call starts a new interpreter that loads the topology
+ * and the equipment again.
+ * ********************************************************************************************/
+class gnpyCommandEvaluator : public AbstractQoTEvaluator{
+
+    private:
+        /** Reads the responses of a GNPY result file with a streaming JSON tokenizer. Returns true for each response-id
+         * whose response object has a path (no no-path member). **/
+        static std::map<std::string, bool> readResponses(std::istream &content);
+
+    public:
+        gnpyCommandEvaluator(const Input &i):AbstractQoTEvaluator(i){}
+
+        std::vector<QoTResult> evaluate(const std::vector<QoTRequest> &requests, int threadNo) override;
+
+        ~gnpyCommandEvaluator(){}
+};
+
+#endif
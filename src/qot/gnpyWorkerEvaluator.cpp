@@ -0,0 +1,198 @@
+#include "gnpyWorkerEvaluator.h"
+
+#include <cmath>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <fcntl.h>
+#include <pthread.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+/************************************************************
+ * Blocks SIGPIPE in the calling thread while it writes to a
+ * worker, so that a dead worker is reported by the write
+ * instead of killing the solver. A SIGPIPE raised by the
+ * writes is consumed before the previous mask is restored;
+ * the disposition of the signal is left untouched.
+************************************************************/
+class PipeSignalBlocker {
+    private:
+        sigset_t pipeSignal;
+        sigset_t previousMask;
+        bool wasPending;
+
+    public:
+        PipeSignalBlocker(){
+            sigemptyset(&pipeSignal);
+            sigaddset(&pipeSignal, SIGPIPE);
+            sigset_t pending;
+            sigpending(&pending);
+            wasPending = (sigismember(&pending, SIGPIPE) == 1);
+            pthread_sigmask(SIG_BLOCK, &pipeSignal, &previousMask);
+        }
+
+        ~PipeSignalBlocker(){
+            if (!wasPending){
+                struct timespec noWait = {0, 0};
+                while (sigtimedwait(&pipeSignal, NULL, &noWait) == SIGPIPE){}
+            }
+            pthread_sigmask(SIG_SETMASK, &previousMask, NULL);
+        }
+};
+
+gnpyWorkerEvaluator::gnpyWorkerEvaluator(const Input &i):AbstractQoTEvaluator(i){}
+
+/* The pipes are created close-on-exec: a worker started later by another thread must not inherit the pipe ends of
+this one, otherwise closing them here would not end this worker and waitpid would hang. dup2 clears the flag on the
+standard input and output of the child. */
+bool gnpyWorkerEvaluator::startWorker(Worker &worker){
+    int toChild[2];
+    int fromChild[2];
+    if (pipe2(toChild, O_CLOEXEC) != 0){
+        return false;
+    }
+    if (pipe2(fromChild, O_CLOEXEC) != 0){
+        close(toChild[0]); close(toChild[1]);
+        return false;
+    }
+    pid_t pid = fork();
+    if (pid < 0){
+        close(toChild[0]); close(toChild[1]);
+        close(fromChild[0]); close(fromChild[1]);
+        return false;
+    }
+    if (pid == 0){
+        dup2(toChild[0], STDIN_FILENO);
+        dup2(fromChild[1], STDOUT_FILENO);
+        close(toChild[0]); close(toChild[1]);
+        close(fromChild[0]); close(fromChild[1]);
+        execlp("python3", "python3", input.getGNPYWorkerScript().c_str(),
+               input.getGNPYTopologyFile().c_str(), input.getGNPYEquipmentFile().c_str(), (char *)NULL);
+        _exit(127);
+    }
+    close(toChild[0]);
+    close(fromChild[1]);
+    worker.pid = pid;
+    worker.toWorker = fdopen(toChild[1], "w");
+    worker.fromWorker = fdopen(fromChild[0], "r");
+    return (worker.toWorker != NULL && worker.fromWorker != NULL);
+}
+
+void gnpyWorkerEvaluator::stopWorker(Worker &worker){
+    if (worker.toWorker != NULL){
+        /* Closing flushes what is left in the buffer. */
+        PipeSignalBlocker blocker;
+        fclose(worker.toWorker);
+        worker.toWorker = NULL;
+    }
+    if (worker.fromWorker != NULL){
+        fclose(worker.fromWorker);
+        worker.fromWorker = NULL;
+    }
+    if (worker.pid > 0){
+        waitpid(worker.pid, NULL, 0);
+        worker.pid = -1;
+    }
+}
+
+gnpyWorkerEvaluator::Worker & gnpyWorkerEvaluator::getWorker(int threadNo){
+    std::lock_guard<std::mutex> lock(workersMutex);
+    std::map<int, Worker>::iterator it = workers.find(threadNo);
+    if (it == workers.end()){
+        Worker worker = {-1, NULL, NULL};
+        if (!startWorker(worker)){
+            std::cout << "ERROR: Could not start the GNPY worker " << input.getGNPYWorkerScript() << "." << std::endl;
+            exit(0);
+        }
+        it = workers.insert(std::make_pair(threadNo, worker)).first;
+    }
+    return it->second;
+}
+
+bool gnpyWorkerEvaluator::exchange(Worker &worker, const std::vector<QoTRequest> &requests, std::vector<QoTResult> &results){
+    {
+        PipeSignalBlocker blocker;
+        writeServiceFile(worker.toWorker, requests);
+        if (fputs("\nEND\n", worker.toWorker) < 0 || fflush(worker.toWorker) != 0 || ferror(worker.toWorker)){
+            return false;
+        }
+    }
+
+    /* Read the answer until END. */
+    std::map<std::string, QoTResult> answers;
+    char buffer[1024];
+    bool ended = false;
+    while (!ended && fgets(buffer, sizeof(buffer), worker.fromWorker) != NULL){
+        std::string line(buffer);
+        while (!line.empty() && (line.back() == '\n' || line.back() == '\r')){
+            line.pop_back();
+        }
+        if (line == "END"){
+            ended = true;
+            continue;
+        }
+        std::size_t firstTab = line.find('\t');
+        if (firstTab == std::string::npos){
+            continue;
+        }
+        std::size_t secondTab = line.find('\t', firstTab+1);
+        if (secondTab == std::string::npos){
+            continue;
+        }
+        QoTResult answer;
+        std::string status = line.substr(firstTab+1, secondTab-firstTab-1);
+        /* A request GNPY could not process is treated as infeasible. */
+        answer.feasible = (status == "OK");
+        answer.osnr = std::strtod(line.substr(secondTab+1).c_str(), NULL);
+        answers[line.substr(0, firstTab)] = answer;
+    }
+    if (!ended){
+        return false;
+    }
+
+    results.clear();
+    for (unsigned int i = 0; i < requests.size(); i++){
+        QoTResult result;
+        result.demandId = requests[i].demandId;
+        std::map<std::string, QoTResult>::const_iterator it = answers.find(getRequestId(requests[i]));
+        if (it == answers.end()){
+            result.feasible = false;
+            result.osnr = std::numeric_limits<double>::quiet_NaN();
+        }
+        else{
+            result.feasible = it->second.feasible;
+            result.osnr = it->second.osnr;
+        }
+        result.margin = std::numeric_limits<double>::quiet_NaN();
+        results.push_back(result);
+    }
+    return true;
+}
+
+std::vector<QoTResult> gnpyWorkerEvaluator::evaluate(const std::vector<QoTRequest> &requests, int threadNo){
+    std::vector<QoTResult> results;
+    Worker &worker = getWorker(threadNo);
+    if (exchange(worker, requests, results)){
+        return results;
+    }
+    /* The worker died or answered partially: restart it once. */
+    std::cout << "WARNING: GNPY worker of thread " << threadNo << " stopped. Restarting it." << std::endl;
+    stopWorker(worker);
+    if (!startWorker(worker) || !exchange(worker, requests, results)){
+        std::cout << "ERROR: GNPY worker " << input.getGNPYWorkerScript() << " failed twice." << std::endl;
+        exit(0);
+    }
+    return results;
+}
+
+gnpyWorkerEvaluator::~gnpyWorkerEvaluator(){
+    std::lock_guard<std::mutex> lock(workersMutex);
+    for (std::map<int, Worker>::iterator it = workers.begin(); it != workers.end(); ++it){
+        stopWorker(it->second);
+    }
+    workers.clear();
+}
@@ -0,0 +1,52 @@
+#ifndef GNPY_WORKER_EVALUATOR_H
+#define GNPY_WORKER_EVALUATOR_H
+
+#include <map>
+#include <mutex>
+#include <sys/types.h>
+
+#include "AbstractQoTEvaluator.h"
+
+/***********************************************************************************************
+ * QoT evaluator talking to long-lived GNPY worker processes. Each worker is a python process
+ * running GNPY_workerScript: it loads the topology and the equipment once, then answers batches
+ * of path requests read on its standard input. One worker is started per calling thread, the
+ * first time the thread evaluates a candidate, so that concurrent callbacks never share a pipe.
+ * Protocol: the service json of a batch is streamed to the pipe, followed by a line "END"; the
+ * worker answers one line "<request-id>\t<OK|NO-PATH|ERROR>\t<osnr>" per request followed by a
+ * line "END". A worker that died is restarted once before the evaluation is abandoned.
+ * ********************************************************************************************/
+class gnpyWorkerEvaluator : public AbstractQoTEvaluator{
+
+    private:
+        /** A running worker and the pipe ends used to talk to it. **/
+        struct Worker {
+            pid_t pid;          /**< The worker's process id. **/
+            FILE *toWorker;     /**< Write end of the worker's standard input. **/
+            FILE *fromWorker;   /**< Read end of the worker's standard output. **/
+        };
+
+        std::map<int, Worker> workers;  /**< Workers indexed by the calling thread. **/
+        std::mutex workersMutex;        /**< Protects the map of workers. **/
+
+        /** Starts a worker. Returns false if the process could not be created. **/
+        bool startWorker(Worker &worker);
+
+        /** Closes the pipes of a worker and waits for its end. **/
+        void stopWorker(Worker &worker);
+
+        /** Returns the worker of the calling thread, starting it if needed. **/
+        Worker & getWorker(int threadNo);
+
+        /** Sends a batch to a worker and reads its answer. Returns false on a broken pipe or an incomplete answer. **/
+        bool exchange(Worker &worker, const std::vector<QoTRequest> &requests, std::vector<QoTResult> &results);
+
+    public:
+        gnpyWorkerEvaluator(const Input &i);
+
+        std::vector<QoTResult> evaluate(const std::vector<QoTRequest> &requests, int threadNo) override;
+
+        ~gnpyWorkerEvaluator();
+};
+
+#endif
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+"""
+Persistent GNPY worker used by gnpyWorkerEvaluator (GNPY_evaluator=1).
+
+Usage: python3 gnpy_worker.py <topology.json> <equipment.json>
+
+The equipment and the network are loaded once. Batches of path requests are then read
+from the standard input, each one as the service json (same format as the files given to
+gnpy-path-request) followed by a line "END". For each request, one line
+"<request-id>\t<OK|NO-PATH|ERROR>\t<osnr>" is written, then a line "END".
+"""
+
+import sys
+import json
+from copy import deepcopy
+from pathlib import Path
+
+from numpy import mean
+
+from gnpy.core.network import build_network
+from gnpy.core.utils import automatic_nch, lin2db
+from gnpy.tools.json_io import load_equipment, load_network, requests_from_json, disjunctions_from_json
+from gnpy.topology.request import (compute_path_dsjctn, correct_json_route_list,
+                                   compute_path_with_disjunction, deduplicate_disjunctions)
+
+
+def load(topology_file, equipment_file):
+    """Loads the equipment and builds the network, as gnpy-path-request does on each call."""
+    equipment = load_equipment(Path(equipment_file))
+    network = load_network(Path(topology_file), equipment)
+    si = equipment['SI']['default']
+    nb_channels = automatic_nch(si.f_min, si.f_max, si.spacing)
+    build_network(network, equipment, si.power_dbm, si.power_dbm + lin2db(nb_channels))
+    return equipment, network
+
+
+def evaluate(equipment, network, service):
+    requests = requests_from_json(service, equipment)
+    requests = correct_json_route_list(network, requests)
+    disjunctions = deduplicate_disjunctions(disjunctions_from_json(service))
+    paths = compute_path_dsjctn(network, equipment, requests, disjunctions)
+    propagated = compute_path_with_disjunction(network, equipment, requests, paths)
+    answers = []
+    for request, path in zip(requests, propagated):
+        blocked = getattr(request, 'blocking_reason', None)
+        if blocked is not None or not path:
+            answers.append((request.request_id, 'NO-PATH', float('nan')))
+        else:
+            osnr = float(mean(path[-1].osnr_ase_01nm))
+            answers.append((request.request_id, 'OK', osnr))
+    return answers
+
+
+def read_batch(stream):
+    lines = []
+    for line in stream:
+        if line.strip() == 'END':
+            return ''.join(lines)
+        lines.append(line)
+    return None
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.stderr.write('usage: gnpy_worker.py <topology.json> <equipment.json>\n')
+        sys.exit(1)
+    equipment, network = load(sys.argv[1], sys.argv[2])
+    stdin = sys.stdin
+    stdout = sys.stdout
+    while True:
+        batch = read_batch(stdin)
+        if batch is None:
+            break
+        service = json.loads(batch)
+        try:
+            answers = evaluate(equipment, deepcopy(network), service)
+        except Exception as error:
+            sys.stderr.write('gnpy_worker: %s\n' % error)
+            answers = [(r['request-id'], 'ERROR', float('nan')) for r in service['path-request']]
+        for request_id, status, osnr in answers:
+            stdout.write('%s\t%s\t%f\n' % (request_id, status, osnr))
+        stdout.write('END\n')
+        stdout.flush()
+
+
+if __name__ == '__main__':
+    main()
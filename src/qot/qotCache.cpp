@@ -0,0 +1,94 @@
+#include "qotCache.h"
+
+#include <cstdlib>
+#include <iomanip>
+#include <limits>
+
+/****************************************************************************************/
+/*                                      Getters                                         */
+/****************************************************************************************/
+
+std::string QoTCache::getKey(const QoTRequest &request){
+    std::ostringstream key;
+    key << request.mode << "|" << request.spacing << "|" << request.pathBandwidth << "|";
+    for (unsigned int i = 0; i < request.nodes.size(); i++){
+        if (i > 0){
+            key << "-";
+        }
+        key << request.nodes[i];
+    }
+    return key.str();
+}
+
+int QoTCache::size() const{
+    std::lock_guard<std::mutex> lock(entriesMutex);
+    return (int)entries.size();
+}
+
+bool QoTCache::get(const QoTRequest &request, QoTResult &result){
+    std::string key = getKey(request);
+    std::lock_guard<std::mutex> lock(entriesMutex);
+    std::unordered_map<std::string, Entry>::const_iterator it = entries.find(key);
+    if (it == entries.end()){
+        nbMisses++;
+        return false;
+    }
+    nbHits++;
+    result.demandId = request.demandId;
+    result.feasible = it->second.feasible;
+    result.osnr = it->second.osnr;
+    result.margin = it->second.margin;
+    return true;
+}
+
+/****************************************************************************************/
+/*                                      Setters                                         */
+/****************************************************************************************/
+
+void QoTCache::set(const QoTRequest &request, const QoTResult &result){
+    std::string key = getKey(request);
+    Entry entry = {result.feasible, result.osnr, result.margin};
+    std::lock_guard<std::mutex> lock(entriesMutex);
+    entries[key] = entry;
+    if (file.is_open()){
+        file << "E " << entry.feasible << " " << std::setprecision(std::numeric_limits<double>::max_digits10) << entry.osnr << " " << entry.margin << " " << key << "\n";
+        file.flush();
+    }
+}
+
+/****************************************************************************************/
+/*                                       Files                                          */
+/****************************************************************************************/
+
+/* The first line is "S signature"; each other line is an entry "E feasible osnr margin key". */
+void QoTCache::open(const std::string &fileName, const std::string &signature){
+    std::lock_guard<std::mutex> lock(entriesMutex);
+    bool sameSignature = false;
+    std::ifstream input(fileName.c_str());
+    if (input.is_open()){
+        std::string line;
+        if (std::getline(input, line) && line == "S " + signature){
+            sameSignature = true;
+        }
+        while (sameSignature && std::getline(input, line)){
+            std::istringstream fields(line);
+            std::string type, osnr, margin, key;
+            Entry entry;
+            if (fields >> type >> entry.feasible >> osnr >> margin >> key && type == "E"){
+                entry.osnr = std::strtod(osnr.c_str(), NULL);
+                entry.margin = std::strtod(margin.c_str(), NULL);
+                entries[key] = entry;
+            }
+        }
+        input.close();
+    }
+    if (sameSignature){
+        file.open(fileName.c_str(), std::ios::app);
+    }
+    else{
+        file.open(fileName.c_str(), std::ios::trunc);
+        file << "S " << signature << "\n";
+        file.flush();
+    }
+    std::cout << "QoT cache: " << entries.size() << " lightpaths loaded from " << fileName << "." << std::endl;
+}
@@ -0,0 +1,73 @@
+#ifndef QOT_CACHE_H
+#define QOT_CACHE_H
+
+#include <mutex>
+#include <unordered_map>
+
+#include "AbstractQoTEvaluator.h"
+
+/***********************************************************************************************
+ * Cache of the QoT evaluations, shared by all callback threads and kept from one optimization
+ * to the next. A lightpath is identified by its node sequence and its transceiver settings
+ * (mode, spacing, path bandwidth): the same route is evaluated only once, whatever the demand
+ * or the candidate. If a file is opened, its entries are loaded and every new evaluation is
+ * appended to it, so that the cache is kept across executions. Entries of a file written with
+ * another evaluator, topology or equipment are discarded.
+ * ********************************************************************************************/
+class QoTCache{
+
+    private:
+        /** Outcome stored for a lightpath. **/
+        struct Entry {
+            bool feasible;
+            double osnr;
+            double margin;
+        };
+
+        std::unordered_map<std::string, Entry> entries;     /**< Evaluated lightpaths indexed by their key. **/
+        mutable std::mutex entriesMutex;                    /**< Protects the entries and the file. **/
+        std::ofstream file;                                 /**< File receiving the new entries (if opened). **/
+        int nbHits;                                         /**< Number of lookups answered by the cache. **/
+        int nbMisses;                                       /**< Number of lookups sent to the evaluator. **/
+
+    public:
+        /************************************************/
+        /*                 Constructors                 */
+        /************************************************/
+        QoTCache():nbHits(0),nbMisses(0){}
+
+        /************************************************/
+        /*                    Getters                   */
+        /************************************************/
+
+        /** Returns the key of a lightpath. **/
+        static std::string getKey(const QoTRequest &request);
+
+        int size() const;
+        int getNbHits() const { std::lock_guard<std::mutex> lock(entriesMutex); return nbHits; }
+        int getNbMisses() const { std::lock_guard<std::mutex> lock(entriesMutex); return nbMisses; }
+
+        /** Returns true if the new entries are written to a file. **/
+        bool isOpen() const { return file.is_open(); }
+
+        /** Looks for the outcome of a lightpath. Returns false if it has not been evaluated. **/
+        bool get(const QoTRequest &request, QoTResult &result);
+
+        /************************************************/
+        /*                    Setters                   */
+        /************************************************/
+
+        /** Stores the outcome of a lightpath (and appends it to the file, if opened). **/
+        void set(const QoTRequest &request, const QoTResult &result);
+
+        /************************************************/
+        /*                     Files                    */
+        /************************************************/
+
+        /** Loads the entries of a file and appends the next ones to it. @param fileName The file. @param signature Identifies the evaluator, topology and equipment producing the entries. **/
+        void open(const std::string &fileName, const std::string &signature);
+
+        ~QoTCache(){}
+};
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef QOT_EVALUATOR_FACTORY_H
+#define QOT_EVALUATOR_FACTORY_H
+
+// include all concrete evaluators
+#include "gnpyCommandEvaluator.h"
+#include "gnpyWorkerEvaluator.h"
+#include "gnModelEvaluator.h"
+
+class qotEvaluatorFactory{
+    public:
+        inline AbstractQoTEvaluator* createEvaluator(const Input &input){
+            Input::QoTEvaluator chosenEvaluator = input.getGNPYEvaluator();
+            switch (chosenEvaluator){
+                case Input::QOT_EVALUATOR_GNPY_COMMAND:{
+                    return new gnpyCommandEvaluator(input);
+                    break;
+                }
+                case Input::QOT_EVALUATOR_GNPY_WORKER:{
+                    return new gnpyWorkerEvaluator(input);
+                    break;
+                }
+                case Input::QOT_EVALUATOR_GN_MODEL:{
+                    return new gnModelEvaluator(input);
+                    break;
+                }
+                default:{
+                    std::cout << "ERROR: Invalid QoT evaluator." << std::endl;
+                    exit(0);
+                    break;
+                }
+            }
+            return NULL;
+        }
+};
+
+#endif
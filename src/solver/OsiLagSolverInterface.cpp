@@ -10,6 +10,9 @@
 
 #include "OsiLagSolverInterface.h"
 
+int OsiLagSolverInterface::nbCopies_ = 0;
+double OsiLagSolverInterface::copyTime_ = 0.0;
+int OsiLagSolverInterface::nbSolversBuilt_ = 0;
 
 
 /**************************************************************************************************/
@@ -82,6 +85,11 @@ void OsiLagSolverInterface::gutsOfDestructor_(){
     delete[] feasibleSolution_; feasibleSolution_=0;  
     delete[] rowprice_;	        rowprice_ = 0;
     delete[] rowpriceHotStart_;	rowpriceHotStart_ = 0;
+    delete[] colsolHotStart_;	colsolHotStart_ = 0;
+    delete[] rcHotStart_;	rcHotStart_ = 0;
+    delete[] lhsHotStart_;	lhsHotStart_ = 0;
+    formulationHotStart_ = AbstractLagFormulation::HotStartState();
+    nodeState_ = AbstractLagFormulation::HotStartState();
     delete[] rc_;       	        rc_ = 0;
     delete[] lhs_;       	        lhs_ = 0;
 
@@ -239,24 +247,64 @@ CoinWarmStart *OsiLagSolverInterface::getPointerToWarmStart(bool &mustDelete){
 
 void OsiLagSolverInterface::markHotStart(){
     std::cout << "OsiLagSolverInterface: Mark hot start. " << std::endl;
+    const int dsize = getNumRows();
+    const int psize = getNumCols();
     delete[] rowpriceHotStart_;
-    rowpriceHotStart_ = new double[getNumRows()];
-    CoinDisjointCopyN(rowprice_, getNumRows(), rowpriceHotStart_);
-}
-
+    delete[] colsolHotStart_;
+    delete[] rcHotStart_;
+    delete[] lhsHotStart_;
+    rowpriceHotStart_ = new double[dsize];
+    colsolHotStart_ = new double[psize];
+    rcHotStart_ = new double[psize];
+    lhsHotStart_ = new double[dsize];
+    CoinDisjointCopyN(rowprice_, dsize, rowpriceHotStart_);
+    CoinDisjointCopyN(colsol_, psize, colsolHotStart_);
+    CoinDisjointCopyN(rc_, psize, rcHotStart_);
+    CoinDisjointCopyN(lhs_, dsize, lhsHotStart_);
+    lagrangeanCostHotStart_ = lagrangeanCost_;
+    formulationHotStart_ = nodeState_;
+}
+
+/* Each candidate starts from the marked multipliers, stability center and primal approximation, and runs at most 
+OsiMaxNumIterationHotStart iterations (never more than a regular resolve). */
 void OsiLagSolverInterface::solveFromHotStart(){
     std::cout << "OsiLagSolverInterface: Solving from hotstart. " << std::endl;
-    int itlimOrig = lagrangianSolver->getNbMaxIterations();
-    getIntParam(OsiMaxNumIterationHotStart, lagrangianSolver->getNbMaxIterations());
+    const int itlimOrig = maxNbIterations_;
+    int itlimHotStart = itlimOrig;
+    getIntParam(OsiMaxNumIterationHotStart, itlimHotStart);
+    maxNbIterations_ = std::min(itlimOrig, std::max(1, itlimHotStart));
+
+    nodeState_ = formulationHotStart_;
     CoinDisjointCopyN(rowpriceHotStart_, getNumRows(), rowprice_);
+
+    lagrangianSolver->setHotStart(true);
     resolve();
-    lagrangianSolver->setNbMaxIterations(itlimOrig);
+    lagrangianSolver->setHotStart(false);
+    maxNbIterations_ = itlimOrig;
 }
 
+/* Puts back the state of the marked node, so that the candidates leave no trace in the solver. */
 void OsiLagSolverInterface::unmarkHotStart(){
     std::cout << "OsiLagSolverInterface: Unmark hot start." << std::endl;
-  delete[] rowpriceHotStart_;
-  rowpriceHotStart_ = NULL;
+    if(rowpriceHotStart_ != NULL){
+        const int dsize = getNumRows();
+        const int psize = getNumCols();
+        CoinDisjointCopyN(rowpriceHotStart_, dsize, rowprice_);
+        CoinDisjointCopyN(colsolHotStart_, psize, colsol_);
+        CoinDisjointCopyN(rcHotStart_, psize, rc_);
+        CoinDisjointCopyN(lhsHotStart_, dsize, lhs_);
+        lagrangeanCost_ = lagrangeanCostHotStart_;
+        nodeState_ = formulationHotStart_;
+    }
+    delete[] rowpriceHotStart_;
+    delete[] colsolHotStart_;
+    delete[] rcHotStart_;
+    delete[] lhsHotStart_;
+    rowpriceHotStart_ = NULL;
+    colsolHotStart_ = NULL;
+    rcHotStart_ = NULL;
+    lhsHotStart_ = NULL;
+    formulationHotStart_ = AbstractLagFormulation::HotStartState();
 }
 
 /**************************************************************************************************/
@@ -1041,7 +1089,7 @@ bool OsiLagSolverInterface::setIntParam(OsiIntParam key, int value){
         case OsiMaxNumIteration:
             if (value < 0)
                 return false;
-            lagrangianSolver->setNbMaxIterations(value);
+            maxNbIterations_ = value;
             break;
         case OsiMaxNumIterationHotStart:
             if (value < 0)
@@ -1061,7 +1109,7 @@ bool OsiLagSolverInterface::setIntParam(OsiIntParam key, int value){
 bool OsiLagSolverInterface::setDblParam(OsiDblParam key, double value){
     switch (key) {
         case OsiDualObjectiveLimit:
-            lagrangianSolver->setDualLimit(value);
+            dualLimit_ = value;
             break;
         case OsiPrimalObjectiveLimit: // not applicable
             return false;
@@ -1070,7 +1118,7 @@ bool OsiLagSolverInterface::setDblParam(OsiDblParam key, double value){
         case OsiPrimalTolerance:
             if (value < 1e-04 || value > 1e-1)
                 return false;
-            lagrangianSolver->setPrimalAbsPrecision(value);
+            primalAbsPrecision_ = value;
             break;
         case OsiObjOffset: 
             return OsiSolverInterface::setDblParam(key, value);
@@ -1105,7 +1153,7 @@ bool OsiLagSolverInterface::setStrParam(OsiStrParam key, const std::string & val
 bool OsiLagSolverInterface::getIntParam(OsiIntParam key, int& value) const{
     switch (key) {
         case OsiMaxNumIteration:
-            value = lagrangianSolver->getNbMaxIterations();
+            value = maxNbIterations_;
             break;
         case OsiMaxNumIterationHotStart:
             OsiSolverInterface::getIntParam(key, value);
@@ -1124,7 +1172,7 @@ bool OsiLagSolverInterface::getDblParam(OsiDblParam key, double& value) const{
     switch (key) {
         case OsiDualObjectiveLimit:
             //value = lagrangianSolver->getUBInit();
-            value = lagrangianSolver->getDualLimit();
+            value = dualLimit_;
             break;
         case OsiPrimalObjectiveLimit: // not applicable
             return false;
@@ -1132,7 +1180,7 @@ bool OsiLagSolverInterface::getDblParam(OsiDblParam key, double& value) const{
             value = 1e-50;
             break;
         case OsiPrimalTolerance:
-            value = lagrangianSolver->getPrimalAbsPrecision();
+            value = primalAbsPrecision_;
             break;
         case OsiObjOffset:
             OsiSolverInterface::getDblParam(key, value);
@@ -1173,16 +1221,16 @@ bool OsiLagSolverInterface::isAbandoned() const{
 }
 
 bool OsiLagSolverInterface::isProvenOptimal() const{
-    return (!isDualObjectiveLimitReached() && lagrangianSolver->getStatus()==AbstractLagSolver::STATUS_OPTIMAL);
+    return (!isDualObjectiveLimitReached() && lagrangianStatus_==AbstractLagSolver::STATUS_OPTIMAL);
 }
 
 bool OsiLagSolverInterface::isProvenPrimalInfeasible() const{
-    return (lagrangianSolver->getStatus()==AbstractLagSolver::STATUS_INFEASIBLE);
+    return (lagrangianStatus_==AbstractLagSolver::STATUS_INFEASIBLE);
 }
 
 bool OsiLagSolverInterface::isProvenDualInfeasible() const{
     // LL: *FIXME* : at the moment the volume assumes dual feasibility...
-    return (lagrangianSolver->getStatus()==AbstractLagSolver::STATUS_INFEASIBLE && lagrangianSolver->getDualInf());
+    return (lagrangianStatus_==AbstractLagSolver::STATUS_INFEASIBLE && dualInf_);
     return false;
 }
 
@@ -1193,11 +1241,11 @@ bool OsiLagSolverInterface::isPrimalObjectiveLimitReached() const{
 }
 
 bool OsiLagSolverInterface::isDualObjectiveLimitReached() const{
-    return (lagrangianSolver->getLB()  >= lagrangianSolver->getDualLimit() - DBL_EPSILON);
+    return (lagrangianLB_  >= dualLimit_ - DBL_EPSILON);
 }
 
 bool OsiLagSolverInterface::isIterationLimitReached() const{
-    return (lagrangianSolver->getStatus()==AbstractLagSolver::STATUS_MAX_IT);
+    return (lagrangianStatus_==AbstractLagSolver::STATUS_MAX_IT);
 }
 
 void OsiLagSolverInterface::initialSolve(){
@@ -1206,7 +1254,21 @@ void OsiLagSolverInterface::initialSolve(){
     std::cout << "OsiLagSolverInterface: Initial Solve." << std::endl;
     CoinFillN(rowprice_, getNumRows(), 0.0);
 
+    /* Starts from the multipliers of the previous solves, if any. */
+    AbstractLagFormulation *formulation = lagrangianSolver->getLagrangianFormulation();
+    if (multiplierStore != NULL && !multiplierStore->empty()){
+        formulation->loadMultipliers(*multiplierStore);
+        formulation->getDualSolution(rowprice_);
+    }
+
     resolve();
+
+    /* The root dual shows how fast the Lagrangian method converges: its bounds are kept by the telemetry. */
+    Telemetry::recordRootBounds(lagrangianSolver->getBoundTrace());
+
+    if (multiplierStore != NULL){
+        formulation->storeMultipliers(*multiplierStore);
+    }
     
     //int i;
     
@@ -1274,6 +1336,14 @@ void OsiLagSolverInterface::resolve(){
         std::transform(objcoeffs_, objcoeffs_+psize, objcoeffs_,std::negate<double>());
     }
 
+    /* The solver is shared by the copies of the interface: it gets the parameters of this one. */
+    lagrangianSolver->setNbMaxIterations(maxNbIterations_);
+    lagrangianSolver->setDualLimit(dualLimit_);
+    lagrangianSolver->setPrimalAbsPrecision(primalAbsPrecision_);
+
+    /* Puts back the state left by the last solve of this interface, whichever copy used the solver since. */
+    lagrangianSolver->getLagrangianFormulation()->restoreHotStart(nodeState_);
+
     /* Set the dual starting point */ /* it is missing to multiply by objsense_ */
     lagrangianSolver->getLagrangianFormulation()->startMultipliers(rowprice_,dsize,objsense_);
 
@@ -1294,6 +1364,11 @@ void OsiLagSolverInterface::extractSolution(){
 
     /* the lower bound on the objective value */
     lagrangeanCost_ = objsense_ * lagrangianSolver->getLB();
+    lagrangianStatus_ = lagrangianSolver->getStatus();
+    lagrangianLB_ = lagrangianSolver->getLB();
+    dualInf_ = lagrangianSolver->getDualInf();
+    iterationCount_ = lagrangianSolver->getIteration();
+    lagrangianSolver->getLagrangianFormulation()->saveHotStart(nodeState_);
 
     /* the primal solution. */
     lagrangianSolver->getSolution(colsol_);
@@ -1345,11 +1420,18 @@ OsiLagSolverInterface::OsiLagSolverInterface(const Instance &instance): OsiSolve
                                             rowMatrixCurrent_(true), rowMatrix_(), colMatrixCurrent_(true),colMatrix_(),
                                             colupper_(0),collower_(0),continuous_(0),rowupper_(0),rowlower_(0),rowsense_(0),
                                             rhs_(0),rowrange_(0),objcoeffs_(0),objsense_(1.0),colsol_(0),rowprice_(0),rc_(0),
-                                            lhs_(0),lagrangeanCost_(0.0),rowpriceHotStart_(0),maxNumrows_(0),maxNumcols_(0),
-                                            cbcModel(NULL),feasibleSolution_(0),feasibleSolutionValue_(OsiLagInfinity){
+                                            lhs_(0),lagrangeanCost_(0.0),rowpriceHotStart_(0),colsolHotStart_(0),rcHotStart_(0),
+                                            lhsHotStart_(0),lagrangeanCostHotStart_(0.0),maxNumrows_(0),maxNumcols_(0),
+                                            cbcModel(NULL),feasibleSolution_(0),feasibleSolutionValue_(OsiLagInfinity),
+                                            maxNbIterations_(0),dualLimit_(__DBL_MAX__/2),primalAbsPrecision_(0.0001),
+                                            lagrangianStatus_(AbstractLagSolver::STATUS_UNKNOWN),lagrangianLB_(-__DBL_MAX__),dualInf_(false),iterationCount_(0){
     std::cout << "OsiLagSolverInterface: default constructor." <<std::endl;
     lagSolverFactory factory;
-    lagrangianSolver = factory.createSolver(instance);
+    lagrangianSolver = std::shared_ptr<AbstractLagSolver>(factory.createSolver(instance));
+    nbSolversBuilt_++;
+    maxNbIterations_ = lagrangianSolver->getNbMaxIterations();
+    dualLimit_ = lagrangianSolver->getDualLimit();
+    primalAbsPrecision_ = lagrangianSolver->getPrimalAbsPrecision();
     num = 0; 
 }
 
@@ -1357,13 +1439,13 @@ OsiLagSolverInterface::OsiLagSolverInterface(const OsiLagSolverInterface& x) : O
                                             rowMatrixCurrent_(true),rowMatrix_(),colMatrixCurrent_(true),colMatrix_(),
                                             colupper_(0),collower_(0),continuous_(0),rowupper_(0),rowlower_(0),rowsense_(0),
                                             rhs_(0),rowrange_(0),objcoeffs_(0),objsense_(1.0),colsol_(0),rowprice_(0),rc_(0),
-                                            lhs_(0),lagrangeanCost_(0.0),rowpriceHotStart_(0),maxNumrows_(0),maxNumcols_(0),
-                                            cbcModel(NULL),feasibleSolution_(0),feasibleSolutionValue_(OsiLagInfinity){
+                                            lhs_(0),lagrangeanCost_(0.0),rowpriceHotStart_(0),colsolHotStart_(0),rcHotStart_(0),
+                                            lhsHotStart_(0),lagrangeanCostHotStart_(0.0),maxNumrows_(0),maxNumcols_(0),
+                                            cbcModel(NULL),feasibleSolution_(0),feasibleSolutionValue_(OsiLagInfinity),
+                                            maxNbIterations_(0),dualLimit_(__DBL_MAX__/2),primalAbsPrecision_(0.0001),
+                                            lagrangianStatus_(AbstractLagSolver::STATUS_UNKNOWN),lagrangianLB_(-__DBL_MAX__),dualInf_(false),iterationCount_(0){
     std::cout << "OsiLagSolverInterface: copy constructor." <<std::endl;
     operator=(x);
-    //lagSolverFactory factory;
-    //Instance instance(x.lagrangianSolver->getLagrangianFormulation()->getInstance());
-    //lagrangianSolver = factory.createSolver(instance);
 }
 
 OsiLagSolverInterface& OsiLagSolverInterface::operator=(const OsiLagSolverInterface& rhs){
@@ -1371,6 +1453,7 @@ OsiLagSolverInterface& OsiLagSolverInterface::operator=(const OsiLagSolverInterf
     if (&rhs == this)
         return *this;
 
+    ClockTime copyTime(ClockTime::getTimeNow());
     OsiSolverInterface::operator=(rhs);
     gutsOfDestructor_();
 
@@ -1406,10 +1489,22 @@ OsiLagSolverInterface& OsiLagSolverInterface::operator=(const OsiLagSolverInterf
     }
     num = rhs.num;
     cbcModel = rhs.cbcModel;
-    lagSolverFactory factory;
-    Instance instance(rhs.lagrangianSolver->getLagrangianFormulation()->getInstance());
-    lagrangianSolver = factory.createSolver(instance);
-
+    multiplierStore = rhs.multiplierStore;
+
+    /* Only the node dependent data above is copied; the lagrangian solver is shared. */
+    lagrangianSolver = rhs.lagrangianSolver;
+    maxNbIterations_ = rhs.maxNbIterations_;
+    dualLimit_ = rhs.dualLimit_;
+    primalAbsPrecision_ = rhs.primalAbsPrecision_;
+    lagrangianStatus_ = rhs.lagrangianStatus_;
+    lagrangianLB_ = rhs.lagrangianLB_;
+    dualInf_ = rhs.dualInf_;
+    iterationCount_ = rhs.iterationCount_;
+    lagrangeanCost_ = rhs.lagrangeanCost_;
+    nodeState_ = rhs.nodeState_;
+
+    nbCopies_++;
+    copyTime_ += copyTime.getTimeInSecFromStart();
     return *this;
 }
 
@@ -1509,5 +1604,4 @@ void OsiLagSolverInterface::setObjective(const ObjectiveFunction &myObjective){
 
 OsiLagSolverInterface::~OsiLagSolverInterface(){
     gutsOfDestructor_();
-    delete lagrangianSolver;
 }
\ No newline at end of file
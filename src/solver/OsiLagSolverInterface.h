@@ -110,12 +110,46 @@ class OsiLagSolverInterface : virtual public OsiSolverInterface{
 
         /* An array to store the hotstart information between solveHotStart() calls */
         double  *rowpriceHotStart_;
+        /* The primal solution, reduced costs, row activities and Lagrangean cost at the hotstart. */
+        double  *colsolHotStart_;
+        double  *rcHotStart_;
+        double  *lhsHotStart_;
+        double   lagrangeanCostHotStart_;
+        /* The multipliers, stability center and primal approximation of the formulation at the hotstart. */
+        AbstractLagFormulation::HotStartState formulationHotStart_;
 
         /**************************************************************************************************/
         /*                                     The lagrangian solver        	    		              */			      
         /**************************************************************************************************/
 
-        AbstractLagSolver* lagrangianSolver;
+        /* The lagrangian solver is shared by the copies of the interface: graphs and formulation structure are 
+        built once and only read by the copies. Everything that depends on the node (arc bounds, multipliers, 
+        stability center, primal approximation, solution buffers, parameters and status of the last solve) is kept 
+        in the interface and given to the solver at each resolve. */
+        std::shared_ptr<AbstractLagSolver> lagrangianSolver;
+
+        /* The multipliers, stability center and primal approximation of the formulation after the last solve of 
+        this interface. They are put back in the shared formulation before each resolve. */
+        AbstractLagFormulation::HotStartState nodeState_;
+
+        /* Parameters given to the lagrangian solver at each resolve. */
+        int     maxNbIterations_;
+        double  dualLimit_;
+        double  primalAbsPrecision_;
+
+        /* Outcome of the last solve of this interface. */
+        AbstractLagSolver::Status lagrangianStatus_;
+        double  lagrangianLB_;
+        bool    dualInf_;
+        int     iterationCount_;
+
+        /* Number of copies of the interface, time spent copying and number of lagrangian solvers built. */
+        static int    nbCopies_;
+        static double copyTime_;
+        static int    nbSolversBuilt_;
+
+        /* Multipliers kept from previous solves, shared by the copies of the interface (NULL if not used). */
+        std::shared_ptr<MultiplierStore> multiplierStore;
 
         /**************************************************************************************************/
         /*                                          The CBC model             	    		              */			      
@@ -362,7 +396,7 @@ class OsiLagSolverInterface : virtual public OsiSolverInterface{
   
         /** Get how many iterations it took to solve the problem (whatever
          "iteration" mean to the solver. */
-        virtual int getIterationCount() const { return lagrangianSolver->getIteration(); }
+        virtual int getIterationCount() const { return iterationCount_; }
   
         /** Get as many dual rays as the solver can provide. (In case of proven
              primal infeasibility there should be at least one.)
@@ -575,12 +609,21 @@ class OsiLagSolverInterface : virtual public OsiSolverInterface{
         //---------------------------------------------------------------------------
 
         /*Get pointer to lagrangian solver */
-        AbstractLagSolver* const getLagrangianSolver() const { return lagrangianSolver;}
+        AbstractLagSolver* const getLagrangianSolver() const { return lagrangianSolver.get();}
+
+        static int getNbCopies() { return nbCopies_;}
+        static double getCopyTime() { return copyTime_;}
+        static int getNbSolversBuilt() { return nbSolversBuilt_;}
 
         void setCbcModel(CbcModel* cbc) { cbcModel = cbc;}
 
         CbcModel* const getCbcModel() const { return cbcModel;}
 
+        /* Sets the store giving the initial multipliers of the root node, updated with its final multipliers. */
+        void setMultiplierStore(std::shared_ptr<MultiplierStore> store) { multiplierStore = store;}
+
+        std::shared_ptr<MultiplierStore> getMultiplierStore() const { return multiplierStore;}
+
         /**************************************************************************************************/
         /*                                  CONSTRUCTORS AND COPY                                         */			      
         /**************************************************************************************************/
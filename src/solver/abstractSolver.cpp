@@ -1,4 +1,5 @@
 #include "abstractSolver.h"
+#include "../lagrangian/solver/lagArcFixing.h"
 
 
 /****************************************************************************************/
@@ -16,7 +17,38 @@ AbstractSolver::AbstractSolver(const Instance &instance, const Status &s) : curr
 	rootValue = -1;
 
     FormulationFactory factory;
-    formulation = factory.createFormulation(instance);
+    if (instance.getInput().getChosenFixingMethod() != Input::FIXING_NONE && instance.getInput().getChosenNodeMethod() == Input::NODE_METHOD_LINEAR_RELAX){
+        /* The MIP is built on a copy of the instance where the arcs discarded by the Lagrangian bounds are fixed. */
+        Instance fixedInstance(instance);
+        lagArcFixing fixing(fixedInstance);
+        fixing.run();
+        formulation = factory.createFormulation(fixedInstance);
+    }
+    else{
+        formulation = factory.createFormulation(instance);
+    }
+}
+
+/* Constructor of the solvers that do not solve a formulation. */
+AbstractSolver::AbstractSolver(const Status &s) : formulation(NULL), currentStatus(s) {
+
+	time = -1;
+	upperBound = -1;
+	lowerBound = -1;
+	gap = -1;
+	treeSize = -1;
+	rootValue = -1;
+
+	totalChargeTime = 0.0;
+	varChargeTime = 0.0;
+	constChargeTime = 0.0;
+	objChargeTime = 0.0;
+
+	totalImpleTime = 0.0;
+	varImpleTime = 0.0;
+	constImpleTime = 0.0;
+	cutImpleTime = 0.0;
+	objImpleTime = 0.0;
 }
 
 void AbstractSolver::updateRSA(Instance &instance){
@@ -56,6 +56,12 @@ public:
 	/** Constructor. The RSA constructor is called and the arc map storing the index of the preprocessed graphs associated is built. @param inst The instance to be solved. **/
     AbstractSolver(const Instance &instance, const Status &s = STATUS_UNKNOWN);
 
+protected:
+	/** Constructor of the solvers that do not solve a formulation (the formulation is NULL). @param s The initial status. **/
+	AbstractSolver(const Status &s);
+
+public:
+
 	/****************************************************************************************/
 	/*											Getters										*/
 	/****************************************************************************************/
@@ -101,10 +107,13 @@ public:
 	
 	virtual void implementFormulation() = 0;
 
-	void updateRSA(Instance &instance);
+	virtual void updateRSA(Instance &instance);
 
 	virtual std::vector<double> getSolution() = 0;
 
+	/** Limits the number of threads used by the optimization. Solvers running on a single thread ignore it. @param nbThreads The number of threads. **/
+	virtual void setNbThreads(int nbThreads){}
+
 	/* Builds file results.csv containing information about the main obtained results. */
 	virtual void outputLogResults(std::string fileName){}
 
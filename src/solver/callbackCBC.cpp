@@ -0,0 +1,34 @@
+#include "callbackCBC.h"
+
+#include "CoinPackedVector.hpp"
+
+CBCCallback::CBCCallback(AbstractFormulation *_formulation): CglCutGenerator(), formulation(_formulation){}
+
+CglCutGenerator * CBCCallback::clone() const{
+    return new CBCCallback(*this);
+}
+
+void CBCCallback::generateCuts(const OsiSolverInterface &si, OsiCuts &cs, const CglTreeInfo info){
+    Telemetry::count(Telemetry::COUNTER_CALLBACKS);
+    std::vector<double> solution(si.getColSolution(), si.getColSolution() + si.getNumCols());
+    std::vector<Constraint> constraint = formulation->solveSeparationProblemInt(solution, 0);
+    if (!constraint.empty()){
+        Telemetry::count(Telemetry::COUNTER_CUTS, constraint.size());
+        for (unsigned int i = 0; i < constraint.size(); i++){
+            CoinPackedVector row;
+            const Expression &expression = constraint[i].getExpression();
+            for (int j = 0; j < expression.getNbTerms(); j++){
+                row.insert(expression.getTerm_i(j).getVar().getId(), expression.getTerm_i(j).getCoeff());
+            }
+            OsiRowCut cut;
+            cut.setRow(row);
+            cut.setLb(constraint[i].getLb());
+            cut.setUb(constraint[i].getUb());
+            cut.setGloballyValid(true);
+            cs.insert(cut);
+        }
+    }
+}
+
+// Destructor
+CBCCallback::~CBCCallback(){}
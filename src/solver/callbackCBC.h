@@ -0,0 +1,34 @@
+#ifndef __callbackCBC__h
+#define __callbackCBC__h
+
+#include "abstractSolver.h"
+#include "CglCutGenerator.hpp"
+#include "OsiCuts.hpp"
+#include "OsiRowCut.hpp"
+#include "OsiSolverInterface.hpp"
+
+/************************************************************************************
+ * This is the CBC counterpart of the lazy constraints of CplexCallback. It is a cut
+ * generator called by CBC at the nodes and on every solution found: the constraints
+ * of the formulation violated by the point (see solveSeparationProblemInt) are
+ * returned as globally valid cuts, so a solution violating them is rejected.
+ ************************************************************************************/
+class CBCCallback: public CglCutGenerator {
+private:
+	AbstractFormulation *formulation;
+
+public:
+	// Constructor with data.
+	CBCCallback(AbstractFormulation *_formulation);
+
+	/** Returns a copy of the generator, as CBC keeps its own copy. **/
+	virtual CglCutGenerator * clone() const;
+
+	/** Adds the constraints violated by the current point of the solver. **/
+	virtual void generateCuts(const OsiSolverInterface &si, OsiCuts &cs, const CglTreeInfo info = CglTreeInfo());
+
+    // Destructor
+    virtual ~CBCCallback();
+};
+
+#endif
@@ -6,6 +6,7 @@ CplexCallback::CplexCallback(const IloNumVarArray _var, AbstractFormulation* &_f
 }
 
 void CplexCallback::invoke (const IloCplex::Callback::Context &context){
+    Telemetry::count(Telemetry::COUNTER_CALLBACKS);
     if ( context.inRelaxation() ){
         if (isObj8()){
             //fixVariables(context);
@@ -15,7 +16,7 @@ void CplexCallback::invoke (const IloCplex::Callback::Context &context){
         }
     }
     if ( context.inCandidate()){
-        if (input.getChosenFormulation() == Input::FORMULATION_EDGE_NODE){
+        if (input.getChosenFormulation() == Input::FORMULATION_EDGE_NODE || input.isNonOverlapLazy()){
             addLazyConstraints(context);
         }
         if (input.isGNPYEnabled()){
@@ -33,14 +34,18 @@ void CplexCallback::addGnpyConstraints(const IloCplex::Callback::Context &contex
     try {
         
         int const threadNo = context.getIntInfo(IloCplex::Callback::Context::Info::ThreadId);
+        Telemetry::Span qotSpan("qot");
         std::vector<Constraint> constraint = formulation->solveSeparationGnpy(getIntegerSolution(context), threadNo);
+        qotSpan.stop();
         if (!constraint.empty()){
+            Telemetry::count(Telemetry::COUNTER_CUTS, constraint.size());
             //std::cout << "A lazy constraint was found:";
             for (unsigned int i = 0; i < constraint.size(); i++){
                 //constraint.display();
                 IloRange cut(context.getEnv(), constraint[i].getLb(), to_IloExpr(context, constraint[i].getExpression()), constraint[i].getUb());
                 //std::cout << "CPLEX add lazy: " << cut << std::endl;
                 context.rejectCandidate(cut);
+                record(constraint[i], lazyPool);
             }
         }
     }
@@ -55,6 +60,7 @@ void CplexCallback::addUserCuts(const IloCplex::Callback::Context &context) cons
     try {
         std::vector<Constraint> constraint = formulation->solveSeparationProblemFract(getFractionalSolution(context));
         if (!constraint.empty()){
+            Telemetry::count(Telemetry::COUNTER_CUTS, constraint.size());
             //std::cout << "A violated cut was found: ";
             for (unsigned int i = 0; i < constraint.size(); i++){
                 //std::cout << "Adding user cut..." << std::endl;
@@ -62,6 +68,7 @@ void CplexCallback::addUserCuts(const IloCplex::Callback::Context &context) cons
                                         to_IloExpr(context, constraint[i].getExpression()),
                                         constraint[i].getUb(), constraint[i].getName().c_str()),
                                     IloCplex::UseCutForce, IloFalse);
+                record(constraint[i], userCutPool);
             }
         }
     }
@@ -80,12 +87,14 @@ void CplexCallback::addLazyConstraints(const IloCplex::Callback::Context &contex
         int const threadNo = context.getIntInfo(IloCplex::Callback::Context::Info::ThreadId);
         std::vector<Constraint> constraint = formulation->solveSeparationProblemInt(getIntegerSolution(context), threadNo);
         if (!constraint.empty()){
+            Telemetry::count(Telemetry::COUNTER_CUTS, constraint.size());
             //std::cout << "A lazy constraint was found:";
             for (unsigned int i = 0; i < constraint.size(); i++){
                 //constraint.display();
                 IloRange cut(context.getEnv(), constraint[i].getLb(), to_IloExpr(context, constraint[i].getExpression()), constraint[i].getUb());
                 //std::cout << "CPLEX add lazy: " << cut << std::endl;
                 context.rejectCandidate(cut);
+                record(constraint[i], lazyPool);
             }
         }
         else{
@@ -97,6 +106,14 @@ void CplexCallback::addLazyConstraints(const IloCplex::Callback::Context &contex
     }
 }
 
+/* Constraints of the formulation pool are separated again and again under the same name, so named constraints are recorded once. */
+void CplexCallback::record(const Constraint &constraint, std::vector<Constraint> &pool) const{
+    std::lock_guard<std::mutex> lock(poolMutex);
+    if (!constraint.getName().empty() && !recordedNames.insert(constraint.getName()).second){
+        return;
+    }
+    pool.push_back(constraint);
+}
 
 void CplexCallback::fixVariables(const IloCplex::Callback::Context &context){
     //std::cout << "Callback fixing..." << std::endl;
@@ -2,10 +2,14 @@
 #define __callbackCplex__h
 
 #include <ilcplex/ilocplex.h>
+#include <mutex>
+#include <set>
 #include "abstractSolver.h"
 /************************************************************************************
  * This is the class implementing the generic callback interface. It has two main 
  * functions: addUserCuts and addLazyConstraints.												
+ * The cuts and lazy constraints it adds are recorded, so that they can be added to
+ * the model before optimizing the next objective of a lexicographic optimization.
  ************************************************************************************/
 class CplexCallback: public IloCplex::Callback::Function {
 private:
@@ -15,6 +19,14 @@ private:
 	double upperBound;
 	const bool obj8;
 
+	mutable std::mutex poolMutex;						/**< Protects the recorded constraints, as the callback is invoked by several threads. **/
+	mutable std::vector<Constraint> userCutPool;		/**< The user cuts added. **/
+	mutable std::vector<Constraint> lazyPool;			/**< The lazy constraints added. **/
+	mutable std::set<std::string> recordedNames;		/**< The names of the constraints recorded, to record each named constraint once. **/
+
+	/** Records a constraint added by the callback. @param constraint The constraint. @param pool The user cut or lazy constraint pool. **/
+	void record(const Constraint &constraint, std::vector<Constraint> &pool) const;
+
 public:
 	// Constructor with data.
 	CplexCallback(const IloNumVarArray _var, AbstractFormulation* &_formulation, const Input& _input, bool _obj8);
@@ -30,6 +42,12 @@ public:
 	double getUpperBound() const{ return upperBound; }
 	bool isObj8() const{ return obj8; }
 
+	/** Returns the user cuts added during optimization. **/
+	const std::vector<Constraint> & getUserCutPool() const{ return userCutPool; }
+
+	/** Returns the lazy constraints added during optimization. **/
+	const std::vector<Constraint> & getLazyPool() const{ return lazyPool; }
+
 	virtual void invoke (const IloCplex::Callback::Context &context);
 
 	std::vector<double> getIntegerSolution(const IloCplex::Callback::Context &context) const;
@@ -1,10 +1,17 @@
 #include "lagSolverCBC.h"
 #include "CbcHeuristicGreedy.hpp"
 int lagSolverCBC::count = 0;
+std::shared_ptr<MultiplierStore> lagSolverCBC::multiplierStore = std::make_shared<MultiplierStore>();
 
 /** Constructor. Builds the Online RSA mixed-integer program and solves it using CBC.**/
 lagSolverCBC::lagSolverCBC(const Instance &inst) : AbstractSolver(inst, STATUS_UNKNOWN), solver(inst){
     std::cout << "--- CBC has been initialized ---" << std::endl;
+    std::string multiplierStoreFile = inst.getInput().getMultiplierStoreFile();
+    if (count == 0 && !multiplierStoreFile.empty()){
+        multiplierStore->read(multiplierStoreFile);
+    }
+    /* Set before the model is built, since CBC works on copies of the solver interface. */
+    solver.setMultiplierStore(multiplierStore);
     implementFormulation();
     setCBCParams(inst.getInput());
     isrelaxed = inst.getInput().isRelaxed();
@@ -53,6 +60,13 @@ void lagSolverCBC::solve(){
     setLowerBound(model.getBestPossibleObjValue());
     setMipGap(model.getBestPossibleObjValue(), model.getObjValue());
 	setTreeSize(model.getNodeCount());
+    std::cout << "Solver copies: " << OsiLagSolverInterface::getNbCopies() << " in " << OsiLagSolverInterface::getCopyTime() << " secs, ";
+    std::cout << "Lagrangian solvers built: " << OsiLagSolverInterface::getNbSolversBuilt() << ", ";
+    std::cout << "tree size: " << model.getNodeCount() << " nodes." << std::endl;
+    std::string multiplierStoreFile = solver.getLagrangianSolver()->getLagrangianFormulation()->getInstance().getInput().getMultiplierStoreFile();
+    if (!multiplierStoreFile.empty()){
+        multiplierStore->write(multiplierStoreFile);
+    }
     std::cout << "Optimization done in " << std::fixed  << getDurationTime() << std::setprecision(2) << " secs." << std::endl;
     if (getStatus() == STATUS_OPTIMAL || getStatus() == STATUS_FEASIBLE){    
         //displaySolution();
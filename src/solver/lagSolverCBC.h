@@ -20,6 +20,7 @@ class lagSolverCBC : public AbstractSolver{
         OsiLagSolverInterface solver;	/**< The Lagrangian engine. **/
         CbcModel model;					/**< The CBC model. **/
         static int count;				/**< Counts how many times the solver is called. **/
+        static std::shared_ptr<MultiplierStore> multiplierStore;	/**< Lagrangian multipliers kept from one call to the next. **/
         bool isrelaxed;
 
     public:
@@ -0,0 +1,60 @@
+#include "lexicographicSchedule.h"
+
+#include <algorithm>
+#include <cmath>
+
+#define LEX_ABSOLUTE_TOLERANCE 1e-6
+
+/****************************************************************************************/
+/*										Constructor										*/
+/****************************************************************************************/
+
+/* Constructor. Starts measuring time. */
+LexicographicSchedule::LexicographicSchedule(const Input &input, int n) : time(ClockTime::getTimeNow()), nbStages(n){
+	timeLimit = input.getIterationTimeLimit();
+	policy = input.getChosenLexTimePolicy();
+	tolerance = input.getLexTolerance();
+}
+
+/****************************************************************************************/
+/*										Getters											*/
+/****************************************************************************************/
+
+/* The last objective always gets all the time left. */
+double LexicographicSchedule::getStageTimeLimit(int stage) const{
+	double timeLeft = std::max(0.0, timeLimit - time.getTimeInSecFromStart());
+	int nbStagesLeft = nbStages - stage;
+	if (nbStagesLeft <= 1){
+		return timeLeft;
+	}
+	switch (policy){
+		case Input::LEX_TIME_HALVING:
+			return timeLeft/2.0;
+		case Input::LEX_TIME_EQUAL:
+		default:
+			return timeLeft/nbStagesLeft;
+	}
+}
+
+/* The objective may not get worse than its value by more than the tolerance, with a small absolute tolerance for the objectives whose value is zero. */
+void LexicographicSchedule::getBoundRange(double value, ObjectiveFunction::Direction direction, double &lb, double &ub, double infinity) const{
+	double slack = std::max(LEX_ABSOLUTE_TOLERANCE, tolerance*std::fabs(value));
+	if (direction == ObjectiveFunction::DIRECTION_MAX){
+		lb = value - slack;
+		ub = infinity;
+	}
+	else{
+		lb = -infinity;
+		ub = value + slack;
+	}
+}
+
+/* Returns the value of an objective at a solution. */
+double LexicographicSchedule::evaluate(const ObjectiveFunction &objective, const std::vector<double> &solution){
+	double value = 0.0;
+	const Expression &expression = objective.getExpression();
+	for (int i = 0; i < expression.getNbTerms(); i++){
+		value += expression.getTerm_i(i).getCoeff()*solution[expression.getTerm_i(i).getVar().getId()];
+	}
+	return value;
+}
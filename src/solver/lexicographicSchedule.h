@@ -0,0 +1,48 @@
+#ifndef __lexicographicSchedule__h
+#define __lexicographicSchedule__h
+
+#include <vector>
+
+#include "../formulation/formulationComponents.h"
+#include "../tools/clockTime.h"
+
+/***********************************************************************************************
+* This class drives a lexicographic optimization, in which the objectives are optimized one
+* after the other. It shares the time limit of the iteration among the objectives according to
+* the chosen policy, the time left by an objective solved early going to the next ones. Once an
+* objective is optimized, the next ones are optimized among the solutions whose value is within
+* the chosen tolerance of the value found, instead of exactly equal to it, which keeps the
+* previous solution feasible under numerical noise so that it can be given as a starting solution.
+************************************************************************************************/
+class LexicographicSchedule {
+
+private:
+	ClockTime time;						/**< Measures the time spent since the first objective. **/
+	double timeLimit;					/**< The time limit of the iteration, in seconds. **/
+	int nbStages;						/**< Number of objectives. **/
+	Input::LexTimePolicy policy;		/**< How the time limit is shared among the objectives. **/
+	double tolerance;					/**< Relative tolerance on the value of an optimized objective. **/
+
+public:
+	/****************************************************************************************/
+	/*										Constructors									*/
+	/****************************************************************************************/
+
+	/** Constructor. Starts measuring time. @param input The input parameters. @param nbStages The number of objectives. **/
+	LexicographicSchedule(const Input &input, int nbStages);
+
+	/****************************************************************************************/
+	/*										Getters											*/
+	/****************************************************************************************/
+
+	/** Returns the time limit of an objective, in seconds, given the time spent so far. @param stage The index of the objective. **/
+	double getStageTimeLimit(int stage) const;
+
+	/** Returns the range to which an optimized objective is restricted for the next objectives. @param value The value found. @param direction The direction of the objective. @param lb The lower bound of the range. @param ub The upper bound of the range. @param infinity The infinity of the solver. **/
+	void getBoundRange(double value, ObjectiveFunction::Direction direction, double &lb, double &ub, double infinity) const;
+
+	/** Returns the value of an objective at a solution. @param objective The objective. @param solution The value of each variable. **/
+	static double evaluate(const ObjectiveFunction &objective, const std::vector<double> &solution);
+};
+
+#endif
@@ -13,6 +13,7 @@ SolverCBC::SolverCBC(const Instance &inst) : AbstractSolver(inst, STATUS_UNKNOWN
     std::cout << "--- CBC has been initialized ---" << std::endl;
     implementFormulation();
     setCBCParams(inst.getInput());
+    setLazyConstraints(inst.getInput());
     isrelaxed = inst.getInput().isRelaxed();
     count++;
 }
@@ -58,30 +59,39 @@ void SolverCBC::setCBCParams(const Input &input){
     std::cout << "CBC parameters have been defined..." << std::endl;
 }
 
+/* The generator is called on every solution found, and again as long as it finds violated constraints. CBC keeps a copy of it. */
+void SolverCBC::setLazyConstraints(const Input &input){
+    if (input.getChosenFormulation() != Input::FORMULATION_FLOW || !input.isNonOverlapLazy() || input.isRelaxed()){
+        return;
+    }
+    CBCCallback generator(formulation);
+    model.addCutGenerator(&generator, 1, "NonOverlap", true, true);
+    model.cutGenerator(model.numberCutGenerators() - 1)->setMustCallAgain(true);
+    std::cout << "CBC lazy constraints have been defined..." << std::endl;
+}
+
 void SolverCBC::implementFormulation(){
-    ClockTime time(ClockTime::getTimeNow());
-    ClockTime time2(ClockTime::getTimeNow());
+    Telemetry::Span chargeSpan("charge");
     // add variables.
-    setVariables(formulation->getVariables());
-    //std::cout << "Time: " << time.getTimeInSecFromStart() << std::endl;
-    varChargeTime =  time.getTimeInSecFromStart();
-    time.setStart(ClockTime::getTimeNow());
+    Telemetry::Span variablesSpan("variables");
+    std::vector<Variable> variables = formulation->getVariables();
+    setVariables(variables);
+    varChargeTime = variablesSpan.stop();
+    Telemetry::count(Telemetry::COUNTER_VARIABLES, variables.size());
     // add constraints.
+    Telemetry::Span constraintsSpan("constraints");
     setConstraints(formulation->getConstraints());
-    //std::cout << "Time: " << time.getTimeInSecFromStart() << std::endl;
-    constChargeTime = time.getTimeInSecFromStart();
-    time.setStart(ClockTime::getTimeNow());
+    constChargeTime = constraintsSpan.stop();
+    Telemetry::count(Telemetry::COUNTER_ROWS, formulation->getConstraints().size());
     // add the first objective function.
+    Telemetry::Span objectiveSpan("objective");
     setObjective(formulation->getObjFunction(0));
-    //std::cout << "Time: " << time.getTimeInSecFromStart() << std::endl;
-    objChargeTime = time.getTimeInSecFromStart();
-    time.setStart(ClockTime::getTimeNow());
+    objChargeTime = objectiveSpan.stop();
     //solver.writeLp("test");
     model = CbcModel(solver);
     // free formulation memory.
     formulation->clearConstraints();
-    //std::cout << "Time: " << time.getTimeInSecFromStart() << std::endl;
-    totalChargeTime = time2.getTimeInSecFromStart();
+    totalChargeTime = chargeSpan.stop();
 }
 
 void SolverCBC::setVariables(const std::vector<Variable> &myVars){
@@ -145,11 +155,14 @@ void SolverCBC::setObjective(const ObjectiveFunction &myObjective){
     std::cout << "CBC objective has been defined..." << std::endl;
 }
 
+/* The objectives are optimized one after the other on the Clp model, from which a new CBC model is built for each objective: each objective is given its share of the time limit and starts from the solution of the previous one, which stays feasible since the previous objective is only bounded within the tolerance of its value. */
 void SolverCBC::solve(){
     // Implement time limit and count it here.
 	ClockTime solveTime(ClockTime::getTimeNow());
     std::cout << "Solving with CBC..." << std::endl;
     std::vector<ObjectiveFunction> myObjectives = formulation->getObjectiveSet();
+    LexicographicSchedule schedule(formulation->getInstance().getInput(), myObjectives.size());
+    std::vector<double> incumbent;
     for (unsigned int i = 0; i < myObjectives.size(); i++){
         if (i >= 1){
             for (unsigned int j = 0; j < formulation->getVariables().size(); j++){
@@ -157,24 +170,34 @@ void SolverCBC::solve(){
                 solver.setObjCoeff(index, 0);
             }
             setObjective(myObjectives[i]);
+            if (!isrelaxed){
+                model = CbcModel(solver);
+                setCBCParams(formulation->getInstance().getInput());
+                setLazyConstraints(formulation->getInstance().getInput());
+            }
         }
+        double stageTimeLimit = schedule.getStageTimeLimit(i);
         std::cout << "Chosen objective: " << myObjectives[i].getName() << std::endl;
         if(isrelaxed){
+            solver.getModelPtr()->setMaximumSeconds(stageTimeLimit);
             solver.initialSolve(); // Using this method so the time limit is respected.
+            if (solver.isProvenOptimal() && i < myObjectives.size() - 1){
+                addObjectiveBound(myObjectives[i], solver.getObjValue(), schedule);
+            }
         }
         else{
+            model.setMaximumSeconds(stageTimeLimit);
+            dynamic_cast<OsiClpSolverInterface*>(model.solver())->getModelPtr()->setMaximumSeconds(stageTimeLimit);
+            if (!incumbent.empty()){
+                model.setBestSolution(incumbent.data(), incumbent.size(), LexicographicSchedule::evaluate(myObjectives[i], incumbent), true);
+            }
             model.branchAndBound();
             if (model.bestSolution() != NULL){
                 double objValue = model.getObjValue();
                 std::cout << "Objective Function Value: " << objValue << std::endl;
                 if (i < myObjectives.size() - 1){
-                    CoinPackedVector objectiveExpression;
-                    for (unsigned int j = 0; j < myObjectives[i].getExpression().getTerms().size(); j++){
-                        int index = myObjectives[i].getExpression().getTerm_i(j).getVar().getId();
-                        double coefficient = myObjectives[i].getExpression().getTerm_i(j).getCoeff();
-                        objectiveExpression.insert(index, coefficient);
-                    }
-                    model.solver()->addRow(objectiveExpression, objValue, objValue, myObjectives[i].getName());
+                    incumbent.assign(model.bestSolution(), model.bestSolution() + model.getNumCols());
+                    addObjectiveBound(myObjectives[i], objValue, schedule);
                 }
             }
             else{
@@ -211,6 +234,19 @@ void SolverCBC::solve(){
 
 }
 
+/* The row is added to the Clp model, from which the CBC model of the next objective is built. */
+void SolverCBC::addObjectiveBound(const ObjectiveFunction &objective, double value, const LexicographicSchedule &schedule){
+    CoinPackedVector objectiveExpression;
+    for (unsigned int j = 0; j < objective.getExpression().getTerms().size(); j++){
+        int index = objective.getExpression().getTerm_i(j).getVar().getId();
+        double coefficient = objective.getExpression().getTerm_i(j).getCoeff();
+        objectiveExpression.insert(index, coefficient);
+    }
+    double lb, ub;
+    schedule.getBoundRange(value, objective.getDirection(), lb, ub, solver.getInfinity());
+    solver.addRow(objectiveExpression, lb, ub, objective.getName());
+}
+
 std::vector<double> SolverCBC::getSolution(){
     std::vector<double> solution;
     solution.resize(model.getNumCols());
@@ -2,6 +2,8 @@
 #define __solverCBC__h
 
 #include "abstractSolver.h"
+#include "lexicographicSchedule.h"
+#include "callbackCBC.h"
 #include "CbcModel.hpp"
 // Using as solver
 #include "OsiCbcSolverInterface.hpp"
@@ -50,6 +52,9 @@ public:
 
 	/** Defines the cbc optimization parameters. **/
 	void setCBCParams(const Input &input);
+
+	/** Adds the generator of the lazy non-overlapping constraints to the CBC model, if they are lazy. **/
+	void setLazyConstraints(const Input &input);
 	/****************************************************************************************/
 	/*										Methods											*/
 	/****************************************************************************************/
@@ -63,8 +68,12 @@ public:
 	
 	void exportFormulation(const Instance &instance);
 	
+	/** Optimizes the objectives one after the other, each one starting from the solution of the previous one. **/
 	void solve() override;
 
+	/** Restricts an optimized objective to the tolerance of its value for the next objectives. @param objective The objective. @param value The value found. @param schedule The lexicographic schedule. **/
+	void addObjectiveBound(const ObjectiveFunction &objective, double value, const LexicographicSchedule &schedule);
+
 	//IloExpr to_IloExpr(const Expression &e);
 	
 	/** Returns the total number of CPLEX default cuts applied during optimization. **/
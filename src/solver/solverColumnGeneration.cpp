@@ -0,0 +1,228 @@
+#include "solverColumnGeneration.h"
+
+#include <cfloat>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+/****************************************************************************************/
+/*										Constructor										*/
+/****************************************************************************************/
+
+/* Constructor. Builds the extended graphs and the master problem, with only the artificial columns. */
+SolverColumnGeneration::SolverColumnGeneration(const Instance &inst) : AbstractSolver(STATUS_UNKNOWN), instance(inst), pricing(inst), nbIterations(0){
+	std::cout << "--- Column generation has been initialized ---" << std::endl;
+	implementFormulation();
+}
+
+/* The artificial column of a demand costs more than routing every demand of the batch, so it is only used when the generated columns cannot route the demand. */
+void SolverColumnGeneration::implementFormulation(){
+	Telemetry::Span chargeSpan("charge");
+	master.messageHandler()->setLogLevel(0);
+	master.setObjSense(1);
+	Telemetry::Span constraintsSpan("constraints");
+	CoinPackedVector empty;
+	linkRow.resize(instance.getNbEdges());
+	for (int e = 0; e < instance.getNbEdges(); e++){
+		for (int s = 0; s < pricing.getNbRowSlices(e); s++){
+			std::ostringstream rowName;
+			rowName << "NonOverlap_" << e+1 << "_" << s+1;
+			linkRow[e].push_back(master.getNumRows());
+			master.addRow(empty, -master.getInfinity(), 1.0, rowName.str());
+		}
+	}
+	for (int d = 0; d < pricing.getNbDemandsToBeRouted(); d++){
+		std::ostringstream rowName;
+		rowName << "Convexity_" << pricing.getToBeRouted_k(d).getId()+1;
+		demandRow.push_back(master.getNumRows());
+		master.addRow(empty, 1.0, 1.0, rowName.str());
+	}
+	constChargeTime = constraintsSpan.stop();
+	Telemetry::count(Telemetry::COUNTER_ROWS, master.getNumRows());
+
+	Telemetry::Span variablesSpan("variables");
+	double bigM = 1.0;
+	for (int d = 0; d < pricing.getNbDemandsToBeRouted(); d++){
+		bigM += pricing.getMaxColumnCost(d);
+	}
+	for (int d = 0; d < pricing.getNbDemandsToBeRouted(); d++){
+		CoinPackedVector column;
+		column.insert(demandRow[d], 1.0);
+		std::ostringstream colName;
+		colName << "blocked_" << pricing.getToBeRouted_k(d).getId()+1;
+		master.addCol(column, 0.0, 1.0, bigM, colName.str());
+	}
+	varChargeTime = variablesSpan.stop();
+	totalChargeTime = chargeSpan.stop();
+	std::cout << "Master problem has been defined..." << std::endl;
+}
+
+/****************************************************************************************/
+/*										Getters											*/
+/****************************************************************************************/
+
+/* Returns, for each demand of the batch, the last slice of its window (-1 if not routed). */
+std::vector<double> SolverColumnGeneration::getSolution(){
+	std::vector<double> solution(pricing.getNbDemandsToBeRouted(), -1);
+	for (unsigned int i = 0; i < chosen.size(); i++){
+		solution[chosen[i].demand] = chosen[i].slice;
+	}
+	return solution;
+}
+
+/****************************************************************************************/
+/*										Methods											*/
+/****************************************************************************************/
+
+/* A column covers the window [slice - load + 1, slice] of each of its fibers. */
+void SolverColumnGeneration::addColumn(const PathColumn &pathColumn){
+	int load = pricing.getToBeRouted_k(pathColumn.demand).getLoad();
+	CoinPackedVector column;
+	for (unsigned int i = 0; i < pathColumn.edges.size(); i++){
+		int e = pathColumn.edges[i];
+		for (int s = pathColumn.slice - load + 1; s <= pathColumn.slice; s++){
+			column.insert(linkRow[e][s], 1.0);
+		}
+	}
+	column.insert(demandRow[pathColumn.demand], 1.0);
+	std::ostringstream colName;
+	colName << "path_" << pricing.getToBeRouted_k(pathColumn.demand).getId()+1 << "_" << pathColumn.slice+1 << "_" << columns.size();
+	master.addCol(column, 0.0, 1.0, pathColumn.cost, colName.str());
+	columns.push_back(pathColumn);
+}
+
+/* The master value plus the least reduced cost of each demand is a lower bound (Lagrangian bound of the master). */
+void SolverColumnGeneration::solve(){
+	ClockTime solveTime(ClockTime::getTimeNow());
+	std::cout << "Solving with column generation..." << std::endl;
+	int nbDemands = pricing.getNbDemandsToBeRouted();
+	double timeLimit = instance.getInput().getIterationTimeLimit();
+	std::vector< std::vector<double> > linkDuals(linkRow.size());
+	std::vector<double> demandDuals(nbDemands, 0.0);
+	double bestBound = -DBL_MAX;
+
+	Telemetry::Span generationSpan("generation");
+	master.initialSolve();
+	while (master.isProvenOptimal()){
+		nbIterations++;
+		const double *rowPrice = master.getRowPrice();
+		for (unsigned int e = 0; e < linkRow.size(); e++){
+			linkDuals[e].resize(linkRow[e].size());
+			for (unsigned int s = 0; s < linkRow[e].size(); s++){
+				linkDuals[e][s] = rowPrice[linkRow[e][s]];
+			}
+		}
+		for (int d = 0; d < nbDemands; d++){
+			demandDuals[d] = rowPrice[demandRow[d]];
+		}
+
+		Telemetry::Span pricingSpan("pricing");
+		std::vector<PathColumn> priced;
+		std::vector<bool> found = pricing.priceAll(linkDuals, demandDuals, priced);
+		pricingSpan.stop();
+
+		double bound = master.getObjValue();
+		int nbAdded = 0;
+		for (int d = 0; d < nbDemands; d++){
+			if (!found[d]){
+				std::cout << "Demand " << pricing.getToBeRouted_k(d).getId() + 1 << " has no path within its reach." << std::endl;
+				generationSpan.stop();
+				setStatus(STATUS_INFEASIBLE);
+				setDurationTime(solveTime.getTimeInSecFromStart());
+				return;
+			}
+			bound += std::min(0.0, priced[d].reducedCost);
+			if (priced[d].reducedCost < -EPS){
+				addColumn(priced[d]);
+				nbAdded++;
+			}
+		}
+		bestBound = std::max(bestBound, bound);
+		std::cout << "Iteration " << nbIterations << ": master " << master.getObjValue() << ", bound " << bestBound << ", " << nbAdded << " columns added." << std::endl;
+		if (nbAdded == 0 || solveTime.getTimeInSecFromStart() >= timeLimit){
+			break;
+		}
+		master.resolve();
+	}
+	setRootValue(master.isProvenOptimal() ? master.getObjValue() : -DBL_MAX);
+	setLowerBound(bestBound);
+	totalImpleTime = generationSpan.stop();
+	Telemetry::count(Telemetry::COUNTER_VARIABLES, master.getNumCols());
+	std::cout << "Column generation done after " << nbIterations << " iterations with " << columns.size() << " columns." << std::endl;
+
+	solveIntegerMaster(std::max(0.0, timeLimit - solveTime.getTimeInSecFromStart()));
+	setDurationTime(solveTime.getTimeInSecFromStart());
+	std::cout << "Optimization done in " << std::fixed << getDurationTime() << std::setprecision(2) << " secs." << std::endl;
+}
+
+/* The artificial columns are fixed to zero: a demand without any generated column blocks the batch. The bound of CBC only holds for the generated columns, so the gap is measured against the column generation bound. */
+void SolverColumnGeneration::solveIntegerMaster(double timeLimit){
+	Telemetry::Span integerSpan("integer");
+	int nbDemands = pricing.getNbDemandsToBeRouted();
+	for (int d = 0; d < nbDemands; d++){
+		master.setColUpper(d, 0.0);
+	}
+	for (int j = nbDemands; j < master.getNumCols(); j++){
+		master.setInteger(j);
+	}
+	CbcModel model(master);
+	model.setLogLevel(0);
+	model.setMaximumSeconds(timeLimit);
+	model.branchAndBound();
+	integerSpan.stop();
+	setTreeSize(model.getNodeCount());
+
+	chosen.clear();
+	if (model.bestSolution() == NULL){
+		setStatus(model.isProvenInfeasible() ? STATUS_INFEASIBLE : STATUS_UNKNOWN);
+		std::cout << "Could not find an integer feasible solution..." << std::endl;
+		return;
+	}
+	const double *solution = model.bestSolution();
+	for (unsigned int j = 0; j < columns.size(); j++){
+		if (solution[nbDemands + j] >= 0.5){
+			chosen.push_back(columns[j]);
+		}
+	}
+	setUpperBound(model.getObjValue());
+	setMipGap(getLowerBound(), getUpperBound());
+	setStatus((getMipGap() <= EPS) ? STATUS_OPTIMAL : STATUS_FEASIBLE);
+	std::cout << "Objective Function Value: " << getUpperBound() << " (gap " << getMipGap() << ")" << std::endl;
+}
+
+/* Stores the chosen paths in the extended graphs and updates the instance, as AbstractSolver::updateRSA does with the formulation. */
+void SolverColumnGeneration::updateRSA(Instance &i){
+	std::cout << "Update RSA" << std::endl;
+	if (getStatus() == STATUS_OPTIMAL || getStatus() == STATUS_FEASIBLE){
+		std::cout << "Feasible" << std::endl;
+		pricing.setPaths(chosen);
+		pricing.updateInstance(i);
+		i.setWasBlocked(false);
+		pricing.displayPaths();
+	}
+	else{
+		std::cout << "Decrease the number of demands to be treated." << std::endl;
+		i.decreaseNbDemandsAtOnce();
+		i.setWasBlocked(true);
+	}
+}
+
+/* Appends the main results to the file log_results.csv. */
+void SolverColumnGeneration::outputLogResults(std::string fileName){
+	std::string delimiter = ";";
+	std::string filePath = instance.getInput().getOutputPath() + "log_results.csv";
+	std::ofstream myfile(filePath.c_str(), std::ios_base::app);
+	if (myfile.is_open()){
+		myfile << fileName << delimiter;
+		myfile << getStatus() << delimiter;
+		myfile << getDurationTime() << delimiter;
+		myfile << getLowerBound() << delimiter;
+		myfile << getUpperBound() << delimiter;
+		myfile << getMipGap() << delimiter;
+		myfile << getTreeSize() << "\n";
+		myfile.close();
+	}
+	else{
+		std::cerr << "Unable to open file " << filePath << "\n";
+	}
+}
@@ -0,0 +1,72 @@
+#ifndef __solverColumnGeneration__h
+#define __solverColumnGeneration__h
+
+#include "abstractSolver.h"
+#include "../formulation/pathPricing.h"
+#include "CbcModel.hpp"
+#include "OsiClpSolverInterface.hpp"
+
+/***********************************************************************************************
+* This class implements a path-based column generation for the Online Routing and Spectrum
+* Allocation. The restricted master has one column per generated path (a path and a slice
+* window of a demand), one non-overlapping row per (fiber, slice) and one convexity row per
+* demand; an artificial column of large cost per demand keeps it feasible. It is solved by Clp,
+* and the columns of negative reduced cost are priced on the extended graphs of the demands,
+* in parallel (see PathPricing). Once no column prices out, or the time limit is reached, the
+* final master is solved as a MIP over the generated columns with CBC (price-and-branch).
+* Unlike FlowForm, the model does not hold one variable per (demand, arc).
+************************************************************************************************/
+class SolverColumnGeneration : public AbstractSolver{
+
+private:
+	const Instance &instance;					/**< The instance to be solved. **/
+	PathPricing pricing;						/**< The extended graphs of the demands and their pricing problem. **/
+	OsiClpSolverInterface master;				/**< The restricted master problem. **/
+
+	std::vector< std::vector<int> > linkRow;	/**< linkRow[e][s] is the non-overlapping row of fiber e and slice s. **/
+	std::vector<int> demandRow;					/**< The convexity row of each demand. **/
+	std::vector<PathColumn> columns;			/**< The generated columns; the column of index j is the master column nbDemands + j. **/
+	std::vector<PathColumn> chosen;				/**< The column chosen for each demand in the final solution. **/
+	int nbIterations;							/**< Number of times the master was solved. **/
+
+public:
+	/****************************************************************************************/
+	/*										Constructors									*/
+	/****************************************************************************************/
+
+	/** Constructor. Builds the extended graphs and the master problem, with only the artificial columns. @param instance The instance to be solved. **/
+	SolverColumnGeneration(const Instance &instance);
+
+	/****************************************************************************************/
+	/*										Getters											*/
+	/****************************************************************************************/
+
+	AbstractSolver::Status getStatus() override { return currentStatus; }
+
+	/** Returns, for each demand of the batch, the last slice of its window (-1 if not routed). **/
+	std::vector<double> getSolution() override;
+
+	/****************************************************************************************/
+	/*										Methods											*/
+	/****************************************************************************************/
+
+	/** Builds the rows of the master problem and the artificial columns. **/
+	void implementFormulation() override;
+
+	/** Generates columns until none prices out, then solves the final master as a MIP. **/
+	void solve() override;
+
+	/** Stores the chosen paths in the extended graphs and updates the instance, as AbstractSolver::updateRSA does with the formulation. **/
+	void updateRSA(Instance &instance) override;
+
+	/** Appends the main results to the file log_results.csv. **/
+	void outputLogResults(std::string fileName) override;
+
+private:
+	/** Adds a column to the master problem. **/
+	void addColumn(const PathColumn &column);
+
+	/** Solves the master problem as a MIP over the generated columns and recovers the chosen columns. @param timeLimit The remaining time, in seconds. **/
+	void solveIntegerMaster(double timeLimit);
+};
+#endif
@@ -41,7 +41,7 @@ CPXLONG SolverCplex::context(Input::ObjectiveMetric obj, const Input &i){
         contextMask |= IloCplex::Callback::Context::Id::Candidate;
         contextMask |= IloCplex::Callback::Context::Id::Relaxation;
     }
-    if(i.isGNPYEnabled()){
+    if(i.isGNPYEnabled() || i.isNonOverlapLazy()){
         contextMask |= IloCplex::Callback::Context::Id::Candidate;
     }
     if(i.isUserCutsActivated()){
@@ -50,16 +50,23 @@ CPXLONG SolverCplex::context(Input::ObjectiveMetric obj, const Input &i){
     return contextMask;
 }
 
+/* The objectives are optimized one after the other. Each objective is given its share of the time limit and starts from the solution of the previous one, which stays feasible since the previous objective is only bounded within the tolerance of its value. The cuts and lazy constraints added by the callback are kept in the model for the next objectives. */
 void SolverCplex::solve(){
 
     IloNum timeStart = cplex.getCplexTime();
     std::cout << "Solving..." << std::endl;
     std::vector<ObjectiveFunction> myObjectives = formulation->getObjectiveSet();
+    LexicographicSchedule schedule(formulation->getInstance().getInput(), myObjectives.size());
+    IloNumArray incumbent(env);
     for (unsigned int i = 0; i < myObjectives.size(); i++){
         if (i >= 1){
             model.remove(obj);
             setObjective(myObjectives[i]);
+            if (!formulation->getInstance().getInput().isRelaxed()){
+                cplex.addMIPStart(var, incumbent, IloCplex::MIPStartAuto);
+            }
         }
+        cplex.setParam(IloCplex::Param::TimeLimit, schedule.getStageTimeLimit(i));
         
         CplexCallback myGenericCallback(var, formulation,
                                         formulation->getInstance().getInput(),
@@ -76,11 +83,15 @@ void SolverCplex::solve(){
             IloNum objValue = cplex.getObjValue();
             std::cout << "Objective Function Value: " << objValue << std::endl;
             if (i < myObjectives.size() - 1){
+                cplex.getValues(incumbent, var);
+                double lb, ub;
+                schedule.getBoundRange(objValue, myObjectives[i].getDirection(), lb, ub, IloInfinity);
                 IloExpr objectiveExpression = to_IloExpr(myObjectives[i].getExpression());
-                IloRange constraint(model.getEnv(), objValue, objectiveExpression, objValue);
-                //std::cout << "Add constraint: " << objectiveExpression << " = " << objValue << std::endl;
+                IloRange constraint(model.getEnv(), lb, objectiveExpression, ub);
+                //std::cout << "Add constraint: " << objectiveExpression << " <= " << ub << std::endl;
                 model.add(constraint);
                 objectiveExpression.end();
+                addCutPool(myGenericCallback);
             }
         }
         else{
@@ -89,6 +100,7 @@ void SolverCplex::solve(){
             i = myObjectives.size()+1;
         }
     }
+    incumbent.end();
     IloNum timeFinish = cplex.getCplexTime();
     setDurationTime(timeFinish - timeStart);
     setUpperBound(cplex.getObjValue());
@@ -111,6 +123,32 @@ void SolverCplex::solve(){
     }
 }
 
+/* User cuts and lazy constraints are given to CPLEX as such, so that they are only applied when violated. */
+void SolverCplex::addCutPool(const CplexCallback &callback){
+    const std::vector<Constraint> &userCuts = callback.getUserCutPool();
+    const std::vector<Constraint> &lazyConstraints = callback.getLazyPool();
+    if (!userCuts.empty()){
+        IloRangeArray cuts(model.getEnv());
+        for (unsigned int i = 0; i < userCuts.size(); i++){
+            IloExpr exp = to_IloExpr(userCuts[i].getExpression());
+            cuts.add(IloRange(model.getEnv(), userCuts[i].getLb(), exp, userCuts[i].getUb(), userCuts[i].getName().c_str()));
+            exp.end();
+        }
+        cplex.addUserCuts(cuts);
+        cuts.end();
+    }
+    if (!lazyConstraints.empty()){
+        IloRangeArray lazy(model.getEnv());
+        for (unsigned int i = 0; i < lazyConstraints.size(); i++){
+            IloExpr exp = to_IloExpr(lazyConstraints[i].getExpression());
+            lazy.add(IloRange(model.getEnv(), lazyConstraints[i].getLb(), exp, lazyConstraints[i].getUb(), lazyConstraints[i].getName().c_str()));
+            exp.end();
+        }
+        cplex.addLazyConstraints(lazy);
+        lazy.end();
+    }
+    std::cout << userCuts.size() << " user cuts and " << lazyConstraints.size() << " lazy constraints are kept for the next objective." << std::endl;
+}
 
 AbstractSolver::Status SolverCplex::getStatus(){
     setStatus(STATUS_ERROR);
@@ -207,23 +245,21 @@ void SolverCplex::setCplexParams(const Input &input){
 }
 
 void SolverCplex::implementFormulation(){
-    ClockTime time(ClockTime::getTimeNow());
-    ClockTime time2(ClockTime::getTimeNow());
-    setVariables(formulation->getVariables());
-    //std::cout << "Time: " << time.getTimeInSecFromStart() << std::endl;
-    varChargeTime =  time.getTimeInSecFromStart();
-    time.setStart(ClockTime::getTimeNow());
+    Telemetry::Span chargeSpan("charge");
+    Telemetry::Span variablesSpan("variables");
+    std::vector<Variable> variables = formulation->getVariables();
+    setVariables(variables);
+    varChargeTime = variablesSpan.stop();
+    Telemetry::count(Telemetry::COUNTER_VARIABLES, variables.size());
+    Telemetry::Span constraintsSpan("constraints");
     setConstraints(formulation->getConstraints());
-    //std::cout << "Time: " << time.getTimeInSecFromStart() << std::endl;
-    constChargeTime = time.getTimeInSecFromStart();
-    time.setStart(ClockTime::getTimeNow());
+    constChargeTime = constraintsSpan.stop();
+    Telemetry::count(Telemetry::COUNTER_ROWS, formulation->getConstraints().size());
+    Telemetry::Span objectiveSpan("objective");
     setObjective(formulation->getObjFunction(0));
-    //std::cout << "Time: " << time.getTimeInSecFromStart() << std::endl;
-    objChargeTime = time.getTimeInSecFromStart();
-    time.setStart(ClockTime::getTimeNow());
+    objChargeTime = objectiveSpan.stop();
     formulation->clearConstraints();
-    //std::cout << "Time: " << time.getTimeInSecFromStart() << std::endl;
-    totalChargeTime = time2.getTimeInSecFromStart();
+    totalChargeTime = chargeSpan.stop();
 }
 
 IloExpr SolverCplex::to_IloExpr(const Expression &e){
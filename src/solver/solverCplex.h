@@ -4,6 +4,7 @@
 #include <ilcplex/ilocplex.h>
 #include "abstractSolver.h"
 #include "callbackCplex.h"
+#include "lexicographicSchedule.h"
 
 
 /***********************************************************************************************
@@ -69,8 +70,15 @@ public:
 	
 	void exportFormulation(const Instance &instance);
 	
+	/** Optimizes the objectives one after the other, each one starting from the solution of the previous one. **/
 	void solve() override;
 
+	/** Limits the number of threads used by CPLEX. @param nbThreads The number of threads. **/
+	void setNbThreads(int nbThreads) override { cplex.setParam(IloCplex::Param::Threads, nbThreads); }
+
+	/** Adds the user cuts and lazy constraints recorded by a callback to the model, for the next objective. **/
+	void addCutPool(const CplexCallback &callback);
+
 	IloExpr to_IloExpr(const Expression &e);
 	
 	/** Returns the total number of CPLEX default cuts applied during optimization. **/
@@ -0,0 +1,247 @@
+#include "solverDecomposition.h"
+#include "solverFactory.h"
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <functional>
+#include <thread>
+
+/****************************************************************************************/
+/*										Constructor										*/
+/****************************************************************************************/
+
+/* The components are computed on the graphs of the whole batch after the structural preprocessing only: the QoT preprocessing, the most expensive one, is left to the solvers of the components. Since preprocessing only erases arcs, the components found without it can only be unions of the final ones, never split demands that interact. A batch of a single demand needs no graphs at all. The solvers are built one after the other, since building a model touches shared state (solver counters, QoT cache); only their optimization runs in parallel. */
+SolverDecomposition::SolverDecomposition(const Instance &inst, Input::MIP_Solver solver) : AbstractSolver(STATUS_UNKNOWN), instance(inst), chosenSolver(solver){
+	std::cout << "--- Decomposition has been initialized ---" << std::endl;
+	Telemetry::Span decompositionSpan("decomposition");
+	nbDemands = instance.getNextDemands().size();
+	if (nbDemands <= 1){
+		components.assign(1, std::vector<int>(nbDemands, 0));
+	}
+	else{
+		Input input(instance.getInput());
+		if (input.getChosenPreprLvl() > Input::PREPROCESSING_LVL_FULL){
+			input.setChosenPreprLvl(Input::PREPROCESSING_LVL_FULL);
+		}
+		Instance componentInstance(instance, input);
+		RSA rsa(componentInstance);
+		components = rsa.getInteractionComponents();
+	}
+	totalChargeTime = decompositionSpan.stop();
+	std::cout << "The batch of " << nbDemands << " demands is split into " << components.size() << " independent sub-batches." << std::endl;
+
+	SolverFactory factory;
+	for (unsigned int c = 0; c < components.size(); c++){
+		if (components.size() == 1){
+			subSolvers.emplace_back(factory.createSolver(instance, chosenSolver));
+		}
+		else{
+			subSolvers.emplace_back(factory.createSolver(getSubInstance(instance, components[c]), chosenSolver));
+		}
+		totalChargeTime += subSolvers[c]->getTotalChargeTime();
+		varChargeTime += subSolvers[c]->getVarChargeTime();
+		constChargeTime += subSolvers[c]->getConstChargeTime();
+		objChargeTime += subSolvers[c]->getObjChargeTime();
+		totalImpleTime += subSolvers[c]->getTotalImpleTime();
+		varImpleTime += subSolvers[c]->getVarImpleTime();
+		constImpleTime += subSolvers[c]->getConstImpleTime();
+		cutImpleTime += subSolvers[c]->getCutImpleTime();
+		objImpleTime += subSolvers[c]->getObjImpleTime();
+	}
+}
+
+/* The demands of the batch are the first unrouted ones from the next demand to be routed: marking the demands of the other components as routed and shrinking the batch leaves only the component. */
+Instance SolverDecomposition::getSubInstance(const Instance &inst, const std::vector<int> &component) const{
+	Instance subInstance(inst);
+	std::vector<Demand> batch = inst.getNextDemands();
+	std::vector<Demand> tabDemand = inst.getTabDemand();
+	std::vector<bool> inComponent(batch.size(), false);
+	for (unsigned int i = 0; i < component.size(); i++){
+		inComponent[component[i]] = true;
+	}
+	for (unsigned int d = 0; d < batch.size(); d++){
+		if (!inComponent[d]){
+			tabDemand[batch[d].getId()].setRouted(true);
+		}
+	}
+	subInstance.setTabDemand(tabDemand);
+	subInstance.setNbDemandsAtOnce(component.size());
+	return subInstance;
+}
+
+/****************************************************************************************/
+/*										Getters											*/
+/****************************************************************************************/
+
+AbstractSolver::Status SolverDecomposition::getStatus(){
+	Status status = STATUS_OPTIMAL;
+	for (unsigned int c = 0; c < subSolvers.size(); c++){
+		Status subStatus = subSolvers[c]->getStatus();
+		if (subStatus == STATUS_FEASIBLE){
+			status = STATUS_FEASIBLE;
+		}
+		else if (subStatus != STATUS_OPTIMAL){
+			setStatus(subStatus);
+			return currentStatus;
+		}
+	}
+	setStatus(status);
+	return currentStatus;
+}
+
+/* Returns the solutions of the components, one after the other. */
+std::vector<double> SolverDecomposition::getSolution(){
+	std::vector<double> solution;
+	for (unsigned int c = 0; c < subSolvers.size(); c++){
+		std::vector<double> subSolution = subSolvers[c]->getSolution();
+		solution.insert(solution.end(), subSolution.begin(), subSolution.end());
+	}
+	return solution;
+}
+
+/* The value of an objective summed over the demands is the sum of its values over the components. The largest slice used (objective 8) is the largest over the components, and so are its bounds. Under a lexicographic order, objective 8 can only come last: the components below the largest slice could otherwise trade it for the next objectives. */
+bool SolverDecomposition::isDecomposable(const Input &input){
+	int nbObjectives = input.getChosenObj().size();
+	for (int k = 0; k < nbObjectives; k++){
+		switch (input.getChosenObj_k(k)){
+			case Input::OBJECTIVE_METRIC_0:
+			case Input::OBJECTIVE_METRIC_1:
+			case Input::OBJECTIVE_METRIC_2:
+			case Input::OBJECTIVE_METRIC_2p:
+			case Input::OBJECTIVE_METRIC_4:{
+				break;
+			}
+			case Input::OBJECTIVE_METRIC_8:{
+				if (k < nbObjectives - 1){
+					return false;
+				}
+				break;
+			}
+			default:{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+/****************************************************************************************/
+/*										Methods											*/
+/****************************************************************************************/
+
+/* Components are handed out one at a time, the largest first since they are the longest to solve. The bounds reported by the solvers are the ones of the last objective. */
+void SolverDecomposition::solve(){
+	ClockTime solveTime(ClockTime::getTimeNow());
+	std::cout << "Solving " << subSolvers.size() << " sub-batches in parallel..." << std::endl;
+	std::vector<int> order(subSolvers.size());
+	for (unsigned int c = 0; c < order.size(); c++){
+		order[c] = c;
+	}
+	std::stable_sort(order.begin(), order.end(), [this](int a, int b){ return components[a].size() > components[b].size(); });
+	std::atomic<int> next(0);
+	std::function<void()> worker = [this, &order, &next](){
+		for (int i = next++; i < (int)order.size(); i = next++){
+			subSolvers[order[i]]->solve();
+		}
+	};
+	int nbCores = std::max(1, (int)std::thread::hardware_concurrency());
+	int nbThreads = std::min(nbCores, (int)subSolvers.size());
+	/* Each solver gets its share of the cores, so that the concurrent optimizations do not oversubscribe the machine. */
+	if (nbThreads > 1){
+		for (unsigned int c = 0; c < subSolvers.size(); c++){
+			subSolvers[c]->setNbThreads(std::max(1, nbCores/nbThreads));
+		}
+	}
+	std::vector<std::thread> threads;
+	for (int t = 1; t < nbThreads; t++){
+		threads.push_back(std::thread(worker));
+	}
+	worker();
+	for (unsigned int t = 0; t < threads.size(); t++){
+		threads[t].join();
+	}
+
+	const Input &input = instance.getInput();
+	bool isMax = (input.getChosenObj_k(input.getChosenObj().size() - 1) == Input::OBJECTIVE_METRIC_8);
+	double upper = 0.0;
+	double lower = 0.0;
+	int nodes = 0;
+	for (unsigned int c = 0; c < subSolvers.size(); c++){
+		if (isMax){
+			upper = std::max(upper, subSolvers[c]->getUpperBound());
+			lower = std::max(lower, subSolvers[c]->getLowerBound());
+		}
+		else{
+			upper += subSolvers[c]->getUpperBound();
+			lower += subSolvers[c]->getLowerBound();
+		}
+		nodes += subSolvers[c]->getTreeSize();
+	}
+	setUpperBound(upper);
+	setLowerBound(lower);
+	setMipGap(lower, upper);
+	setTreeSize(nodes);
+	setDurationTime(solveTime.getTimeInSecFromStart());
+	std::cout << "Sub-batches solved in " << getDurationTime() << " secs. Objective Function Value: " << upper << std::endl;
+}
+
+/* Each solver assigns the slices of its component and moves to the next demands as if its component was the whole batch: the next demand to be routed and the batch size are then set as RSA::updateInstance does for the whole batch. */
+void SolverDecomposition::updateRSA(Instance &i){
+	if (subSolvers.size() == 1){
+		subSolvers[0]->updateRSA(i);
+		return;
+	}
+	std::cout << "Update RSA" << std::endl;
+	if (getStatus() == STATUS_OPTIMAL || getStatus() == STATUS_FEASIBLE){
+		int firstDemand = i.getNextDemandToBeRoutedIndex();
+		int nbDemandsAtOnce = i.getInput().getNbDemandsAtOnce();
+		bool wasBlocked = i.getWasBlocked();
+		for (unsigned int c = 0; c < subSolvers.size(); c++){
+			subSolvers[c]->updateRSA(i);
+		}
+		i.setNbDemandsAtOnce(nbDemandsAtOnce);
+		int nextDemandToBeRouted = firstDemand + nbDemands;
+		if (i.getInput().isBlockingAllowed()){
+			if (wasBlocked){
+				nextDemandToBeRouted++;
+			}
+		}
+		else{
+			if (wasBlocked){
+				i.setNbDemandsAtOnce(0);
+			}
+		}
+		i.setNextDemandToBeRoutedIndex(nextDemandToBeRouted);
+		i.setWasBlocked(false);
+	}
+	else{
+		std::cout << "Decrease the number of demands to be treated." << std::endl;
+		i.decreaseNbDemandsAtOnce();
+		i.setWasBlocked(true);
+	}
+}
+
+/* Appends the main results to the file log_results.csv. */
+void SolverDecomposition::outputLogResults(std::string fileName){
+	if (subSolvers.size() == 1){
+		subSolvers[0]->outputLogResults(fileName);
+		return;
+	}
+	std::string delimiter = ";";
+	std::string filePath = instance.getInput().getOutputPath() + "log_results.csv";
+	std::ofstream myfile(filePath.c_str(), std::ios_base::app);
+	if (myfile.is_open()){
+		myfile << fileName << delimiter;
+		myfile << getStatus() << delimiter;
+		myfile << getDurationTime() << delimiter;
+		myfile << getLowerBound() << delimiter;
+		myfile << getUpperBound() << delimiter;
+		myfile << getMipGap() << delimiter;
+		myfile << getTreeSize() << "\n";
+		myfile.close();
+	}
+	else{
+		std::cerr << "Unable to open file " << filePath << "\n";
+	}
+}
@@ -0,0 +1,68 @@
+#ifndef __solverDecomposition__h
+#define __solverDecomposition__h
+
+#include <memory>
+
+#include "abstractSolver.h"
+
+/***********************************************************************************************
+* This class splits a batch into independent sub-batches. After the structural preprocessing,
+* two demands depend on each other if arcs of their extended graphs cover a same slice of a
+* same fiber (see RSA::getInteractionComponents). The demands of different components can be
+* routed independently, so each component is solved as its own MIP by the chosen solver, the
+* components being solved in parallel on their share of the cores. The batch is routed only
+* if every component is.
+* The objectives summed over the demands are summed over the components; objective 8, the
+* largest slice used, is the largest over the components.
+************************************************************************************************/
+class SolverDecomposition : public AbstractSolver{
+
+private:
+	const Instance &instance;									/**< The instance to be solved. **/
+	Input::MIP_Solver chosenSolver;								/**< The solver of the components. **/
+	int nbDemands;												/**< Number of demands of the batch. **/
+	std::vector< std::vector<int> > components;					/**< The indices in the batch of the demands of each component. **/
+	std::vector< std::unique_ptr<AbstractSolver> > subSolvers;	/**< The solver of each component. **/
+
+public:
+	/****************************************************************************************/
+	/*										Constructors									*/
+	/****************************************************************************************/
+
+	/** Constructor. Computes the components of the batch and builds their solvers. @param instance The instance to be solved. @param chosenSolver The solver of the components. **/
+	SolverDecomposition(const Instance &instance, Input::MIP_Solver chosenSolver);
+
+	/****************************************************************************************/
+	/*										Getters											*/
+	/****************************************************************************************/
+
+	/** Returns optimal if every component was solved to optimality, feasible if every component was routed, and the status of the first component that was not routed otherwise. **/
+	AbstractSolver::Status getStatus() override;
+
+	/** Returns the solutions of the components, one after the other. **/
+	std::vector<double> getSolution() override;
+
+	/** Returns if the objectives can be optimized component by component: the objectives summed over the demands, and objective 8 as the last objective. **/
+	static bool isDecomposable(const Input &input);
+
+	/****************************************************************************************/
+	/*										Methods											*/
+	/****************************************************************************************/
+
+	/** The formulations of the components are implemented by their solvers. **/
+	void implementFormulation() override {}
+
+	/** Solves the components in parallel and aggregates their bounds. **/
+	void solve() override;
+
+	/** Updates the instance with the solution of each component, then moves to the next demands as if the batch had been solved at once. **/
+	void updateRSA(Instance &instance) override;
+
+	/** Appends the main results to the file log_results.csv. **/
+	void outputLogResults(std::string fileName) override;
+
+private:
+	/** Returns a copy of the instance whose next demands are the ones of a component: the other demands of the batch are marked as routed. @param component The component. **/
+	Instance getSubInstance(const Instance &instance, const std::vector<int> &component) const;
+};
+#endif
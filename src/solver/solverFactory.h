@@ -5,6 +5,9 @@
 #include "solverCplex.h"
 #include "solverCBC.h"
 #include "lagSolverCBC.h"
+#include "solverGreedy.h"
+#include "solverColumnGeneration.h"
+#include "solverDecomposition.h"
 
 /*********************************************************************************************
 * This class implements a factory for Formulations. It provides a concrete formulation.
@@ -12,9 +15,22 @@
 class SolverFactory{
 
 public:
-	/** Factory Method. Returns a new concrete solver based on the chosen MIP_Solver.  @param instance The instance to be solved. **/
+	/** Factory Method. Returns a new concrete solver based on the chosen MIP_Solver, which solves the independent sub-batches in parallel if the decomposition is enabled.  @param instance The instance to be solved. **/
     inline AbstractSolver* createSolver(const Instance &instance){
-        Input::MIP_Solver chosenSolver = instance.getInput().getChosenMIPSolver();
+        const Input &input = instance.getInput();
+        Input::MIP_Solver chosenSolver = input.getChosenMIPSolver();
+        bool isMIP = (chosenSolver == Input::MIP_SOLVER_CPLEX || chosenSolver == Input::MIP_SOLVER_CBC);
+        if (input.isDecompositionEnabled() && isMIP && input.getChosenNodeMethod() == Input::NODE_METHOD_LINEAR_RELAX){
+            if (SolverDecomposition::isDecomposable(input)){
+                return new SolverDecomposition(instance, chosenSolver);
+            }
+            std::cout << "WARNING: The objectives couple the demands of the batch, which is not decomposed." << std::endl;
+        }
+        return createSolver(instance, chosenSolver);
+    }
+
+	/** Factory Method. Returns a new concrete solver of the given kind.  @param instance The instance to be solved. @param chosenSolver The solver. **/
+    inline AbstractSolver* createSolver(const Instance &instance, Input::MIP_Solver chosenSolver){
         switch (chosenSolver){
             case Input::MIP_SOLVER_CPLEX:{
                 return new SolverCplex(instance);
@@ -34,6 +50,14 @@ public:
                     break;
                 }
             }
+            case Input::MIP_SOLVER_GREEDY:{
+                return new SolverGreedy(instance);
+                break;
+            }
+            case Input::MIP_SOLVER_COLUMN_GENERATION:{
+                return new SolverColumnGeneration(instance);
+                break;
+            }
             default:{
                 std::cout << "ERROR: Invalid MIP_Solver." << std::endl;
                 exit(0);
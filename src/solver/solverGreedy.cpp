@@ -0,0 +1,399 @@
+#include "solverGreedy.h"
+#include "solverFactory.h"
+
+#include <algorithm>
+#include <climits>
+#include <fstream>
+
+/****************************************************************************************/
+/*										Constructor										*/
+/****************************************************************************************/
+
+/* Constructor. Gets the candidate paths of the topology and builds the spectrum bitsets. */
+SolverGreedy::SolverGreedy(const Instance &inst) : AbstractSolver(STATUS_UNKNOWN), instance(inst){
+	std::cout << "--- Greedy solver has been initialized ---" << std::endl;
+	Telemetry::Span pathsSpan("paths");
+	toBeRouted = instance.getNextDemands();
+	nbPaths = instance.getInput().getGreedyNbPaths();
+	pathCache = PathCache::getCache(instance.getTabEdge(), instance.getNbNodes(), nbPaths, instance.getInput().getPathCacheFile());
+	totalImpleTime = pathsSpan.stop();
+
+	/* The spectrum bitsets. */
+	Telemetry::Span spectrumSpan("spectrum");
+	int maxSlice = instance.getMaxSlice();
+	nbWords = (maxSlice + 63)/64;
+	occupancy.assign(instance.getNbEdges(), std::vector<uint64_t>(nbWords, 0));
+	sliceUsage.assign(maxSlice, 0);
+	for (int e = 0; e < instance.getNbEdges(); e++){
+		const Fiber &fiber = instance.getPhysicalLinkFromIndex(e);
+		for (int s = 0; s < fiber.getNbSlices(); s++){
+			if (fiber.getSlice_i(s).isUsed()){
+				occupancy[e][s/64] |= (uint64_t(1) << (s%64));
+				sliceUsage[s]++;
+			}
+		}
+	}
+	totalChargeTime = spectrumSpan.stop();
+	assignedPath.assign(toBeRouted.size(), -1);
+	assignedSlice.assign(toBeRouted.size(), -1);
+}
+
+/****************************************************************************************/
+/*										Getters											*/
+/****************************************************************************************/
+
+AbstractSolver::Status SolverGreedy::getStatus(){
+	if (escalation){
+		return escalation->getStatus();
+	}
+	return currentStatus;
+}
+
+/* Returns, for each demand of the batch, the last slice of its window (-1 if not routed). */
+std::vector<double> SolverGreedy::getSolution(){
+	if (escalation){
+		return escalation->getSolution();
+	}
+	return std::vector<double>(assignedSlice.begin(), assignedSlice.end());
+}
+
+/****************************************************************************************/
+/*										Spectrum										*/
+/****************************************************************************************/
+
+/* The free blocks of the path are scanned in the union of the bitsets of its fibers, within the slices allowed to the demand. */
+bool SolverGreedy::searchWindow(const Demand &demand, const CachedPath &path, std::pair<long,long> &score, int &slice) const{
+	const Input &input = instance.getInput();
+	int load = demand.getLoad();
+	int first = 0;
+	int last = INT_MAX;
+	std::vector<uint64_t> used(nbWords, 0);
+	for (unsigned int i = 0; i < path.edges.size(); i++){
+		int e = path.edges[i];
+		last = std::min(last, instance.getPhysicalLinkFromIndex(e).getNbSlices());
+		for (int w = 0; w < nbWords; w++){
+			used[w] |= occupancy[e][w];
+		}
+	}
+	if (input.getChosenPartitionPolicy() == Input::PARTITION_POLICY_HARD){
+		if (load <= input.getPartitionLoad()){
+			last = std::min(last, input.getPartitionSlice());
+		}
+		else{
+			first = input.getPartitionSlice();
+		}
+	}
+
+	bool found = false;
+	int s = first;
+	while (s < last){
+		if ((used[s/64] >> (s%64)) & 1){
+			s++;
+			continue;
+		}
+		/* [s, end) is a free block. */
+		int end = s;
+		while (end < last && !((used[end/64] >> (end%64)) & 1)){
+			end++;
+		}
+		int size = end - s;
+		if (size >= load){
+			switch (input.getChosenGreedyFitPolicy()){
+				case Input::GREEDY_FIT_FIRST:{
+					std::pair<long,long> windowScore(-(s + load - 1), 0);
+					if (!found || windowScore > score){
+						score = windowScore;
+						slice = s + load - 1;
+						found = true;
+					}
+					break;
+				}
+				case Input::GREEDY_FIT_LAST:{
+					std::pair<long,long> windowScore(end - 1, 0);
+					if (!found || windowScore > score){
+						score = windowScore;
+						slice = end - 1;
+						found = true;
+					}
+					break;
+				}
+				case Input::GREEDY_FIT_EXACT:{
+					std::pair<long,long> windowScore(-size, -(s + load - 1));
+					if (!found || windowScore > score){
+						score = windowScore;
+						slice = s + load - 1;
+						found = true;
+					}
+					break;
+				}
+				case Input::GREEDY_FIT_MOST_USED:{
+					long usage = 0;
+					for (int j = s; j < s + load; j++){
+						usage += sliceUsage[j];
+					}
+					for (int p = s + load - 1; p < end; p++){
+						if (p >= s + load){
+							usage += sliceUsage[p] - sliceUsage[p - load];
+						}
+						std::pair<long,long> windowScore(usage, -p);
+						if (!found || windowScore > score){
+							score = windowScore;
+							slice = p;
+							found = true;
+						}
+					}
+					break;
+				}
+				default:{
+					std::cout << "ERROR: Invalid greedyFitPolicy." << std::endl;
+					exit(0);
+					break;
+				}
+			}
+		}
+		s = end;
+	}
+	return found;
+}
+
+/* Marks the window ending at slice as occupied on the fibers of a path. */
+void SolverGreedy::occupy(const CachedPath &path, int load, int slice){
+	for (unsigned int i = 0; i < path.edges.size(); i++){
+		int e = path.edges[i];
+		for (int s = slice - load + 1; s <= slice; s++){
+			occupancy[e][s/64] |= (uint64_t(1) << (s%64));
+			sliceUsage[s]++;
+		}
+	}
+}
+
+/****************************************************************************************/
+/*										Methods											*/
+/****************************************************************************************/
+
+/* Each demand takes the best window over its candidate paths; on ties, the shorter path is kept. */
+bool SolverGreedy::route(){
+	int hopPenalty = instance.getInput().getHopPenalty();
+	for (unsigned int d = 0; d < toBeRouted.size(); d++){
+		const Demand &demand = toBeRouted[d];
+		const std::vector<CachedPath> &paths = pathCache->getPaths(demand.getSource(), demand.getTarget());
+		std::pair<long,long> bestScore(0, 0);
+		for (int p = 0; p < std::min(nbPaths, (int)paths.size()); p++){
+			double reach = paths[p].length + hopPenalty*(paths[p].getNbHops() - 1);
+			if (reach >= demand.getMaxLength() + DBL_EPSILON){
+				continue;
+			}
+			std::pair<long,long> score;
+			int slice = -1;
+			if (searchWindow(demand, paths[p], score, slice) && (assignedPath[d] == -1 || score > bestScore)){
+				bestScore = score;
+				assignedPath[d] = p;
+				assignedSlice[d] = slice;
+			}
+		}
+		if (assignedPath[d] == -1){
+			std::cout << "Demand " << demand.getId() + 1 << " cannot be routed by the greedy solver." << std::endl;
+			return false;
+		}
+		occupy(getPath(demand, assignedPath[d]), demand.getLoad(), assignedSlice[d]);
+	}
+	return true;
+}
+
+/* The value is the one of the objective of the formulations (see FlowForm::getObjFunctionFromMetric and RSA::getCoeffObj*), 
+so that it can be compared with the MIP solvers. The bound of each demand ignores the other demands: the best window for the 
+slice objectives, the fewest hops and the shortest path otherwise. */
+void SolverGreedy::estimateGap(){
+	const Input &input = instance.getInput();
+	double value = 0.0;
+	double bound = 0.0;
+	Input::ObjectiveMetric objective = input.getChosenObj_k(0);
+	switch (objective){
+		case Input::OBJECTIVE_METRIC_1p:{
+			/* Sum over the links of their max used slice position, which is at least the one of the previous demands. */
+			std::vector<int> maxSlice(instance.getNbEdges(), 0);
+			int maxBase = 0;
+			for (int e = 0; e < instance.getNbEdges(); e++){
+				maxSlice[e] = std::max(0, instance.getPhysicalLinkFromIndex(e).getMaxUsedSlicePosition());
+				bound += maxSlice[e];
+				maxBase = std::max(maxBase, maxSlice[e]);
+			}
+			/* Each demand raises the max used slice position of a link to the last slice of its window, at least. */
+			double increase = 0.0;
+			for (unsigned int d = 0; d < toBeRouted.size(); d++){
+				const CachedPath &path = getPath(toBeRouted[d], assignedPath[d]);
+				for (unsigned int i = 0; i < path.edges.size(); i++){
+					maxSlice[path.edges[i]] = std::max(maxSlice[path.edges[i]], assignedSlice[d]);
+				}
+				int minIncrease = INT_MAX;
+				for (int e = 0; e < instance.getNbEdges(); e++){
+					int base = std::max(0, instance.getPhysicalLinkFromIndex(e).getMaxUsedSlicePosition());
+					minIncrease = std::min(minIncrease, std::max(0, toBeRouted[d].getLoad() - 1 - base));
+				}
+				increase = std::max(increase, (double)minIncrease);
+			}
+			bound += increase;
+			for (int e = 0; e < instance.getNbEdges(); e++){
+				value += maxSlice[e];
+			}
+			break;
+		}
+		case Input::OBJECTIVE_METRIC_8:{
+			value = std::max(0, instance.getMaxUsedSlicePosition());
+			bound = value;
+			for (unsigned int d = 0; d < toBeRouted.size(); d++){
+				value = std::max(value, (double)assignedSlice[d]);
+				bound = std::max(bound, (double)toBeRouted[d].getLoad() - 1);
+			}
+			break;
+		}
+		default:{
+			for (unsigned int d = 0; d < toBeRouted.size(); d++){
+				const Demand &demand = toBeRouted[d];
+				const CachedPath &path = getPath(demand, assignedPath[d]);
+				switch (objective){
+					case Input::OBJECTIVE_METRIC_1:{
+						/* Under a partition policy, large demands are pushed to the right of the spectrum of the first fiber. */
+						bool right = (input.getChosenPartitionPolicy() != Input::PARTITION_POLICY_NO && demand.getLoad() > input.getPartitionLoad());
+						if (right){
+							value += instance.getPhysicalLinkFromIndex(path.edges[0]).getNbSlices() - assignedSlice[d];
+							bound += 1;
+						}
+						else{
+							value += assignedSlice[d] + 1;
+							bound += demand.getLoad();
+						}
+						break;
+					}
+					case Input::OBJECTIVE_METRIC_2:{
+						value += path.getNbHops();
+						bound += pathCache->getMinNbHops(demand.getSource(), demand.getTarget());
+						break;
+					}
+					case Input::OBJECTIVE_METRIC_2p:{
+						value += demand.getLoad()*path.getNbHops();
+						bound += demand.getLoad()*pathCache->getMinNbHops(demand.getSource(), demand.getTarget());
+						break;
+					}
+					case Input::OBJECTIVE_METRIC_4:{
+						value += path.length;
+						bound += getPath(demand, 0).length;
+						break;
+					}
+					default:{
+						break;
+					}
+				}
+			}
+			break;
+		}
+	}
+	setUpperBound(value);
+	setLowerBound(bound);
+	setMipGap(bound, value);
+}
+
+/* Solves the batch with the MIP solver chosen for escalation. */
+void SolverGreedy::escalate(){
+	std::cout << "Escalating the batch to the MIP solver." << std::endl;
+	SolverFactory factory;
+	Telemetry::Span buildSpan("build");
+	escalation.reset(factory.createSolver(instance, instance.getInput().getGreedyMIPSolver()));
+	buildSpan.stop();
+	escalation->solve();
+	totalChargeTime += escalation->getTotalChargeTime();
+	totalImpleTime += escalation->getTotalImpleTime();
+	setUpperBound(escalation->getUpperBound());
+	setLowerBound(escalation->getLowerBound());
+	setMipGap(escalation->getMipGap());
+	setTreeSize(escalation->getTreeSize());
+}
+
+void SolverGreedy::solve(){
+	ClockTime solveTime(ClockTime::getTimeNow());
+	std::cout << "Solving with the greedy solver..." << std::endl;
+	Telemetry::Span greedySpan("greedy");
+	bool routed = route();
+	greedySpan.stop();
+	if (routed){
+		estimateGap();
+		setStatus((getMipGap() <= EPS) ? STATUS_OPTIMAL : STATUS_FEASIBLE);
+		std::cout << "Greedy objective value: " << getUpperBound() << " (gap estimate " << getMipGap() << ")" << std::endl;
+	}
+	else{
+		setStatus(STATUS_INFEASIBLE);
+	}
+
+	const Input &input = instance.getInput();
+	if (input.isGreedyAdmission()){
+		bool gapTooLarge = (routed && input.getGreedyGapThreshold() >= 0 && getMipGap() > input.getGreedyGapThreshold());
+		if (!routed || gapTooLarge){
+			escalate();
+		}
+	}
+	setDurationTime(solveTime.getTimeInSecFromStart());
+}
+
+/* Assigns the slices of the routed demands directly on the instance and moves to the next demands, as RSA::updateInstance does. */
+void SolverGreedy::updateRSA(Instance &i){
+	if (escalation){
+		escalation->updateRSA(i);
+		return;
+	}
+	std::cout << "Update RSA" << std::endl;
+	if (getStatus() == STATUS_OPTIMAL || getStatus() == STATUS_FEASIBLE){
+		std::cout << "Feasible" << std::endl;
+		for (unsigned int d = 0; d < toBeRouted.size(); d++){
+			const Demand &demand = i.getTabDemand()[toBeRouted[d].getId()];
+			const CachedPath &path = getPath(demand, assignedPath[d]);
+			for (unsigned int e = 0; e < path.edges.size(); e++){
+				i.assignSlicesOfLink(path.edges[e], assignedSlice[d], demand);
+			}
+		}
+		i.displaySlices();
+
+		int nextDemandToBeRouted = i.getNextDemandToBeRoutedIndex() + (int)toBeRouted.size();
+		if (i.getInput().isBlockingAllowed()){
+			if (i.getWasBlocked() == true){
+				nextDemandToBeRouted++;
+			}
+			i.setNbDemandsAtOnce(i.getInput().getNbDemandsAtOnce());
+		}
+		else{
+			if (i.getWasBlocked() == true){
+				i.setNbDemandsAtOnce(0);
+			}
+		}
+		i.setNextDemandToBeRoutedIndex(nextDemandToBeRouted);
+		i.setWasBlocked(false);
+	}
+	else{
+		std::cout << "Decrease the number of demands to be treated." << std::endl;
+		i.decreaseNbDemandsAtOnce();
+		i.setWasBlocked(true);
+	}
+}
+
+/* Appends the main results to the file log_results.csv. */
+void SolverGreedy::outputLogResults(std::string fileName){
+	if (escalation){
+		escalation->outputLogResults(fileName);
+		return;
+	}
+	std::string delimiter = ";";
+	std::string filePath = instance.getInput().getOutputPath() + "log_results.csv";
+	std::ofstream myfile(filePath.c_str(), std::ios_base::app);
+	if (myfile.is_open()){
+		myfile << fileName << delimiter;
+		myfile << getStatus() << delimiter;
+		myfile << getDurationTime() << delimiter;
+		myfile << getLowerBound() << delimiter;
+		myfile << getUpperBound() << delimiter;
+		myfile << getMipGap() << delimiter;
+		myfile << getTreeSize() << "\n";
+		myfile.close();
+	}
+	else{
+		std::cerr << "Unable to open file " << filePath << "\n";
+	}
+}
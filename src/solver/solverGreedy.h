@@ -0,0 +1,93 @@
+#ifndef __solverGreedy__h
+#define __solverGreedy__h
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+#include "abstractSolver.h"
+#include "../tools/pathCache.h"
+
+/***********************************************************************************************
+* This class implements a greedy RSA engine. The demands of the batch are routed one by one, in
+* their order, on one of their k shortest paths in the compact graph (see PathCache) that
+* respects their reach. The occupied slices of each fiber are kept in a bitset: the free
+* windows of a path are read from the union of the bitsets of its fibers, and the window is
+* chosen according to the fit policy. As with the MIP solvers, the batch is
+* either entirely routed or blocked. When the admission filter is on, the batch is only solved
+* with a MIP solver if the greedy solver blocks it or if its gap estimate exceeds a threshold.
+************************************************************************************************/
+class SolverGreedy : public AbstractSolver{
+
+private:
+	const Instance &instance;					/**< The instance to be solved. **/
+	std::vector<Demand> toBeRouted;				/**< The demands of the batch. **/
+
+	std::shared_ptr<const PathCache> pathCache;	/**< The k shortest paths of every pair of nodes. **/
+	int nbPaths;								/**< Number of candidate paths per demand. **/
+
+	int nbWords;								/**< Number of 64-bit words of the spectrum bitsets. **/
+	std::vector< std::vector<uint64_t> > occupancy;	/**< Bitset of the occupied slices of each fiber. **/
+	std::vector<int> sliceUsage;				/**< Number of fibers on which each slice is occupied. **/
+
+	std::vector<int> assignedPath;				/**< Index of the candidate path of each demand of the batch (-1 if not routed). **/
+	std::vector<int> assignedSlice;				/**< Last slice of the window of each demand of the batch (-1 if not routed). **/
+
+	std::unique_ptr<AbstractSolver> escalation;	/**< The MIP solver the batch was escalated to (NULL if none). **/
+
+public:
+	/****************************************************************************************/
+	/*										Constructors									*/
+	/****************************************************************************************/
+
+	/** Constructor. Gets the candidate paths of the topology and builds the spectrum bitsets. @param instance The instance to be solved. **/
+	SolverGreedy(const Instance &instance);
+
+	/****************************************************************************************/
+	/*										Getters											*/
+	/****************************************************************************************/
+
+	AbstractSolver::Status getStatus() override;
+
+	/** Returns, for each demand of the batch, the last slice of its window (-1 if not routed). **/
+	std::vector<double> getSolution() override;
+
+	/** Returns if the batch was escalated to a MIP solver. **/
+	bool isEscalated() const { return (escalation != nullptr); }
+
+	/****************************************************************************************/
+	/*										Methods											*/
+	/****************************************************************************************/
+
+	/** Routes the demands of the batch and, if the admission filter is on and the result is not good enough, solves the batch with the MIP solver. **/
+	void solve() override;
+
+	/** There is no formulation to implement. **/
+	void implementFormulation() override {}
+
+	/** Assigns the slices of the routed demands directly on the instance and moves to the next demands, as RSA::updateInstance does. **/
+	void updateRSA(Instance &instance) override;
+
+	/** Appends the main results to the file log_results.csv. **/
+	void outputLogResults(std::string fileName) override;
+
+private:
+	/** Returns the candidate path of index p of a demand. **/
+	const CachedPath & getPath(const Demand &demand, int p) const { return pathCache->getPaths(demand.getSource(), demand.getTarget())[p]; }
+
+	/** Searches the best free window of a path for a demand according to the fit policy. Returns false if there is none. @param score The score of the window found, the higher the better. @param slice The last slice of the window found. **/
+	bool searchWindow(const Demand &demand, const CachedPath &path, std::pair<long,long> &score, int &slice) const;
+
+	/** Marks the window ending at slice as occupied on the fibers of a path. **/
+	void occupy(const CachedPath &path, int load, int slice);
+
+	/** Routes the demands of the batch. Returns false as soon as one of them cannot be routed. **/
+	bool route();
+
+	/** Computes the greedy objective value and a lower bound on it, and updates the bounds and the gap estimate. **/
+	void estimateGap();
+
+	/** Solves the batch with the MIP solver. **/
+	void escalate();
+};
+#endif
@@ -4,27 +4,31 @@
 #include <bits/stdc++.h> 
 #include <chrono> 
 
-using namespace std::chrono::_V2;
 /************************************************************
- * This class is used to control time spent by the program. 						
+ * This class is used to control time spent by the program. 
+ * It relies on the monotonic steady_clock, so that measured 
+ * durations are not affected by changes of the system time.
 ************************************************************/
 class ClockTime {
+
+public:
+    typedef std::chrono::steady_clock::time_point TimePoint;
     
 private:
-    system_clock::time_point START; /**< Records a specific time point in history. **/
+    TimePoint START; /**< Records a specific time point in history. **/
 
 public:
     /** Constructor. @param t A time point in history. **/
-    ClockTime(const system_clock::time_point &t) : START(t) {};
+    ClockTime(const TimePoint &t) : START(t) {};
 
     /** Returns the time point stored in START attribute. **/
-    system_clock::time_point getStart() const { return START; }
+    TimePoint getStart() const { return START; }
     
     /** Changes the time point stored in START attribute. **/
-    void setStart(const std::chrono::_V2::system_clock::time_point &t){ START = t; }
+    void setStart(const TimePoint &t){ START = t; }
 
     /** Returns the current time point. **/
-    static system_clock::time_point getTimeNow() { return std::chrono::high_resolution_clock::now(); }
+    static TimePoint getTimeNow() { return std::chrono::steady_clock::now(); }
     
     /** Returns the time in seconds spent from START until now. **/
     double getTimeInSecFromStart() const { 
@@ -33,4 +37,4 @@ public:
     
 };
 
-#endif
\ No newline at end of file
+#endif
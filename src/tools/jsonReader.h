@@ -0,0 +1,162 @@
+#ifndef JSON_READER_H
+#define JSON_READER_H
+
+#include <cctype>
+#include <istream>
+#include <string>
+
+/***********************************************************************************************
+ * Minimal streaming JSON tokenizer. Tokens are read one at a time from a stream (a file or a
+ * pipe) and nothing but the current token is kept in memory: the caller follows the nesting of
+ * objects and arrays itself. Object keys are returned as KEY tokens (the string followed by its
+ * colon), so a member is a KEY token followed by its value. Separators are skipped.
+ * ********************************************************************************************/
+class JsonReader{
+
+    public:
+        /** Kinds of tokens. **/
+        enum Token {
+            BEGIN_OBJECT = 0,
+            END_OBJECT = 1,
+            BEGIN_ARRAY = 2,
+            END_ARRAY = 3,
+            KEY = 4,            /**< The key of an object member. **/
+            STRING = 5,
+            NUMBER = 6,
+            LITERAL = 7,        /**< true, false or null. **/
+            END = 8,            /**< End of the stream. **/
+            ERROR = 9           /**< Malformed input. Reading stops there. **/
+        };
+
+    private:
+        std::istream &in;       /**< Where the JSON is read. **/
+        std::string current;    /**< Text of the last KEY, STRING, NUMBER or LITERAL token. **/
+        bool failed;            /**< True once an ERROR token has been returned. **/
+
+        /** Skips blanks and separators. Returns the next significant character without extracting it (EOF if none). **/
+        int peekToken(){
+            int c = in.peek();
+            while (c != EOF && (std::isspace(c) || c == ',' || c == ':')){
+                in.get();
+                c = in.peek();
+            }
+            return c;
+        }
+
+        /** Appends a code point to the current text in UTF-8. **/
+        void appendUtf8(unsigned int code){
+            if (code < 0x80){
+                current += (char)code;
+            }
+            else if (code < 0x800){
+                current += (char)(0xC0 | (code >> 6));
+                current += (char)(0x80 | (code & 0x3F));
+            }
+            else{
+                current += (char)(0xE0 | (code >> 12));
+                current += (char)(0x80 | ((code >> 6) & 0x3F));
+                current += (char)(0x80 | (code & 0x3F));
+            }
+        }
+
+        /** Reads a string whose opening quote was extracted. Returns false if it is not terminated. **/
+        bool readString(){
+            current.clear();
+            int c = in.get();
+            while (c != EOF && c != '"'){
+                if (c == '\\'){
+                    c = in.get();
+                    switch (c){
+                        case 'n': current += '\n'; break;
+                        case 't': current += '\t'; break;
+                        case 'r': current += '\r'; break;
+                        case 'b': current += '\b'; break;
+                        case 'f': current += '\f'; break;
+                        case 'u': {
+                            unsigned int code = 0;
+                            for (int i = 0; i < 4; i++){
+                                int h = in.get();
+                                if (h == EOF || !std::isxdigit(h)){
+                                    return false;
+                                }
+                                code = 16*code + (std::isdigit(h) ? h - '0' : std::tolower(h) - 'a' + 10);
+                            }
+                            appendUtf8(code);
+                            break;
+                        }
+                        case EOF: return false;
+                        default: current += (char)c; break;
+                    }
+                }
+                else{
+                    current += (char)c;
+                }
+                c = in.get();
+            }
+            return (c == '"');
+        }
+
+        /** Reads a number or a literal: the characters up to the next blank, separator or bracket. **/
+        void readWord(){
+            current.clear();
+            int c = in.peek();
+            while (c != EOF && !std::isspace(c) && c != ',' && c != ':' && c != '}' && c != ']'){
+                current += (char)in.get();
+                c = in.peek();
+            }
+        }
+
+    public:
+        JsonReader(std::istream &s):in(s),failed(false){}
+
+        /** Reads the next token. **/
+        Token next(){
+            if (failed){
+                return ERROR;
+            }
+            int c = peekToken();
+            if (c == EOF){
+                return END;
+            }
+            in.get();
+            switch (c){
+                case '{': return BEGIN_OBJECT;
+                case '}': return END_OBJECT;
+                case '[': return BEGIN_ARRAY;
+                case ']': return END_ARRAY;
+                case '"': {
+                    if (!readString()){
+                        failed = true;
+                        return ERROR;
+                    }
+                    /* A string followed by a colon is a key. Blanks may stand in between. */
+                    int after = in.peek();
+                    while (after != EOF && std::isspace(after)){
+                        in.get();
+                        after = in.peek();
+                    }
+                    if (after == ':'){
+                        in.get();
+                        return KEY;
+                    }
+                    return STRING;
+                }
+                default:
+                    in.unget();
+                    readWord();
+                    if (current == "true" || current == "false" || current == "null"){
+                        return LITERAL;
+                    }
+                    if (!current.empty() && (c == '-' || std::isdigit(c))){
+                        return NUMBER;
+                    }
+                    failed = true;
+                    return ERROR;
+            }
+        }
+
+        /** Returns the text of the last KEY, STRING, NUMBER or LITERAL token. **/
+        const std::string & text() const { return current; }
+};
+
+#endif
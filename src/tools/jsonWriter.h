@@ -0,0 +1,78 @@
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/***********************************************************************************************
+ * Minimal JSON writer streaming its output to a FILE (a file or a pipe). Nothing is built in
+ * memory: each call writes its token right away and the separators between the members of an
+ * object or an array are added automatically.
+ * ********************************************************************************************/
+class JsonWriter{
+
+    private:
+        FILE *out;                      /**< Where the JSON is written. **/
+        std::vector<bool> isFirst;      /**< For each open object or array, true if no member has been written yet. **/
+        bool afterKey;                  /**< True if a key has just been written, so that no separator precedes the value. **/
+
+        /** Writes the separator preceding a new member. **/
+        void separate(){
+            if (afterKey){
+                afterKey = false;
+                return;
+            }
+            if (!isFirst.empty()){
+                if (!isFirst.back()){
+                    fputc(',', out);
+                }
+                isFirst.back() = false;
+            }
+        }
+
+        /** Writes an escaped string. **/
+        void writeString(const std::string &s){
+            fputc('"', out);
+            for (unsigned int i = 0; i < s.size(); i++){
+                char c = s[i];
+                if (c == '"' || c == '\\'){
+                    fputc('\\', out);
+                    fputc(c, out);
+                }
+                else if (c == '\n'){
+                    fputs("\\n", out);
+                }
+                else if ((unsigned char)c < 0x20){
+                    fprintf(out, "\\u%04x", (unsigned int)(unsigned char)c);
+                }
+                else{
+                    fputc(c, out);
+                }
+            }
+            fputc('"', out);
+        }
+
+    public:
+        JsonWriter(FILE *f):out(f),afterKey(false){}
+
+        void beginObject() { separate(); fputc('{', out); isFirst.push_back(true); }
+        void endObject() { isFirst.pop_back(); fputc('}', out); }
+        void beginArray() { separate(); fputc('[', out); isFirst.push_back(true); }
+        void endArray() { isFirst.pop_back(); fputc(']', out); }
+
+        /** Writes the key of the next member of an object. **/
+        void key(const std::string &name) { separate(); writeString(name); fputc(':', out); afterKey = true; }
+
+        void value(const std::string &s) { separate(); writeString(s); }
+        void value(int i) { separate(); fprintf(out, "%d", i); }
+        void value(long long i) { separate(); fprintf(out, "%lld", i); }
+        void value(double d) { separate(); fprintf(out, "%.9g", d); }
+        void value(bool b) { separate(); fputs(b ? "true" : "false", out); }
+        void nullValue() { separate(); fputs("null", out); }
+
+        /** Writes a number given as text (as read from the demand files). An empty text is written as null. **/
+        void number(const std::string &s) { separate(); fputs(s.empty() ? "null" : s.c_str(), out); }
+};
+
+#endif
@@ -0,0 +1,27 @@
+#include "memoryUsage.h"
+
+#include <cstdio>
+#include <sys/resource.h>
+#include <unistd.h>
+
+/* The second field of /proc/self/statm is the number of resident pages. */
+long MemoryUsage::getCurrentRSS(){
+    FILE *file = fopen("/proc/self/statm", "r");
+    if (file == NULL){
+        return 0;
+    }
+    long size = 0, resident = 0;
+    if (fscanf(file, "%ld %ld", &size, &resident) != 2){
+        resident = 0;
+    }
+    fclose(file);
+    return resident*(sysconf(_SC_PAGESIZE)/1024);
+}
+
+long MemoryUsage::getPeakRSS(){
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0){
+        return 0;
+    }
+    return usage.ru_maxrss;
+}
@@ -0,0 +1,48 @@
+#ifndef __MemoryUsage__h
+#define __MemoryUsage__h
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/************************************************************
+ * Memory accounting. The resident set size of the process
+ * is read from the system; the size of the main structures
+ * is estimated from their capacity, since they are made of
+ * standard containers and LEMON graphs and maps.
+************************************************************/
+class MemoryUsage {
+
+public:
+    /** Returns the current resident set size of the process, in kB (0 if unavailable). **/
+    static long getCurrentRSS();
+
+    /** Returns the peak resident set size of the process, in kB. **/
+    static long getPeakRSS();
+
+    /** Returns the bytes allocated on the heap by a string. Up to 15 characters are kept in the string itself (libstdc++). **/
+    static std::size_t ofString(const std::string &s) { return (s.capacity() > 15) ? s.capacity() + 1 : 0; }
+
+    /** Returns the bytes allocated by a vector for its elements, not counting what the elements allocate themselves. **/
+    template <typename T, typename A>
+    static std::size_t ofVector(const std::vector<T, A> &v) { return v.capacity()*sizeof(T); }
+
+    /** Returns the bytes allocated by a vector of bool. **/
+    template <typename A>
+    static std::size_t ofVector(const std::vector<bool, A> &v) { return v.capacity()/8; }
+
+    /** Returns the bytes allocated by a LEMON ListDigraph: 4 integers per node and 6 per arc, erased items included
+     * since their slots are only recycled. **/
+    template <typename GR>
+    static std::size_t ofListDigraph(const GR &g) { return (g.maxNodeId() + 1)*4*sizeof(int) + (g.maxArcId() + 1)*6*sizeof(int); }
+
+    /** Returns the bytes allocated by a LEMON arc map whose values have the given size. **/
+    template <typename GR>
+    static std::size_t ofArcMap(const GR &g, std::size_t valueSize) { return (g.maxArcId() + 1)*valueSize; }
+
+    /** Returns the bytes allocated by a LEMON node map whose values have the given size. **/
+    template <typename GR>
+    static std::size_t ofNodeMap(const GR &g, std::size_t valueSize) { return (g.maxNodeId() + 1)*valueSize; }
+};
+
+#endif
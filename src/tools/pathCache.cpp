@@ -0,0 +1,304 @@
+#include "pathCache.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cfloat>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <queue>
+#include <sstream>
+#include <thread>
+
+std::shared_ptr<PathCache> PathCache::shared;
+std::mutex PathCache::sharedMutex;
+
+/****************************************************************************************/
+/*                                     Constructor                                      */
+/****************************************************************************************/
+
+PathCache::PathCache(const std::vector<Fiber> &edges, int n, int nbPaths) : nbNodes(n), k(nbPaths), signature(getSignature(edges, n)), tabEdge(edges){
+    incidentEdges.resize(nbNodes);
+    for (unsigned int e = 0; e < tabEdge.size(); e++){
+        incidentEdges[tabEdge[e].getSource()].push_back(e);
+        incidentEdges[tabEdge[e].getTarget()].push_back(e);
+    }
+    paths.resize(nbNodes*nbNodes);
+    minNbHops.assign(nbNodes*nbNodes, -1);
+}
+
+/* The shared cache is replaced when the topology changes or when more paths are needed. */
+std::shared_ptr<const PathCache> PathCache::getCache(const std::vector<Fiber> &edges, int nbNodes, int k, const std::string &fileName){
+    std::lock_guard<std::mutex> lock(sharedMutex);
+    if (shared && shared->getK() >= k && shared->nbNodes == nbNodes && shared->signature == getSignature(edges, nbNodes)){
+        return shared;
+    }
+    std::shared_ptr<PathCache> cache = std::make_shared<PathCache>(edges, nbNodes, k);
+    if (fileName.empty() || !cache->load(fileName)){
+        cache->compute();
+        if (!fileName.empty()){
+            cache->save(fileName);
+        }
+    }
+    shared = cache;
+    return shared;
+}
+
+std::string PathCache::getSignature(const std::vector<Fiber> &edges, int nbNodes){
+    std::ostringstream signature;
+    signature << nbNodes;
+    signature << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for (unsigned int e = 0; e < edges.size(); e++){
+        signature << "|" << edges[e].getSource() << "-" << edges[e].getTarget() << ":" << edges[e].getLength();
+    }
+    return signature.str();
+}
+
+/****************************************************************************************/
+/*                                        Paths                                         */
+/****************************************************************************************/
+
+/* Dijkstra's algorithm. Ties are broken by node label, so that the paths do not depend on the heap. */
+bool PathCache::shortestPath(int source, int target, const std::vector<bool> &bannedEdges, const std::vector<bool> &bannedNodes, CachedPath &path) const{
+    std::vector<double> dist(nbNodes, DBL_MAX);
+    std::vector<int> predEdge(nbNodes, -1);
+    std::vector<bool> processed(nbNodes, false);
+    std::priority_queue< std::pair<double,int>, std::vector< std::pair<double,int> >, std::greater< std::pair<double,int> > > heap;
+    dist[source] = 0.0;
+    heap.push(std::make_pair(0.0, source));
+    while (!heap.empty()){
+        int u = heap.top().second;
+        heap.pop();
+        if (processed[u]){
+            continue;
+        }
+        processed[u] = true;
+        if (u == target){
+            break;
+        }
+        for (unsigned int i = 0; i < incidentEdges[u].size(); i++){
+            int e = incidentEdges[u][i];
+            if (bannedEdges[e]){
+                continue;
+            }
+            int v = (tabEdge[e].getSource() == u) ? tabEdge[e].getTarget() : tabEdge[e].getSource();
+            if (bannedNodes[v] || processed[v]){
+                continue;
+            }
+            double distance = dist[u] + tabEdge[e].getLength();
+            if (distance < dist[v]){
+                dist[v] = distance;
+                predEdge[v] = e;
+                heap.push(std::make_pair(distance, v));
+            }
+        }
+    }
+    if (!processed[target]){
+        return false;
+    }
+    path.edges.clear();
+    path.length = dist[target];
+    for (int v = target; v != source; ){
+        int e = predEdge[v];
+        path.edges.push_back(e);
+        v = (tabEdge[e].getSource() == v) ? tabEdge[e].getTarget() : tabEdge[e].getSource();
+    }
+    std::reverse(path.edges.begin(), path.edges.end());
+    path.nodes = getNodes(source, path.edges);
+    return true;
+}
+
+/* Yen's algorithm: the i-th path deviates from one of the previous ones at some spur node, after which it follows a shortest path avoiding the fibers already used at that node by the paths sharing the same root. */
+std::vector<CachedPath> PathCache::kShortestPaths(int source, int target) const{
+    std::vector<CachedPath> found;
+    std::vector<CachedPath> candidates;
+    std::vector<bool> bannedEdges(tabEdge.size(), false);
+    std::vector<bool> bannedNodes(nbNodes, false);
+    CachedPath path;
+    if (!shortestPath(source, target, bannedEdges, bannedNodes, path)){
+        return found;
+    }
+    found.push_back(path);
+    while ((int)found.size() < k){
+        const CachedPath previous = found.back();
+        for (unsigned int i = 0; i < previous.edges.size(); i++){
+            std::fill(bannedEdges.begin(), bannedEdges.end(), false);
+            std::fill(bannedNodes.begin(), bannedNodes.end(), false);
+            for (unsigned int p = 0; p < found.size(); p++){
+                if (found[p].edges.size() > i && std::equal(previous.edges.begin(), previous.edges.begin() + i, found[p].edges.begin())){
+                    bannedEdges[found[p].edges[i]] = true;
+                }
+            }
+            double rootLength = 0.0;
+            for (unsigned int j = 0; j < i; j++){
+                bannedNodes[previous.nodes[j]] = true;
+                rootLength += tabEdge[previous.edges[j]].getLength();
+            }
+            CachedPath spur;
+            if (!shortestPath(previous.nodes[i], target, bannedEdges, bannedNodes, spur)){
+                continue;
+            }
+            CachedPath candidate;
+            candidate.nodes.assign(previous.nodes.begin(), previous.nodes.begin() + i);
+            candidate.nodes.insert(candidate.nodes.end(), spur.nodes.begin(), spur.nodes.end());
+            candidate.edges.assign(previous.edges.begin(), previous.edges.begin() + i);
+            candidate.edges.insert(candidate.edges.end(), spur.edges.begin(), spur.edges.end());
+            candidate.length = rootLength + spur.length;
+            bool known = false;
+            for (unsigned int c = 0; c < candidates.size() && !known; c++){
+                known = (candidates[c].edges == candidate.edges);
+            }
+            if (!known){
+                candidates.push_back(candidate);
+            }
+        }
+        if (candidates.empty()){
+            break;
+        }
+        /* The shortest candidate, the one with fewer hops on ties. */
+        unsigned int best = 0;
+        for (unsigned int c = 1; c < candidates.size(); c++){
+            if (candidates[c].length < candidates[best].length || (candidates[c].length == candidates[best].length && candidates[c].edges.size() < candidates[best].edges.size())){
+                best = c;
+            }
+        }
+        found.push_back(candidates[best]);
+        candidates.erase(candidates.begin() + best);
+    }
+    return found;
+}
+
+/* The graph is undirected: the paths from target to source are the reversed paths from source to target. */
+void PathCache::computeFrom(int source){
+    /* Breadth-first search for the hop counts. */
+    std::vector<int> hops(nbNodes, -1);
+    std::queue<int> queue;
+    hops[source] = 0;
+    queue.push(source);
+    while (!queue.empty()){
+        int u = queue.front();
+        queue.pop();
+        for (unsigned int i = 0; i < incidentEdges[u].size(); i++){
+            int e = incidentEdges[u][i];
+            int v = (tabEdge[e].getSource() == u) ? tabEdge[e].getTarget() : tabEdge[e].getSource();
+            if (hops[v] == -1){
+                hops[v] = hops[u] + 1;
+                queue.push(v);
+            }
+        }
+    }
+    for (int target = source + 1; target < nbNodes; target++){
+        minNbHops[source*nbNodes + target] = hops[target];
+        minNbHops[target*nbNodes + source] = hops[target];
+        std::vector<CachedPath> &forward = paths[source*nbNodes + target];
+        std::vector<CachedPath> &backward = paths[target*nbNodes + source];
+        forward = kShortestPaths(source, target);
+        backward = forward;
+        for (unsigned int p = 0; p < backward.size(); p++){
+            std::reverse(backward[p].nodes.begin(), backward[p].nodes.end());
+            std::reverse(backward[p].edges.begin(), backward[p].edges.end());
+        }
+    }
+    minNbHops[source*nbNodes + source] = 0;
+}
+
+/* Sources are handed out one at a time: the first ones have more pairs to compute. */
+void PathCache::compute(){
+    std::atomic<int> nextSource(0);
+    std::function<void()> worker = [this, &nextSource](){
+        for (int source = nextSource++; source < nbNodes; source = nextSource++){
+            computeFrom(source);
+        }
+    };
+    int nbThreads = std::max(1, std::min((int)std::thread::hardware_concurrency(), nbNodes));
+    std::vector<std::thread> threads;
+    for (int t = 1; t < nbThreads; t++){
+        threads.push_back(std::thread(worker));
+    }
+    worker();
+    for (unsigned int t = 0; t < threads.size(); t++){
+        threads[t].join();
+    }
+    std::cout << "Path cache: " << k << " shortest paths computed for " << nbNodes*(nbNodes - 1) << " node pairs with " << nbThreads << " threads." << std::endl;
+}
+
+std::vector<int> PathCache::getNodes(int source, const std::vector<int> &edges) const{
+    std::vector<int> nodes(1, source);
+    for (unsigned int i = 0; i < edges.size(); i++){
+        int u = nodes.back();
+        nodes.push_back((tabEdge[edges[i]].getSource() == u) ? tabEdge[edges[i]].getTarget() : tabEdge[edges[i]].getSource());
+    }
+    return nodes;
+}
+
+/****************************************************************************************/
+/*                                        Files                                         */
+/****************************************************************************************/
+
+/* The first line is "S k signature"; each other line is a path "P source target length fiber1 fiber2 ...", or a hop count "H source target hops". Paths are listed by increasing length. */
+bool PathCache::load(const std::string &fileName){
+    std::ifstream input(fileName.c_str());
+    if (!input.is_open()){
+        return false;
+    }
+    std::string line;
+    std::ostringstream header;
+    header << "S " << k << " " << signature;
+    if (!std::getline(input, line) || line != header.str()){
+        std::cout << "Path cache: " << fileName << " was written for another topology or number of paths." << std::endl;
+        return false;
+    }
+    int nbPaths = 0;
+    while (std::getline(input, line)){
+        std::istringstream fields(line);
+        std::string type;
+        int source, target;
+        if (!(fields >> type >> source >> target) || source < 0 || source >= nbNodes || target < 0 || target >= nbNodes){
+            continue;
+        }
+        if (type == "H"){
+            fields >> minNbHops[source*nbNodes + target];
+        }
+        else if (type == "P"){
+            std::string length;
+            fields >> length;
+            CachedPath path;
+            path.length = std::strtod(length.c_str(), NULL);
+            int e;
+            while (fields >> e && e >= 0 && e < (int)tabEdge.size()){
+                path.edges.push_back(e);
+            }
+            path.nodes = getNodes(source, path.edges);
+            paths[source*nbNodes + target].push_back(path);
+            nbPaths++;
+        }
+    }
+    std::cout << "Path cache: " << nbPaths << " paths loaded from " << fileName << "." << std::endl;
+    return true;
+}
+
+void PathCache::save(const std::string &fileName) const{
+    std::ofstream output(fileName.c_str(), std::ios::trunc);
+    if (!output.is_open()){
+        std::cout << "WARNING: Could not write the path cache to " << fileName << "." << std::endl;
+        return;
+    }
+    output << "S " << k << " " << signature << "\n";
+    output << std::setprecision(std::numeric_limits<double>::max_digits10);
+    for (int source = 0; source < nbNodes; source++){
+        for (int target = 0; target < nbNodes; target++){
+            output << "H " << source << " " << target << " " << minNbHops[source*nbNodes + target] << "\n";
+            const std::vector<CachedPath> &pairPaths = paths[source*nbNodes + target];
+            for (unsigned int p = 0; p < pairPaths.size(); p++){
+                output << "P " << source << " " << target << " " << pairPaths[p].length;
+                for (unsigned int i = 0; i < pairPaths[p].edges.size(); i++){
+                    output << " " << pairPaths[p].edges[i];
+                }
+                output << "\n";
+            }
+        }
+    }
+}
@@ -0,0 +1,83 @@
+#ifndef __PathCache__h
+#define __PathCache__h
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "../topology/physicalLink.h"
+
+/** A path of the compact graph (one node per node label, one edge per fiber). **/
+struct CachedPath {
+    std::vector<int> nodes;     /**< Labels of the nodes visited, from source to target. **/
+    std::vector<int> edges;     /**< Indices of the fibers crossed, from source to target. **/
+    double length;              /**< Sum of the fiber lengths. **/
+
+    /** Returns the number of hops of the path. **/
+    int getNbHops() const { return (int)edges.size(); }
+};
+
+/************************************************************************************************************
+ * The k shortest loopless paths (Yen's algorithm) of every pair of node labels of the compact graph, with
+ * their lengths and hop counts, and the minimum number of hops of every pair. The topology does not change
+ * during a run: the paths are computed once, in parallel over the source nodes, and shared by every user
+ * (greedy solver, demand generator) through getCache. They can be persisted in a file, read back as long
+ * as the topology and k are the same.
+ ************************************************************************************************************/
+class PathCache {
+
+private:
+    int nbNodes;                                        /**< Number of node labels. **/
+    int k;                                              /**< Maximum number of paths per pair. **/
+    std::string signature;                              /**< Identifies the topology. **/
+    std::vector<Fiber> tabEdge;                         /**< The fibers of the topology. **/
+    std::vector< std::vector<int> > incidentEdges;      /**< Indices of the fibers incident to each node label. **/
+    std::vector< std::vector<CachedPath> > paths;       /**< The paths of each pair, indexed by source*nbNodes + target. **/
+    std::vector<int> minNbHops;                         /**< The minimum number of hops of each pair (-1 if unreachable). **/
+
+    static std::shared_ptr<PathCache> shared;           /**< The cache of the last topology requested. **/
+    static std::mutex sharedMutex;                      /**< Protects the shared cache. **/
+
+    /** Computes a shortest path avoiding the banned fibers and nodes. Returns false if the target cannot be reached. **/
+    bool shortestPath(int source, int target, const std::vector<bool> &bannedEdges, const std::vector<bool> &bannedNodes, CachedPath &path) const;
+
+    /** Computes the k shortest loopless paths from source to target. **/
+    std::vector<CachedPath> kShortestPaths(int source, int target) const;
+
+    /** Computes the paths and hop counts of the pairs whose source is the given node, and the reverse pairs. **/
+    void computeFrom(int source);
+
+    /** Returns the node sequence of a path given by its fibers. **/
+    std::vector<int> getNodes(int source, const std::vector<int> &edges) const;
+
+public:
+    /** Constructor. The paths are then computed by compute or read by load. @param edges The fibers. @param nbNodes The number of node labels. @param k The number of paths per pair. **/
+    PathCache(const std::vector<Fiber> &edges, int nbNodes, int k);
+
+    /** Returns the cache of a topology with at least k paths per pair. It is computed (or read from the file, if one is given) only if the topology changed or has fewer paths. @param fileName File where the paths are persisted (empty if none). **/
+    static std::shared_ptr<const PathCache> getCache(const std::vector<Fiber> &edges, int nbNodes, int k, const std::string &fileName = "");
+
+    /** Returns the signature of a topology: its number of nodes and the end nodes and length of each fiber. **/
+    static std::string getSignature(const std::vector<Fiber> &edges, int nbNodes);
+
+    /** Returns the number of paths per pair. **/
+    int getK() const { return k; }
+
+    /** Returns the paths from source to target, by increasing length (empty if target is unreachable). **/
+    const std::vector<CachedPath> & getPaths(int source, int target) const { return paths[source*nbNodes + target]; }
+
+    /** Returns the minimum number of hops from source to target (-1 if unreachable). **/
+    int getMinNbHops(int source, int target) const { return minNbHops[source*nbNodes + target]; }
+
+    /** Computes the paths and hop counts of every pair, with one thread per core. **/
+    void compute();
+
+    /** Reads the paths from a file. Returns false if the file does not exist or was written for another topology or k. **/
+    bool load(const std::string &fileName);
+
+    /** Writes the paths to a file. **/
+    void save(const std::string &fileName) const;
+};
+
+#endif
@@ -0,0 +1,36 @@
+#include "shortestPathPool.h"
+
+/* Resets the entries of the nodes touched by the previous run and grows the arrays if the graph has grown. */
+void ShortestPathWorkspace::reset(int maxNodeId){
+    for (unsigned int i = 0; i < touched.size(); i++){
+        state[touched[i]] = UNREACHED;
+        predArc[touched[i]] = -1;
+    }
+    touched.clear();
+    heap.clear();
+    unsigned int nbNodes = (unsigned int)(maxNodeId + 1);
+    if(state.size() < nbNodes){
+        dist.resize(nbNodes, 0.0);
+        predArc.resize(nbNodes, -1);
+        state.resize(nbNodes, UNREACHED);
+        queued.resize(nbNodes, 0);
+    }
+}
+
+ShortestPathWorkspace & ShortestPathPool::getWorkspace(const void *graph){
+    std::shared_ptr<ShortestPathWorkspace> & workspace = workspaces[graph];
+    if(!workspace){
+        workspace = std::make_shared<ShortestPathWorkspace>();
+    }
+    return *workspace;
+}
+
+void ShortestPathPool::release(const void *graph){
+    workspaces.erase(graph);
+    capacityScalings.erase(graph);
+}
+
+void ShortestPathPool::clear(){
+    workspaces.clear();
+    capacityScalings.clear();
+}
@@ -0,0 +1,266 @@
+#ifndef __ShortestPathPool__h
+#define __ShortestPathPool__h
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <memory>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
+#include <utility>
+#include <lemon/core.h>
+#include <lemon/capacity_scaling.h>
+
+/************************************************************************************************************
+ * Shortest path computations are repeated thousands of times on the same graphs (one per demand or per
+ * edge, once per Lagrangian iteration). Building a LEMON Dijkstra, BellmanFord or CapacityScaling each time
+ * allocates all its node maps and heap from scratch. The classes below keep one workspace per graph, owned by
+ * the object owning the graph, that is allocated once and only reset on the nodes touched by the previous run.
+ ************************************************************************************************************/
+
+/************************************************************
+ * Preallocated data of a shortest path run on a graph. Arrays
+ * are indexed by node id and grow with the graph. Between two
+ * runs, only the entries of the touched nodes are reset.
+************************************************************/
+class ShortestPathWorkspace {
+
+public:
+    /** State of a node during a run. **/
+    enum NodeState { UNREACHED = 0, REACHED = 1, PROCESSED = 2 };
+
+    std::vector<double> dist;           /**< Distance from the source. **/
+    std::vector<int> predArc;           /**< Id of the arc reaching the node in the shortest path tree (-1 if none). **/
+    std::vector<char> state;            /**< State of the node (NodeState). **/
+    std::vector<char> queued;           /**< If the node is in the next round of the Bellman-Ford algorithm. **/
+    std::vector<int> touched;           /**< Ids of the nodes reached since the last reset. **/
+    std::vector<std::pair<double,int> > heap;   /**< Binary heap (distance, node id), with lazy deletion. **/
+    std::vector<int> active;            /**< Nodes whose distance changed in the current round (Bellman-Ford). **/
+    std::vector<int> next;              /**< Nodes whose distance changed in the next round (Bellman-Ford). **/
+
+    /** Constructor. **/
+    ShortestPathWorkspace(){}
+
+    /** Prepares the workspace for a run on a graph with node ids up to maxNodeId. Only the touched nodes are reset. **/
+    void reset(int maxNodeId);
+
+    /** Marks a node as reached with the given distance and predecessor arc. **/
+    void reach(int node, double distance, int arc){
+        if(state[node] == UNREACHED){
+            touched.push_back(node);
+            state[node] = REACHED;
+        }
+        dist[node] = distance;
+        predArc[node] = arc;
+    }
+
+    /** Returns the number of nodes reached since the last reset. **/
+    int getNbTouched() const { return (int)touched.size(); }
+};
+
+/************************************************************
+ * Pool of shortest path workspaces and min-cost flow solvers,
+ * keyed by the graph they run on. The pool is a member of the
+ * object owning the graphs (formulation, heuristic), so it is
+ * never shared between threads or outlived by its graphs.
+ * Graphs rebuilt during the lifetime of the owner must be
+ * released from the pool before being destroyed.
+************************************************************/
+class ShortestPathPool {
+
+private:
+    std::map<const void*, std::shared_ptr<ShortestPathWorkspace> > workspaces;   /**< Workspaces per graph. **/
+    std::map<const void*, std::map<std::type_index, std::shared_ptr<void> > > capacityScalings;   /**< CapacityScaling solvers per graph and solver type. **/
+
+public:
+    /** Returns the workspace associated with a graph, creating it if needed. **/
+    ShortestPathWorkspace & getWorkspace(const void *graph);
+
+    /** Returns the CapacityScaling solver associated with a graph, ready for a new run: the data structures are
+     * rebuilt from the graph (without reallocation) and the previous parameters are cleared. Solvers are stored
+     * per solver type, so the same graph can be used with several instantiations. **/
+    template <typename GR>
+    lemon::CapacityScaling<GR,int,double> & getCapacityScaling(const GR &graph){
+        typedef lemon::CapacityScaling<GR,int,double> Solver;
+        std::shared_ptr<void> & solver = capacityScalings[&graph][std::type_index(typeid(Solver))];
+        if(!solver){
+            solver = std::make_shared<Solver>(graph);
+        }else{
+            static_cast<Solver*>(solver.get())->reset();
+        }
+        return *static_cast<Solver*>(solver.get());
+    }
+
+    /** Removes the workspace and the solvers associated with a graph. **/
+    void release(const void *graph);
+
+    /** Removes everything from the pool. **/
+    void clear();
+};
+
+/************************************************************
+ * Dijkstra's algorithm running on a pooled workspace. It keeps
+ * the interface of lemon::Dijkstra used in the code (run,
+ * reached, dist, predArc, predNode). Results are valid until
+ * the next run on the same graph.
+************************************************************/
+template <typename GR, typename LEN>
+class PooledDijkstra {
+
+public:
+    typedef typename GR::Node Node;
+    typedef typename GR::Arc Arc;
+    typedef typename LEN::Value Value;
+
+private:
+    const GR &graph;
+    const LEN &length;
+    ShortestPathWorkspace &ws;
+
+    void push(double distance, int node){
+        ws.heap.push_back(std::make_pair(distance, node));
+        std::push_heap(ws.heap.begin(), ws.heap.end(), std::greater<std::pair<double,int> >());
+    }
+
+public:
+    /** Constructor. @param g The graph. @param len The arc lengths, which must be non-negative. @param pool The pool of the graph owner. **/
+    PooledDijkstra(const GR &g, const LEN &len, ShortestPathPool &pool) : graph(g), length(len), ws(pool.getWorkspace(&g)) {}
+
+    /** Computes the shortest paths from s. If t is given, stops as soon as t is processed. Returns if t is reached. **/
+    bool run(const Node &s, const Node &t = lemon::INVALID){
+        ws.reset(graph.maxNodeId());
+        int source = graph.id(s);
+        int target = (t == lemon::INVALID) ? -1 : graph.id(t);
+        ws.reach(source, 0.0, -1);
+        push(0.0, source);
+        while(!ws.heap.empty()){
+            std::pop_heap(ws.heap.begin(), ws.heap.end(), std::greater<std::pair<double,int> >());
+            double distance = ws.heap.back().first;
+            int u = ws.heap.back().second;
+            ws.heap.pop_back();
+            if(ws.state[u] == ShortestPathWorkspace::PROCESSED || distance > ws.dist[u]){
+                continue;
+            }
+            ws.state[u] = ShortestPathWorkspace::PROCESSED;
+            if(u == target){
+                break;
+            }
+            for (typename GR::OutArcIt a(graph, graph.nodeFromId(u)); a != lemon::INVALID; ++a){
+                int v = graph.id(graph.target(a));
+                double newDistance = distance + length[a];
+                if(ws.state[v] == ShortestPathWorkspace::UNREACHED || (ws.state[v] == ShortestPathWorkspace::REACHED && newDistance < ws.dist[v])){
+                    ws.reach(v, newDistance, graph.id(a));
+                    push(newDistance, v);
+                }
+            }
+        }
+        return (target == -1) || reached(t);
+    }
+
+    /** Returns if a node was reached. **/
+    bool reached(const Node &v) const {
+        int id = graph.id(v);
+        return (id < (int)ws.state.size()) && (ws.state[id] != ShortestPathWorkspace::UNREACHED);
+    }
+
+    /** Returns the distance of a reached node. **/
+    Value dist(const Node &v) const { return ws.dist[graph.id(v)]; }
+
+    /** Returns the last arc of the shortest path to a node (INVALID for the source and unreached nodes). **/
+    Arc predArc(const Node &v) const {
+        if(!reached(v) || ws.predArc[graph.id(v)] == -1){
+            return lemon::INVALID;
+        }
+        return graph.arcFromId(ws.predArc[graph.id(v)]);
+    }
+
+    /** Returns the previous node of the shortest path to a node (INVALID for the source and unreached nodes). **/
+    Node predNode(const Node &v) const {
+        Arc a = predArc(v);
+        return (a == lemon::INVALID) ? Node(lemon::INVALID) : graph.source(a);
+    }
+};
+
+/************************************************************
+ * Bellman-Ford algorithm running on a pooled workspace, for
+ * arc lengths that may be negative. Only the nodes whose
+ * distance changed are scanned in the next round. It keeps the
+ * interface of lemon::BellmanFord used in the code.
+************************************************************/
+template <typename GR, typename LEN>
+class PooledBellmanFord {
+
+public:
+    typedef typename GR::Node Node;
+    typedef typename GR::Arc Arc;
+    typedef typename LEN::Value Value;
+
+private:
+    const GR &graph;
+    const LEN &length;
+    ShortestPathWorkspace &ws;
+
+public:
+    /** Constructor. @param g The graph. @param len The arc lengths. @param pool The pool of the graph owner. **/
+    PooledBellmanFord(const GR &g, const LEN &len, ShortestPathPool &pool) : graph(g), length(len), ws(pool.getWorkspace(&g)) {}
+
+    /** Computes the shortest paths from s. Returns false if a negative cycle prevents the algorithm from converging
+     * within the number of nodes of the graph. **/
+    bool run(const Node &s){
+        int maxNodeId = graph.maxNodeId();
+        ws.reset(maxNodeId);
+        int source = graph.id(s);
+        ws.reach(source, 0.0, -1);
+        ws.active.clear();
+        ws.active.push_back(source);
+        for (int round = 0; round <= maxNodeId && !ws.active.empty(); round++){
+            ws.next.clear();
+            for (unsigned int i = 0; i < ws.active.size(); i++){
+                int u = ws.active[i];
+                double distance = ws.dist[u];
+                for (typename GR::OutArcIt a(graph, graph.nodeFromId(u)); a != lemon::INVALID; ++a){
+                    int v = graph.id(graph.target(a));
+                    double newDistance = distance + length[a];
+                    if(ws.state[v] == ShortestPathWorkspace::UNREACHED || newDistance < ws.dist[v]){
+                        ws.reach(v, newDistance, graph.id(a));
+                        if(!ws.queued[v]){
+                            ws.queued[v] = 1;
+                            ws.next.push_back(v);
+                        }
+                    }
+                }
+            }
+            for (unsigned int i = 0; i < ws.next.size(); i++){
+                ws.queued[ws.next[i]] = 0;
+            }
+            ws.active.swap(ws.next);
+        }
+        return ws.active.empty();
+    }
+
+    /** Returns if a node was reached. **/
+    bool reached(const Node &v) const {
+        int id = graph.id(v);
+        return (id < (int)ws.state.size()) && (ws.state[id] != ShortestPathWorkspace::UNREACHED);
+    }
+
+    /** Returns the distance of a reached node. **/
+    Value dist(const Node &v) const { return ws.dist[graph.id(v)]; }
+
+    /** Returns the last arc of the shortest path to a node (INVALID for the source and unreached nodes). **/
+    Arc predArc(const Node &v) const {
+        if(!reached(v) || ws.predArc[graph.id(v)] == -1){
+            return lemon::INVALID;
+        }
+        return graph.arcFromId(ws.predArc[graph.id(v)]);
+    }
+
+    /** Returns the previous node of the shortest path to a node (INVALID for the source and unreached nodes). **/
+    Node predNode(const Node &v) const {
+        Arc a = predArc(v);
+        return (a == lemon::INVALID) ? Node(lemon::INVALID) : graph.source(a);
+    }
+};
+
+#endif
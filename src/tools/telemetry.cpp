@@ -0,0 +1,190 @@
+#include "telemetry.h"
+
+#include <algorithm>
+
+#include "jsonWriter.h"
+#include "memoryUsage.h"
+
+bool Telemetry::enabled = false;
+FILE *Telemetry::file = NULL;
+std::mutex Telemetry::phasesMutex;
+std::map<std::string, Telemetry::Phase> Telemetry::phases;
+std::map<std::string, Telemetry::Phase> Telemetry::runPhases;
+std::atomic<long long> Telemetry::counters[Telemetry::NB_COUNTERS];
+long long Telemetry::runCounters[Telemetry::NB_COUNTERS];
+std::vector<double> Telemetry::rootBounds;
+std::atomic<long long> Telemetry::memory[Telemetry::NB_STRUCTURES];
+thread_local std::string Telemetry::path;
+int Telemetry::iteration = 0;
+std::string Telemetry::label;
+ClockTime Telemetry::iterationClock(ClockTime::getTimeNow());
+
+/****************************************************************************************/
+/*                                        Spans                                         */
+/****************************************************************************************/
+
+Telemetry::Span::Span(const char *name, bool memoryBoundary) : clock(ClockTime::getTimeNow()), parentLength(path.size()), open(true), boundary(memoryBoundary){
+    if (enabled){
+        if (!path.empty()){
+            path += "/";
+        }
+        path += name;
+    }
+}
+
+double Telemetry::Span::stop(){
+    double seconds = clock.getTimeInSecFromStart();
+    if (open && enabled){
+        add(path, seconds, boundary ? MemoryUsage::getCurrentRSS() : 0);
+        path.resize(parentLength);
+    }
+    open = false;
+    return seconds;
+}
+
+/****************************************************************************************/
+/*                                       Records                                        */
+/****************************************************************************************/
+
+void Telemetry::add(const std::string &phase, double seconds, long rss){
+    std::lock_guard<std::mutex> lock(phasesMutex);
+    Phase &p = phases[phase];
+    p.time += seconds;
+    p.count++;
+    p.rss = std::max(p.rss, rss);
+}
+
+void Telemetry::measureMemory(Structure structure, std::size_t bytes){
+    if (!enabled){
+        return;
+    }
+    long long value = (long long)bytes;
+    long long previous = memory[structure];
+    while (value > previous && !memory[structure].compare_exchange_weak(previous, value)){}
+}
+
+void Telemetry::open(const std::string &fileName){
+    file = fopen(fileName.c_str(), "a");
+    if (file == NULL){
+        std::cout << "WARNING: Could not open telemetry file " << fileName << ". Telemetry is disabled." << std::endl;
+        return;
+    }
+    for (int i = 0; i < NB_COUNTERS; i++){
+        counters[i] = 0;
+        runCounters[i] = 0;
+    }
+    for (int i = 0; i < NB_STRUCTURES; i++){
+        memory[i] = 0;
+    }
+    runPhases.clear();
+    rootBounds.clear();
+    enabled = true;
+}
+
+void Telemetry::close(){
+    if (file != NULL){
+        fclose(file);
+        file = NULL;
+    }
+    enabled = false;
+}
+
+void Telemetry::beginIteration(const std::string &name){
+    iteration++;
+    label = name;
+    iterationClock.setStart(ClockTime::getTimeNow());
+    std::lock_guard<std::mutex> lock(phasesMutex);
+    phases.clear();
+    for (int i = 0; i < NB_COUNTERS; i++){
+        counters[i] = 0;
+    }
+    for (int i = 0; i < NB_STRUCTURES; i++){
+        memory[i] = 0;
+    }
+}
+
+/* One line: {"iteration":..,"label":..,"time":..,"phases":{path:{"time":..,"count":..,"rss":..}},"counters":{..},"memory":{..}}.
+   The memory of the structures is in bytes, the resident memory (rss, peakRSS) in kB. */
+void Telemetry::endIteration(){
+    if (!enabled){
+        return;
+    }
+    static const char *counterNames[NB_COUNTERS] = {"arcs", "variables", "rows", "cuts", "callbacks", "reusedSubproblems", "subproblems"};
+    static const char *structureNames[NB_STRUCTURES] = {"graphs", "constraints", "cutPool", "duals", "heuristic"};
+    std::lock_guard<std::mutex> lock(phasesMutex);
+    JsonWriter json(file);
+    json.beginObject();
+    json.key("iteration"); json.value(iteration);
+    json.key("label"); json.value(label);
+    json.key("time"); json.value(iterationClock.getTimeInSecFromStart());
+    json.key("phases");
+    json.beginObject();
+    for (std::map<std::string, Phase>::const_iterator it = phases.begin(); it != phases.end(); ++it){
+        Phase &total = runPhases[it->first];
+        total.time += it->second.time;
+        total.count += it->second.count;
+        json.key(it->first);
+        json.beginObject();
+        json.key("time"); json.value(it->second.time);
+        json.key("count"); json.value(it->second.count);
+        if (it->second.rss > 0){
+            json.key("rss"); json.value((long long)it->second.rss);
+        }
+        json.endObject();
+    }
+    json.endObject();
+    json.key("counters");
+    json.beginObject();
+    for (int i = 0; i < NB_COUNTERS; i++){
+        runCounters[i] += counters[i];
+        json.key(counterNames[i]); json.value((long long)counters[i]);
+    }
+    json.endObject();
+    json.key("memory");
+    json.beginObject();
+    for (int i = 0; i < NB_STRUCTURES; i++){
+        json.key(structureNames[i]); json.value((long long)memory[i]);
+    }
+    json.key("rss"); json.value((long long)MemoryUsage::getCurrentRSS());
+    json.key("peakRSS"); json.value((long long)MemoryUsage::getPeakRSS());
+    json.endObject();
+    json.endObject();
+    fputc('\n', file);
+    fflush(file);
+    phases.clear();
+    for (int i = 0; i < NB_COUNTERS; i++){
+        counters[i] = 0;
+    }
+    for (int i = 0; i < NB_STRUCTURES; i++){
+        memory[i] = 0;
+    }
+}
+
+std::map<std::string, double> Telemetry::getRunTimes(){
+    std::lock_guard<std::mutex> lock(phasesMutex);
+    std::map<std::string, double> times;
+    for (std::map<std::string, Phase>::const_iterator it = runPhases.begin(); it != runPhases.end(); ++it){
+        times[it->first] = it->second.time;
+    }
+    return times;
+}
+
+long long Telemetry::getRunCounter(Counter counter){
+    std::lock_guard<std::mutex> lock(phasesMutex);
+    return runCounters[counter];
+}
+
+void Telemetry::recordRootBounds(const std::vector<double> &bounds){
+    if (!enabled){
+        return;
+    }
+    std::lock_guard<std::mutex> lock(phasesMutex);
+    if (rootBounds.empty()){
+        rootBounds = bounds;
+    }
+}
+
+std::vector<double> Telemetry::getRootBounds(){
+    std::lock_guard<std::mutex> lock(phasesMutex);
+    return rootBounds;
+}
@@ -0,0 +1,148 @@
+#ifndef __Telemetry__h
+#define __Telemetry__h
+
+#include <atomic>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "clockTime.h"
+
+/************************************************************
+ * Telemetry of the optimization. Phases are measured by    
+ * spans: a span opened while another one is open on the    
+ * same thread is its child, so that phases are identified  
+ * by their path (e.g. "solve/formulation/variables"). The  
+ * time and the number of occurrences of each phase are     
+ * accumulated, together with counters (arcs, variables,    
+ * rows, cuts, callback invocations, evaluated and reused   
+ * Lagrangian subproblems), and one NDJSON record is        
+ * appended to the telemetry file at the end of each        
+ * iteration of the online optimization. The lower bound    
+ * reached after each subproblem evaluated by the first     
+ * Lagrangian dual solved since the file was opened (the    
+ * root of the first tree) is kept to compare the dual      
+ * methods. Each record also holds the resident             
+ * memory of the process at the end of the phases opened as 
+ * memory boundaries (build, solve, graph, preprocessing,   
+ * formulation) and the largest size estimated for the main 
+ * structures (graphs, constraints, cut pool, dual vectors, 
+ * heuristic). Inner spans (e.g. the qot separation in the  
+ * callbacks) never read the resident memory, which costs a 
+ * system call. If no file is opened, spans only measure    
+ * their duration and nothing is recorded.                  
+************************************************************/
+class Telemetry {
+
+public:
+    /** Counters reported in each record. **/
+    enum Counter {
+        COUNTER_ARCS = 0,           /**< Arcs of the extended graphs after preprocessing. **/
+        COUNTER_VARIABLES = 1,      /**< Variables of the models. **/
+        COUNTER_ROWS = 2,           /**< Constraints of the models. **/
+        COUNTER_CUTS = 3,           /**< Cuts and lazy constraints added during branch-and-cut. **/
+        COUNTER_CALLBACKS = 4,      /**< Invocations of the MIP solver callbacks. **/
+        COUNTER_REUSED_SUBPROBLEMS = 5, /**< Lagrangian subproblems whose previous solution was reused. **/
+        COUNTER_SUBPROBLEMS = 6,    /**< Lagrangian subproblems evaluated (one per iteration of the dual methods). **/
+        NB_COUNTERS = 7
+    };
+
+    /** Structures whose memory is reported in each record. **/
+    enum Structure {
+        MEMORY_GRAPHS = 0,          /**< Extended graphs of the demands and their maps. **/
+        MEMORY_CONSTRAINTS = 1,     /**< Constraints of the formulations. **/
+        MEMORY_CUT_POOL = 2,        /**< Cut pools of the formulations. **/
+        MEMORY_DUALS = 3,           /**< Lagrangian multipliers, slacks and directions. **/
+        MEMORY_HEURISTIC = 4,       /**< Maps of the Lagrangian heuristics. **/
+        NB_STRUCTURES = 5
+    };
+
+    /************************************************************
+     * A timed phase. The span is opened by the constructor and 
+     * closed by stop or by the destructor.                     
+    ************************************************************/
+    class Span {
+    private:
+        ClockTime clock;            /**< Started when the span is opened. **/
+        std::size_t parentLength;   /**< Length of the path of the enclosing span. **/
+        bool open;                  /**< True until the span is closed. **/
+        bool boundary;              /**< True if the resident memory is read when the span is closed. **/
+
+    public:
+        /** Opens a span as a child of the innermost open span of the thread. @param name The phase name. @param memoryBoundary
+         * True if the resident memory must be read at the end of the phase; only for phases run a few times per iteration. **/
+        explicit Span(const char *name, bool memoryBoundary = false);
+
+        /** Closes the span and returns its duration in seconds. **/
+        double stop();
+
+        ~Span() { if (open) stop(); }
+    };
+
+private:
+    /** Accumulated time and number of occurrences of a phase, and the largest resident memory (kB) at its end. **/
+    struct Phase {
+        double time;
+        long long count;
+        long rss;
+    };
+
+    static bool enabled;                                    /**< True if a telemetry file is opened. **/
+    static FILE *file;                                      /**< File receiving the records. **/
+    static std::mutex phasesMutex;                          /**< Protects the phases. **/
+    static std::map<std::string, Phase> phases;             /**< Phases of the current iteration, by path. **/
+    static std::map<std::string, Phase> runPhases;          /**< Phases of the iterations ended since the file was opened. **/
+    static std::atomic<long long> counters[NB_COUNTERS];    /**< Counters of the current iteration. **/
+    static long long runCounters[NB_COUNTERS];              /**< Counters of the iterations ended since the file was opened. **/
+    static std::vector<double> rootBounds;                  /**< Lower bound after each subproblem evaluated by the first Lagrangian dual of the run. **/
+    static std::atomic<long long> memory[NB_STRUCTURES];    /**< Largest size (bytes) of each structure in the current iteration. **/
+    static thread_local std::string path;                   /**< Path of the innermost open span of the thread. **/
+    static int iteration;                                   /**< Number of the current iteration. **/
+    static std::string label;                               /**< Label of the current iteration. **/
+    static ClockTime iterationClock;                        /**< Started at the beginning of the current iteration. **/
+
+    /** Adds a duration to a phase. @param rss The resident memory at the end of the phase (0 if not measured). **/
+    static void add(const std::string &phase, double seconds, long rss = 0);
+
+public:
+    /** Opens the file receiving the records and enables telemetry. **/
+    static void open(const std::string &fileName);
+
+    /** Writes the last record and closes the file. **/
+    static void close();
+
+    /** Returns true if telemetry is recorded. **/
+    static bool isEnabled() { return enabled; }
+
+    /** Adds a duration measured elsewhere to the phase with the given name, child of the innermost open span. **/
+    static void record(const char *name, double seconds) { if (enabled) add(path.empty() ? std::string(name) : path + "/" + name, seconds); }
+
+    /** Increases a counter. **/
+    static void count(Counter counter, long long value = 1) { if (enabled) counters[counter] += value; }
+
+    /** Reports the size of a structure. The largest size of the iteration is recorded. @param bytes The size estimated. **/
+    static void measureMemory(Structure structure, std::size_t bytes);
+
+    /** Starts a new iteration. @param name The label of the iteration (e.g., the output code). **/
+    static void beginIteration(const std::string &name);
+
+    /** Appends the record of the current iteration to the file and resets the phases and counters. **/
+    static void endIteration();
+
+    /** Returns the time of each phase accumulated over the iterations ended since the file was opened, by path. **/
+    static std::map<std::string, double> getRunTimes();
+
+    /** Returns the value of a counter accumulated over the iterations ended since the file was opened. **/
+    static long long getRunCounter(Counter counter);
+
+    /** Keeps the lower bound reached after each subproblem evaluated by a Lagrangian dual solved from scratch. Only the 
+     * first one of the run is kept. @param bounds The lower bound after each evaluation, in order. **/
+    static void recordRootBounds(const std::vector<double> &bounds);
+
+    /** Returns the lower bound reached after each subproblem evaluated by the first Lagrangian dual of the run. **/
+    static std::vector<double> getRootBounds();
+};
+
+#endif
@@ -19,6 +19,12 @@ Input::Input(std::string parameterFile) : PARAMETER_FILE(parameterFile){
     if (isGNPYEnabled()){
         GNPY_topologyFile = getParameterValue("GNPY_topologyFile=");
         GNPY_equipmentFile = getParameterValue("GNPY_equipmentFile=");
+        GNPY_evaluator = to_QoTEvaluator(getParameterValue("GNPY_evaluator="));
+        GNPY_workerScript = getParameterValue("GNPY_workerScript=");
+        if (GNPY_workerScript.empty()){
+            GNPY_workerScript = "qot/gnpy_worker.py";
+        }
+        GNPY_cacheFile = getParameterValue("GNPY_cacheFile=");
     }
 
 
@@ -29,6 +35,10 @@ Input::Input(std::string parameterFile) : PARAMETER_FILE(parameterFile){
     allowBlocking = std::stoi(getParameterValue("allowBlocking="));
     linearRelaxation = std::stoi(getParameterValue("linearRelaxation="));
     userCuts = std::stoi(getParameterValue("userCuts="));
+    std::string lazy = getParameterValue("lazyNonOverlap=");
+    lazyNonOverlap = lazy.empty() ? false : std::stoi(lazy);
+    std::string symmetry = getParameterValue("symmetryBreaking=");
+    symmetryBreaking = symmetry.empty() ? false : std::stoi(symmetry);
     hopPenalty = std::stoi(getParameterValue("hopPenalty="));
     chosenFormulation = to_Formulation(getParameterValue("formulation="));
     chosenPartitionPolicy = to_PartitionPolicy(getParameterValue("partitionPolicy="));
@@ -39,15 +49,41 @@ Input::Input(std::string parameterFile) : PARAMETER_FILE(parameterFile){
     std::cout << "Getting optimization parameters..." << std::endl;
 
     chosenMipSolver = to_MIP_Solver(getParameterValue("solver="));
+    if (chosenMipSolver == MIP_SOLVER_GREEDY){
+        chosenGreedyFitPolicy = to_GreedyFitPolicy(getParameterValue("greedyFitPolicy="));
+        std::string nbPaths = getParameterValue("greedyNbPaths=");
+        greedyNbPaths = nbPaths.empty() ? 3 : std::stoi(nbPaths);
+        std::string admission = getParameterValue("greedyAdmission=");
+        greedyAdmission = admission.empty() ? false : std::stoi(admission);
+        std::string mipSolver = getParameterValue("greedyMipSolver=");
+        greedyMipSolver = mipSolver.empty() ? MIP_SOLVER_CPLEX : to_MIP_Solver(mipSolver);
+        std::string gapThreshold = getParameterValue("greedyGapThreshold=");
+        greedyGapThreshold = gapThreshold.empty() ? -1.0 : std::stod(gapThreshold);
+    }
+    else{
+        chosenGreedyFitPolicy = GREEDY_FIT_FIRST;
+        greedyNbPaths = 3;
+        greedyAdmission = false;
+        greedyMipSolver = MIP_SOLVER_CPLEX;
+        greedyGapThreshold = -1.0;
+    }
     chosenNodeMethod = to_NodeMethod(getParameterValue("method="));
     chosenRootMethod = to_RootMethod(getParameterValue("relaxMethod="));
     chosenPreprLvl = (PreprocessingLevel) std::stoi(getParameterValue("preprocessingLevel="));
+    std::string persist = getParameterValue("persistPaths=");
+    persistPaths = persist.empty() ? false : std::stoi(persist);
+    std::string decompose = getParameterValue("decomposition=");
+    decomposition = decompose.empty() ? false : std::stoi(decompose);
+    chosenLexTimePolicy = to_LexTimePolicy(getParameterValue("lexTimePolicy="));
+    std::string tolerance = getParameterValue("lexTolerance=");
+    lexTolerance = tolerance.empty() ? 0.0 : std::stod(tolerance);
 
 
     std::cout << "Getting execution parameters..." << std::endl;
 
     outputPath = getParameterValue("outputPath=");
     chosenOutputLvl = (OutputLevel) std::stoi(getParameterValue("outputLevel="));
+    telemetryFile = getParameterValue("telemetryFile=");
     nbSlicesInOutputFile = std::stoi(getParameterValue("nbSlicesInOutputFile="));
     timeLimit = to_timeLimit(getParameterValue("timeLimit="));
     globalTimeLimit = to_timeLimit(getParameterValue("globalTimeLimit="));
@@ -70,6 +106,8 @@ Input::Input(std::string parameterFile) : PARAMETER_FILE(parameterFile){
     alternativeStop = std::stoi(getParameterValue("alternativeStop="));
     warmstart = std::stoi(getParameterValue("warmstart="));
     lagOutputPath = getParameterValue("lagOutputPath=");
+    multiplierStoreFile = getParameterValue("multiplierStoreFile=");
+    chosenFixingMethod = to_FixingMethod(getParameterValue("lagrangianFixing="));
 
     /********************************************/
 
@@ -93,6 +131,9 @@ Input::Input(const Input &i) : PARAMETER_FILE(i.getParameterFile()){
     if (isGNPYEnabled()){
         GNPY_topologyFile = i.getGNPYTopologyFile();
         GNPY_equipmentFile = i.getGNPYEquipmentFile();
+        GNPY_evaluator = i.getGNPYEvaluator();
+        GNPY_workerScript = i.getGNPYWorkerScript();
+        GNPY_cacheFile = i.getGNPYCacheFile();
     }
 
     nbDemandsAtOnce = i.getNbDemandsAtOnce();
@@ -100,6 +141,8 @@ Input::Input(const Input &i) : PARAMETER_FILE(i.getParameterFile()){
     allowBlocking = i.isBlockingAllowed();
     linearRelaxation = i.isRelaxed();
     userCuts = i.isUserCutsActivated();
+    lazyNonOverlap = i.isNonOverlapLazy();
+    symmetryBreaking = i.isSymmetryBreakingActivated();
     hopPenalty = i.getHopPenalty();
     chosenFormulation = i.getChosenFormulation();
     chosenPartitionPolicy = i.getChosenPartitionPolicy();
@@ -107,11 +150,21 @@ Input::Input(const Input &i) : PARAMETER_FILE(i.getParameterFile()){
     partitionLoad = i.getPartitionLoad();
 
     chosenMipSolver = i.getChosenMIPSolver();
+    chosenGreedyFitPolicy = i.getChosenGreedyFitPolicy();
+    greedyNbPaths = i.getGreedyNbPaths();
+    greedyAdmission = i.isGreedyAdmission();
+    greedyMipSolver = i.getGreedyMIPSolver();
+    greedyGapThreshold = i.getGreedyGapThreshold();
+    persistPaths = i.arePathsPersisted();
+    decomposition = i.isDecompositionEnabled();
+    chosenLexTimePolicy = i.getChosenLexTimePolicy();
+    lexTolerance = i.getLexTolerance();
     chosenNodeMethod = i.getChosenNodeMethod();
     chosenRootMethod = i.getChosenRootMethod();
     chosenPreprLvl = i.getChosenPreprLvl();
 
     outputPath = i.getOutputPath();
+    telemetryFile = i.getTelemetryFile();
     chosenOutputLvl = i.getChosenOutputLvl();
     nbSlicesInOutputFile = i.getnbSlicesInOutputFile();
     timeLimit = i.getIterationTimeLimit();
@@ -133,6 +186,8 @@ Input::Input(const Input &i) : PARAMETER_FILE(i.getParameterFile()){
     alternativeStop = i.getAlternativeStop();
     warmstart = i.getWarmstart();
     lagOutputPath = i.getLagOutputPath();
+    multiplierStoreFile = i.getMultiplierStoreFile();
+    chosenFixingMethod = i.getChosenFixingMethod();
 
     /********************************************/
 }
@@ -297,6 +352,10 @@ Input::NodeMethod Input::to_NodeMethod(std::string data){
             policy = NODE_METHOD_VOLUME;
             return policy;
         }
+        else if (policyId == 3){
+            policy = NODE_METHOD_BUNDLE;
+            return policy;
+        }
         else{
             std::cout << "ERROR: Invalid node method." << std::endl;
             exit(0);
@@ -395,6 +454,16 @@ Input::MIP_Solver Input::to_MIP_Solver(std::string data){
             return policy;
             break;
         }
+        case 3: {
+            policy = MIP_SOLVER_GREEDY;
+            return policy;
+            break;
+        }
+        case 4: {
+            policy = MIP_SOLVER_COLUMN_GENERATION;
+            return policy;
+            break;
+        }
 
         default:
             std::cout << "ERROR: Invalid MIP_SOLVER." << std::endl;
@@ -408,6 +477,54 @@ Input::MIP_Solver Input::to_MIP_Solver(std::string data){
     }
 }
 
+/* Converts a string into a GreedyFitPolicy. */
+Input::GreedyFitPolicy Input::to_GreedyFitPolicy(std::string data){
+    if (data.empty()){
+        return GREEDY_FIT_FIRST;
+    }
+    int policyId = std::stoi(data);
+    switch (policyId)
+    {
+    case 0: {
+        return GREEDY_FIT_FIRST;
+    }
+    case 1: {
+        return GREEDY_FIT_LAST;
+    }
+    case 2: {
+        return GREEDY_FIT_EXACT;
+    }
+    case 3: {
+        return GREEDY_FIT_MOST_USED;
+    }
+    default:
+        std::cout << "ERROR: Invalid greedyFitPolicy." << std::endl;
+        exit(0);
+        break;
+    }
+}
+
+/* Converts a string into a LexTimePolicy. */
+Input::LexTimePolicy Input::to_LexTimePolicy(std::string data){
+    if (data.empty()){
+        return LEX_TIME_EQUAL;
+    }
+    int policyId = std::stoi(data);
+    switch (policyId)
+    {
+    case 0: {
+        return LEX_TIME_EQUAL;
+    }
+    case 1: {
+        return LEX_TIME_HALVING;
+    }
+    default:
+        std::cout << "ERROR: Invalid lexTimePolicy." << std::endl;
+        exit(0);
+        break;
+    }
+}
+
 /******** INCLUSION FOR LAGRANGIAN *********/
 
 Input::LagFormulation Input::to_LagFormulation(std::string data){
@@ -544,6 +661,55 @@ Input::ProjectionType Input::to_ProjectionType(std::string data){
         exit(0);
     }
 }
+
+Input::FixingMethod Input::to_FixingMethod(std::string data){
+    if (data.empty()){
+        return FIXING_NONE;
+    }
+    int methodId = std::stoi(data);
+    switch (methodId)
+    {
+    case 0: {
+        return FIXING_NONE;
+    }
+    case 1: {
+        return FIXING_SUBGRADIENT;
+    }
+    case 2: {
+        return FIXING_VOLUME;
+    }
+    case 3: {
+        return FIXING_BUNDLE;
+    }
+    default:
+        std::cout << "ERROR: Invalid lagrangianFixing." << std::endl;
+        exit(0);
+        break;
+    }
+}
+
+Input::QoTEvaluator Input::to_QoTEvaluator(std::string data){
+    if (data.empty()){
+        return QOT_EVALUATOR_GNPY_COMMAND;
+    }
+    int evaluatorId = std::stoi(data);
+    switch (evaluatorId)
+    {
+    case 0: {
+        return QOT_EVALUATOR_GNPY_COMMAND;
+    }
+    case 1: {
+        return QOT_EVALUATOR_GNPY_WORKER;
+    }
+    case 2: {
+        return QOT_EVALUATOR_GN_MODEL;
+    }
+    default:
+        std::cout << "ERROR: Invalid GNPY_evaluator." << std::endl;
+        exit(0);
+        break;
+    }
+}
 /********************************************/
 
 void Input::checkConsistency(){
@@ -551,10 +717,27 @@ void Input::checkConsistency(){
         std::cout << "ERROR: MIP_Solver Gurobi has been chosen but still needs to be implemented." << std::endl;
         exit(0);
     }
-    if (getChosenNodeMethod() != NODE_METHOD_LINEAR_RELAX && getChosenMIPSolver() != MIP_SOLVER_CBC){
+    if (getChosenMIPSolver() == MIP_SOLVER_GREEDY && getGreedyMIPSolver() == MIP_SOLVER_GREEDY){
+        std::cout << "ERROR: The greedy solver must escalate to a MIP solver (greedyMipSolver is 0 or 1)." << std::endl;
+        exit(0);
+    }
+    if (getGreedyNbPaths() < 1){
+        std::cout << "ERROR: The greedy solver needs at least one candidate path (greedyNbPaths)." << std::endl;
+        exit(0);
+    }
+    MIP_Solver mipSolver = (getChosenMIPSolver() == MIP_SOLVER_GREEDY) ? getGreedyMIPSolver() : getChosenMIPSolver();
+    if (getChosenNodeMethod() != NODE_METHOD_LINEAR_RELAX && mipSolver != MIP_SOLVER_CBC){
         std::cout << "ERROR: Subgradient methods should only be called with CBC." << std::endl;
         exit(0);
     }
+    if (mipSolver == MIP_SOLVER_COLUMN_GENERATION && chosenObj.size() > 1){
+        std::cout << "ERROR: The column generation solver optimizes a single objective function." << std::endl;
+        exit(0);
+    }
+    if (mipSolver == MIP_SOLVER_COLUMN_GENERATION && (chosenObj[0] == OBJECTIVE_METRIC_1p || chosenObj[0] == OBJECTIVE_METRIC_8)){
+        std::cout << "ERROR: The column generation solver is not defined for objectives 1p and 8, which are not additive over the paths." << std::endl;
+        exit(0);
+    }
     if((getChosenNodeMethod() != NODE_METHOD_LINEAR_RELAX) && (getChosenLagFormulation() != LAG_FLOW) && (!isLagrangianRelaxed())){
         std::cout << "ERROR: The Branch and Bound with lagrangian relaxation is defined only for the Lagrangian Flow formulation." << std::endl;
         exit(0);
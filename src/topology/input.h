@@ -28,7 +28,23 @@ public:
 	enum MIP_Solver {						
 		MIP_SOLVER_CPLEX = 0,  	/**< The MIP is solved using CPLEX. **/
 		MIP_SOLVER_CBC = 1, 	/**< The MIP is solved using CBC. **/
-		MIP_SOLVER_GUROBI = 2  	/**< The MIP is solved using Gurobi. #TODO Implement gurobi.**/
+		MIP_SOLVER_GUROBI = 2,  /**< The MIP is solved using Gurobi. #TODO Implement gurobi.**/
+		MIP_SOLVER_GREEDY = 3, 	/**< No MIP is solved: demands are routed one by one on k shortest paths with a fit policy. **/
+		MIP_SOLVER_COLUMN_GENERATION = 4	/**< The MIP is solved by path-based column generation, the final master being solved with CBC. **/
+	};
+
+	/** Enumerates the possible policies for choosing the slices of a demand in the greedy solver. **/
+	enum GreedyFitPolicy {
+		GREEDY_FIT_FIRST = 0,		/**< The lowest free window among the candidate paths. **/
+		GREEDY_FIT_LAST = 1,		/**< The highest free window among the candidate paths. **/
+		GREEDY_FIT_EXACT = 2,		/**< The window of the smallest free block that can hold the demand (an exact fit if possible). **/
+		GREEDY_FIT_MOST_USED = 3	/**< The free window whose slices are the most used over the whole network. **/
+	};
+
+	/** Enumerates the possible policies for sharing the time limit of an iteration among the objectives of a lexicographic optimization. **/
+	enum LexTimePolicy {
+		LEX_TIME_EQUAL = 0,		/**< Each objective gets an equal share of the time left. **/
+		LEX_TIME_HALVING = 1	/**< Each objective but the last gets half of the time left; the last gets the rest. **/
 	};
 
 
@@ -36,7 +52,8 @@ public:
 	enum NodeMethod {
 		NODE_METHOD_LINEAR_RELAX = 0,  		/**< At each node of the enumeration tree, Linear Relaxation is applied. **/
 		NODE_METHOD_SUBGRADIENT = 1, 		/**< At each node of the enumeration tree, the Subgradient algorithm is applied. #TODO Implement subgradient inside nodes. **/
-		NODE_METHOD_VOLUME = 2 				/**< At each node of the enumeration tree, the Volume algorithm is applied. #TODO Implement volume. **/
+		NODE_METHOD_VOLUME = 2, 			/**< At each node of the enumeration tree, the Volume algorithm is applied. #TODO Implement volume. **/
+		NODE_METHOD_BUNDLE = 3 				/**< At each node of the enumeration tree, the proximal Bundle method is applied. **/
 	};
 
 	/** Enumerates the possible methods to be applied at the root **/
@@ -77,7 +94,8 @@ public:
 	enum PreprocessingLevel {
 		PREPROCESSING_LVL_NO = 0,		/**< Only remove arcs that do not fit the demand load. **/
 		PREPROCESSING_LVL_PARTIAL = 1,	/**< Previous levels + look for arcs that would induce length violation and arcs whose neighboors cannot forward the demand. **/
-		PREPROCESSING_LVL_FULL = 2		/**< Previous levels recursively until no additional arc can be removed. **/
+		PREPROCESSING_LVL_FULL = 2,		/**< Previous levels recursively until no additional arc can be removed. **/
+		PREPROCESSING_LVL_QOT = 3		/**< Previous levels + erase arcs that cannot lie on a route satisfying the QoT of the demand's mode, as estimated by the GN model. Heuristic: GNPY may accept some erased routes. **/
 	};
 
 	/******** INCLUSION FOR LAGRANGIAN *********/
@@ -108,6 +126,21 @@ public:
 		IMPROVED = 1,            /**< Negative directions with multiplier eguals to zero are not considered on the stepsize. **/
 		PROJECTED = 2,           /**< Negatice direction are not considered in the stepsize. **/
 	};
+
+	/** Enumerates the possible Lagrangian methods used to fix arcs before building the MIP. **/
+	enum FixingMethod{
+		FIXING_NONE = 0,         /**< No arc is fixed. **/
+		FIXING_SUBGRADIENT = 1,  /**< The Lagrangian bounds come from the Subgradient algorithm. **/
+		FIXING_VOLUME = 2,       /**< The Lagrangian bounds come from the Volume algorithm. **/
+		FIXING_BUNDLE = 3        /**< The Lagrangian bounds come from the proximal Bundle method. **/
+	};
+
+	/** Enumerates the possible backends evaluating the QoT of candidate lightpaths. **/
+	enum QoTEvaluator{
+		QOT_EVALUATOR_GNPY_COMMAND = 0,	/**< Calls gnpy-path-request on each candidate. **/
+		QOT_EVALUATOR_GNPY_WORKER = 1,	/**< Sends the candidates to persistent GNPY worker processes. **/
+		QOT_EVALUATOR_GN_MODEL = 2,		/**< Uses the native closed-form GN model. **/
+	};
 	/*******************************************/
 	
 private:
@@ -118,12 +151,22 @@ private:
 	std::string demandToBeRoutedFolder;				/**< Path to the folder containing the files on the non-routed demands. **/
 	std::vector<std::string> demandToBeRoutedFile;	/**< A vector storing the paths to the files containing information on the non-routed demands. **/
 	std::string outputPath;							/**< Path to the folder where the output files will be sent by the end of the optimization procedure.**/
+	std::string telemetryFile;						/**< File receiving one NDJSON telemetry record per optimization iteration (empty if telemetry is disabled).**/
 	
 
 	NodeMethod chosenNodeMethod;			/**< Refers to which method is applied for solving each node.**/
 	RootMethod chosenRootMethod;			/**< Refers to which method is applied for solving the root. **/
 	Formulation chosenFormulation;			/**< Refers to the formulation used to solve the problem. **/
 	MIP_Solver chosenMipSolver;				/**< Refers to the MIP solver chosen to applied. **/
+	GreedyFitPolicy chosenGreedyFitPolicy;	/**< Refers to how slices are chosen by the greedy solver. **/
+	int greedyNbPaths;						/**< Number of candidate paths per demand in the greedy solver. **/
+	bool greedyAdmission;					/**< If the greedy solver escalates to a MIP solver when it fails or its gap estimate is too large. **/
+	MIP_Solver greedyMipSolver;				/**< The MIP solver the greedy solver escalates to. **/
+	double greedyGapThreshold;				/**< Gap estimate above which the greedy solver escalates (negative if it only escalates on failure). **/
+	bool persistPaths;						/**< If the k shortest paths of the topology are kept in a file next to the topology file. **/
+	bool decomposition;						/**< If the batch is split into independent sub-batches solved in parallel. **/
+	LexTimePolicy chosenLexTimePolicy;		/**< Refers to how the time limit is shared among the objectives. **/
+	double lexTolerance;					/**< Relative tolerance on the value of an objective once it is optimized. **/
 	PreprocessingLevel chosenPreprLvl;		/**< Refers to which level of preprocessing is applied before solving the problem.**/
 	std::vector<ObjectiveMetric> chosenObj;	/**< Refers to which objective is optimized.**/
 	OutputLevel chosenOutputLvl;			/**< Refers to which output policy is adopted.**/
@@ -140,10 +183,15 @@ private:
 	int hopPenalty;						/**< Refers to the penalty of reach applied on each hop. **/
 	bool linearRelaxation;				/**< If this option is active, all variables are real (i.e., runs linear relaxation). **/
 	bool userCuts;						/**< If this option is active, apply user cuts. **/
+	bool lazyNonOverlap;				/**< If this option is active, the non-overlapping constraints of the flow formulation are added when violated. **/
+	bool symmetryBreaking;				/**< If this option is active, identical demands are ordered by their last slice. **/
 
 	bool GNPY_activation;				/**< If this option is active, the solution provided is guaranteed to satisfy GNPY constraints. Whenever a candidate solution is found, GNPY is called to validade or to reject such solution. **/
 	std::string GNPY_topologyFile;		/**< The .json file defining the topology that serves as input for GNPY. **/
 	std::string GNPY_equipmentFile;		/**< The .json file defining the equipment present in the topology that serves as input for GNPY. **/
+	QoTEvaluator GNPY_evaluator;		/**< The backend used to evaluate the QoT of candidate solutions. **/
+	std::string GNPY_workerScript;		/**< The python script run by the persistent GNPY workers. **/
+	std::string GNPY_cacheFile;			/**< File where the QoT evaluations are kept from one execution to the next (empty if they are only kept in memory). **/
 
 	double lagrangianMultiplier_zero;	/**< The initial value of the lagrangian multiplier used if subgradient method is chosen. **/
 	double lagrangianLambda_zero;		/**< The initial value of the lambda used for computing the step size if subgradient method is chosen. **/
@@ -161,6 +209,8 @@ private:
 	bool alternativeStop;                    /**< If an alternative stopping criterion is used or not. **/
 	bool warmstart;                          /**< If the warmstart for the initial multipliers is used or not. **/
 	std::string lagOutputPath;	                 /**< Path to the folder where the lagrangian output files will be sent by the end of the optimization procedure.**/
+	std::string multiplierStoreFile;         /**< File where the lagrangian multipliers are kept from one execution to the next (empty if they are only kept in memory). **/
+	FixingMethod chosenFixingMethod;         /**< Lagrangian method used to fix arcs before building the MIP (FIXING_NONE if no fixing is done). **/
 	/*******************************************/
 
 public:
@@ -202,6 +252,9 @@ public:
 
 	/** Returns the path to the folder where the output files will be sent by the end of the optimization procedure.**/
     std::string getOutputPath() const { return outputPath; }
+
+	/** Returns the file receiving the telemetry records (empty if telemetry is disabled). **/
+    std::string getTelemetryFile() const { return telemetryFile; }
 	
 	/** Returns the number of demands to be treated in a single optimization. **/
     int getNbDemandsAtOnce() const { return nbDemandsAtOnce; }
@@ -230,6 +283,12 @@ public:
 	/** Returns true if user cuts are applied. **/
     bool isUserCutsActivated() const { return userCuts; }
 
+	/** Returns if the non-overlapping constraints of the flow formulation are added when violated. **/
+    bool isNonOverlapLazy() const { return lazyNonOverlap; }
+
+	/** Returns if identical demands are ordered by their last slice. **/
+    bool isSymmetryBreakingActivated() const { return symmetryBreaking; }
+
 	/** Returns the hop penality. **/
     int getHopPenalty() const { return hopPenalty; }
 
@@ -244,6 +303,15 @@ public:
 	/** Returns the path to the .json equipment file that serves as input for the GNPY.**/
     std::string getGNPYEquipmentFile() const { return GNPY_equipmentFile; }
 
+	/** Returns the backend used to evaluate the QoT of candidate solutions. **/
+	const QoTEvaluator & getGNPYEvaluator() const { return GNPY_evaluator; }
+
+	/** Returns the path to the python script run by the persistent GNPY workers. **/
+    std::string getGNPYWorkerScript() const { return GNPY_workerScript; }
+
+	/** Returns the file where the QoT evaluations are kept from one execution to the next (empty if none). **/
+    std::string getGNPYCacheFile() const { return GNPY_cacheFile; }
+
 	/** Returns the identifier of the method chosen for solving each node. **/
     const NodeMethod & getChosenNodeMethod() const { return chosenNodeMethod; }
 
@@ -256,6 +324,36 @@ public:
 	/** Returns the identifier of the MIP solver chosen for solving the formulation. **/
     const MIP_Solver & getChosenMIPSolver() const { return chosenMipSolver; }
 
+	/** Returns the policy used by the greedy solver for choosing slices. **/
+    const GreedyFitPolicy & getChosenGreedyFitPolicy() const { return chosenGreedyFitPolicy; }
+
+	/** Returns the number of candidate paths per demand in the greedy solver. **/
+    int getGreedyNbPaths() const { return greedyNbPaths; }
+
+	/** Returns if the greedy solver escalates to a MIP solver when it fails or its gap estimate is too large. **/
+    bool isGreedyAdmission() const { return greedyAdmission; }
+
+	/** Returns the MIP solver the greedy solver escalates to. **/
+    const MIP_Solver & getGreedyMIPSolver() const { return greedyMipSolver; }
+
+	/** Returns the gap estimate above which the greedy solver escalates (negative if it only escalates on failure). **/
+    double getGreedyGapThreshold() const { return greedyGapThreshold; }
+
+	/** Returns if the k shortest paths of the topology are kept in a file. **/
+    bool arePathsPersisted() const { return persistPaths; }
+
+	/** Returns the file keeping the k shortest paths of the topology (empty if they are not persisted). **/
+    std::string getPathCacheFile() const { return persistPaths ? topologyFile + ".paths" : ""; }
+
+	/** Returns if the batch is split into independent sub-batches solved in parallel. **/
+    bool isDecompositionEnabled() const { return decomposition; }
+
+	/** Returns the policy sharing the time limit of an iteration among the objectives. **/
+    const LexTimePolicy & getChosenLexTimePolicy() const { return chosenLexTimePolicy; }
+
+	/** Returns the relative tolerance on the value of an objective once it is optimized. **/
+    double getLexTolerance() const { return lexTolerance; }
+
 	/** Returns the identifier of the chosen preprocessing level. **/
     const PreprocessingLevel & getChosenPreprLvl() const { return chosenPreprLvl; }
 
@@ -318,6 +416,12 @@ public:
 	/** Returns the path to the folder where the lagrangian output files will be sent by the end of the optimization procedure.**/
     std::string getLagOutputPath() const { return lagOutputPath; }
 
+	/** Returns the file where the lagrangian multipliers are kept from one execution to the next (empty if none). **/
+	std::string getMultiplierStoreFile() const { return multiplierStoreFile; }
+
+	/** Returns the lagrangian method used to fix arcs before building the MIP (FIXING_NONE if none). **/
+	const FixingMethod & getChosenFixingMethod() const { return chosenFixingMethod; }
+
 	/****************************************************************************************/
 	/*										Setters											*/
 	/****************************************************************************************/
@@ -331,6 +435,15 @@ public:
 	/** Changes the global time limit. @param val The new time limit (in seconds). **/
     void setGlobalTimeLimit(const int val) { globalTimeLimit = val; }
 
+	/** Changes the method applied for solving each node. @param val The new node method. **/
+    void setChosenNodeMethod(const NodeMethod val) { chosenNodeMethod = val; }
+
+	/** Changes the Lagrangian formulation. @param val The new Lagrangian formulation. **/
+    void setChosenLagFormulation(const LagFormulation val) { lagChosenFormulation = val; }
+
+	/** Changes the preprocessing level. @param val The new preprocessing level. **/
+    void setChosenPreprLvl(const PreprocessingLevel val) { chosenPreprLvl = val; }
+
 	/****************************************************************************************/
 	/*										Methods											*/
 	/****************************************************************************************/
@@ -358,6 +471,12 @@ public:
 	/** Converts a string into a MIP_Solver. **/
 	MIP_Solver to_MIP_Solver(std::string data);
 
+	/** Converts a string into a GreedyFitPolicy. \note By default, first fit is used. **/
+	GreedyFitPolicy to_GreedyFitPolicy(std::string data);
+
+	/** Converts a string into a LexTimePolicy. \note By default, the time is shared equally. **/
+	LexTimePolicy to_LexTimePolicy(std::string data);
+
 	/** Converts a string into time limit. \note By default, time limit is unlimited. **/
 	int to_timeLimit(std::string data);
 
@@ -373,6 +492,12 @@ public:
 	DirectionMethod to_DirectionMethod(std::string data);
 	ProjectionType to_ProjectionType(std::string data);
 
+	/** Converts a string into a FixingMethod. \note By default, no arc is fixed. **/
+	FixingMethod to_FixingMethod(std::string data);
+
+	/** Converts a string into a QoTEvaluator. \note By default, gnpy-path-request is called. **/
+	QoTEvaluator to_QoTEvaluator(std::string data);
+
 	/****************************************************************************************/
 	/*										Destructor										*/
 	/****************************************************************************************/
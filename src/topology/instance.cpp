@@ -14,7 +14,10 @@ Instance::Instance(const Input &i) : input(i){
 }
 
 /* Copy constructor. */
-Instance::Instance(const Instance &i) : input(i.getInput()){
+Instance::Instance(const Instance &i) : Instance(i, i.getInput()){}
+
+/* Copies an instance with another input. */
+Instance::Instance(const Instance &i, const Input &in) : input(in){
 	this->setNbNodes(i.getNbNodes());
 	this->setWasBlocked(i.getWasBlocked());
 	for(int j=0;j<i.tabEdge.size();j++){
@@ -23,6 +26,7 @@ Instance::Instance(const Instance &i) : input(i.getInput()){
 	//this->setTabEdge(i.getTabEdge());
 	this->setTabDemand(i.getTabDemand());
 	this->setNextDemandToBeRoutedIndex(i.getNextDemandToBeRoutedIndex());
+	this->fixedArcs = i.fixedArcs;
 }
 
 /****************************************************************************************/
@@ -489,6 +493,24 @@ int Instance::getNumberOfOccupiedSlices() const{
 	return value;
 }
 
+/* Returns true if the arc of the given edge and slice leaving the given node was fixed to zero for the given demand. */
+bool Instance::isFixedArc(int demandId, int edge, int slice, int source) const{
+	std::map<int, std::set< std::tuple<int,int,int> > >::const_iterator it = fixedArcs.find(demandId);
+	if (it == fixedArcs.end()){
+		return false;
+	}
+	return (it->second.count(std::make_tuple(edge, slice, source)) > 0);
+}
+
+/* Returns the number of arcs fixed to zero for all demands. */
+int Instance::getNbFixedArcs() const{
+	int value = 0;
+	for (std::map<int, std::set< std::tuple<int,int,int> > >::const_iterator it = fixedArcs.begin(); it != fixedArcs.end(); ++it){
+		value += (int)it->second.size();
+	}
+	return value;
+}
+
 double Instance::getMetricValue(Metric metric) const{
 	
 	double value = 0;
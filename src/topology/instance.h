@@ -2,6 +2,9 @@
 #define __Instance__h
 
 #include <float.h>
+#include <map>
+#include <set>
+#include <tuple>
 
 #include "demand.h"
 #include "input.h"
@@ -32,6 +35,7 @@ private:
 	int nbInitialDemands;				/**< The number of demands routed in the first initial mapping. **/
 	int nextDemandToBeRoutedIndex;		/**< Stores the index of the next demand to be analyzed in tabDemand. **/
 	bool wasBlocked;
+	std::map<int, std::set< std::tuple<int,int,int> > > fixedArcs;	/**< For each demand id, the arcs (edge, slice, source node) that cannot be part of an optimal solution. **/
 public:
 
 	/****************************************************************************************/
@@ -44,6 +48,9 @@ public:
 	/** Copy constructor. @param i The instance to be copied. **/
 	Instance(const Instance & i);
 
+	/** Copies an instance with another input. @param i The instance to be copied. @param in The input of the copy. **/
+	Instance(const Instance & i, const Input &in);
+
 	/****************************************************************************************/
 	/*										Getters											*/
 	/****************************************************************************************/
@@ -78,7 +85,7 @@ public:
 	Fiber getPhysicalLinkBetween(int s, int t);	
 
 	/** Returns the vector of Fiber. **/
-	std::vector<Fiber> getTabEdge() const { return this->tabEdge; }
+	const std::vector<Fiber> & getTabEdge() const { return this->tabEdge; }
 
 	/** Returns the demand with given index. @param index The index of Demand required in tabDemand.**/
 	const Demand & getDemandFromIndex(int index) const { return this->tabDemand[index]; }
@@ -101,6 +108,12 @@ public:
 	double getMetricValue(Metric m) const;
 
 	int getNumberOfOccupiedSlices() const;
+
+	/** Returns true if the arc of the given edge and slice leaving the given node was fixed to zero for the given demand. **/
+	bool isFixedArc(int demandId, int edge, int slice, int source) const;
+
+	/** Returns the number of arcs fixed to zero for all demands. **/
+	int getNbFixedArcs() const;
 	
 	/****************************************************************************************/
 	/*										Setters											*/
@@ -138,6 +151,12 @@ public:
 	/** Changes the index of the next demand to be analyzed in tabDemand. @param val The new index.**/
 	void setNextDemandToBeRoutedIndex(int val) { this->nextDemandToBeRoutedIndex = val; }
 
+	/** Fixes to zero the arc of the given edge and slice leaving the given node for the given demand. **/
+	void addFixedArc(int demandId, int edge, int slice, int source) { this->fixedArcs[demandId].insert(std::make_tuple(edge, slice, source)); }
+
+	/** Removes all fixed arcs. **/
+	void clearFixedArcs() { this->fixedArcs.clear(); }
+
 	/** Changes the number of demands to be treated in a single optimization. @param val The new number of demands. **/
     void setNbDemandsAtOnce(const int val) { this->input.setNbDemandsAtOnce(val); }
 